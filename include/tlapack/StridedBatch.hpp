@@ -0,0 +1,124 @@
+/// @file StridedBatch.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STRIDED_BATCH_HH
+#define TLAPACK_STRIDED_BATCH_HH
+
+#include <cassert>
+
+#include "tlapack/base/exceptionHandling.hpp"
+
+namespace tlapack {
+
+/** Batch of m-by-n matrices stored in a single array.
+ *
+ * The entry (i,j) of the b-th matrix is
+ *
+ *      X(b,i,j) = ptr[ b*bstride + i*rstride + j*cstride ].
+ *
+ * Two layouts are common:
+ *
+ * - Strided: the matrices are stored one after the other, each in column-major
+ *   order. See strided_batch().
+ * - Interleaved: the entries (i,j) of all matrices are contiguous, so that the
+ *   batch index varies the fastest. The batched routines then operate on
+ *   several matrices at once in SIMD lanes. See interleaved_batch().
+ *
+ * A batch of vectors is a batch of m-by-1 matrices.
+ *
+ * @tparam T Floating-point type
+ * @tparam idx_t Index type
+ */
+template <class T, class idx_t = std::size_t>
+struct StridedBatch {
+    idx_t m, n;       ///< Sizes of each matrix
+    idx_t count;      ///< Number of matrices
+    T* ptr;           ///< Pointer to array in memory
+    idx_t bstride;    ///< Distance between consecutive matrices
+    idx_t rstride;    ///< Distance between consecutive rows
+    idx_t cstride;    ///< Distance between consecutive columns
+
+    constexpr T& operator()(idx_t b, idx_t i, idx_t j) const noexcept
+    {
+        assert(b >= 0);
+        assert(b < count);
+        assert(i >= 0);
+        assert(i < m);
+        assert(j >= 0);
+        assert(j < n);
+        return ptr[b * bstride + i * rstride + j * cstride];
+    }
+
+    constexpr StridedBatch(idx_t m,
+                           idx_t n,
+                           idx_t count,
+                           T* ptr,
+                           idx_t bstride,
+                           idx_t rstride,
+                           idx_t cstride)
+        : m(m),
+          n(n),
+          count(count),
+          ptr(ptr),
+          bstride(bstride),
+          rstride(rstride),
+          cstride(cstride)
+    {
+        tlapack_check(m >= 0);
+        tlapack_check(n >= 0);
+        tlapack_check(count >= 0);
+    }
+};
+
+/** Batch of count column-major m-by-n matrices with leading dimension ldim,
+ * the b-th of which starts at ptr + b*stride.
+ */
+template <class T, class idx_t>
+constexpr StridedBatch<T, idx_t> strided_batch(
+    idx_t m, idx_t n, idx_t count, T* ptr, idx_t ldim, idx_t stride)
+{
+    tlapack_check(ldim >= m);
+    return StridedBatch<T, idx_t>(m, n, count, ptr, stride, 1, ldim);
+}
+
+/// Batch of count column-major m-by-n matrices stored contiguously
+template <class T, class idx_t>
+constexpr StridedBatch<T, idx_t> strided_batch(idx_t m,
+                                               idx_t n,
+                                               idx_t count,
+                                               T* ptr)
+{
+    return strided_batch(m, n, count, ptr, m, m * n);
+}
+
+/** Batch of count interleaved m-by-n matrices.
+ *
+ * The entry (i,j) of the b-th matrix is ptr[ b + (i + j*ldim)*count ].
+ */
+template <class T, class idx_t>
+constexpr StridedBatch<T, idx_t> interleaved_batch(
+    idx_t m, idx_t n, idx_t count, T* ptr, idx_t ldim)
+{
+    tlapack_check(ldim >= m);
+    return StridedBatch<T, idx_t>(m, n, count, ptr, 1, count, ldim * count);
+}
+
+/// Batch of count interleaved m-by-n matrices with ldim = m
+template <class T, class idx_t>
+constexpr StridedBatch<T, idx_t> interleaved_batch(idx_t m,
+                                                   idx_t n,
+                                                   idx_t count,
+                                                   T* ptr)
+{
+    return interleaved_batch(m, n, count, ptr, m);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STRIDED_BATCH_HH
@@ -0,0 +1,197 @@
+/// @file base/TaskGraph.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BASE_TASKGRAPH_HH
+#define TLAPACK_BASE_TASKGRAPH_HH
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "tlapack/base/ThreadPool.hpp"
+
+namespace tlapack {
+
+/**
+ * @brief Dependency-tracking task scheduler.
+ *
+ * Tasks are inserted in the order of a sequential algorithm, together with
+ * the data they read and write. Data are identified by integer handles, e.g.,
+ * the index of a tile. The graph infers the dependencies from the accesses,
+ * as in the sequential task flow model of StarPU:
+ *
+ * - a task that reads a handle runs after the last task that wrote to it;
+ * - a task that writes to a handle runs after the last task that wrote to it
+ *   and after all tasks that read it since then.
+ *
+ * run() executes the graph on a ThreadPool. Ready tasks are started in
+ * decreasing order of priority, where the priority of a task is the cost of
+ * the most expensive path from the task to the end of the graph. Tasks in the
+ * critical path are thus executed as soon as possible, which yields the
+ * lookahead of the panel factorizations in dense factorizations.
+ */
+class TaskGraph {
+   public:
+    /// Access of a task to a data handle
+    struct Access {
+        size_t handle;  ///< Data handle
+        bool write;     ///< True if the task writes to the handle
+    };
+
+    /// Read access to handle h
+    static constexpr Access read(size_t h) noexcept { return Access{h, false}; }
+
+    /// Write (or read-write) access to handle h
+    static constexpr Access write(size_t h) noexcept { return Access{h, true}; }
+
+    /**
+     * @brief Inserts a task in the graph.
+     *
+     * @param[in] f Function executed by the task.
+     * @param[in] cost Estimated cost of the task, e.g., its number of flops.
+     * @param[in] accesses Data handles accessed by the task.
+     *
+     * @return Index of the task.
+     */
+    size_t insert_task(std::function<void()> f,
+                       double cost,
+                       std::initializer_list<Access> accesses)
+    {
+        const size_t id = tasks.size();
+        tasks.push_back(Task{std::move(f), cost, 0, 0, {}});
+
+        for (const Access& a : accesses) {
+            HandleState& h = handles[a.handle];
+            if (h.lastWriter != npos) add_edge(h.lastWriter, id);
+            if (a.write) {
+                for (size_t r : h.readers)
+                    add_edge(r, id);
+                h.readers.clear();
+                h.lastWriter = id;
+            }
+            else
+                h.readers.push_back(id);
+        }
+
+        return id;
+    }
+
+    /// Number of tasks in the graph
+    size_t size() const noexcept { return tasks.size(); }
+
+    /**
+     * @brief Executes all tasks using at most nthreads threads of pool.
+     *
+     * Blocks until all tasks are done. The first exception thrown by a task
+     * is rethrown after all running tasks finish, and the tasks that did not
+     * start are skipped.
+     */
+    void run(ThreadPool& pool, size_t nthreads)
+    {
+        const size_t ntasks = tasks.size();
+        if (ntasks == 0) return;
+
+        // Priorities. Tasks are inserted in a topological order
+        for (size_t i = ntasks; i-- > 0;) {
+            double longest = 0;
+            for (size_t s : tasks[i].successors)
+                longest = std::max(longest, tasks[s].priority);
+            tasks[i].priority = tasks[i].cost + longest;
+        }
+
+        // Initial ready tasks
+        auto cmp = [this](size_t a, size_t b) {
+            return (tasks[a].priority != tasks[b].priority)
+                       ? tasks[a].priority < tasks[b].priority
+                       : a > b;
+        };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(cmp)> ready(
+            cmp);
+        for (size_t i = 0; i < ntasks; ++i)
+            if (tasks[i].npred == 0) ready.push(i);
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t done = 0;
+        std::exception_ptr error;
+
+        auto worker = [&](size_t) {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                cv.wait(lock, [&]() { return done == ntasks || !ready.empty(); });
+                if (done == ntasks) return;
+
+                const size_t id = ready.top();
+                ready.pop();
+
+                if (!error) {
+                    lock.unlock();
+                    try {
+                        tasks[id].f();
+                    }
+                    catch (...) {
+                        lock.lock();
+                        if (!error) error = std::current_exception();
+                        lock.unlock();
+                    }
+                    lock.lock();
+                }
+
+                ++done;
+                for (size_t s : tasks[id].successors)
+                    if (--tasks[s].npred == 0) ready.push(s);
+                cv.notify_all();
+            }
+        };
+
+        pool.parallel_for(nthreads, nthreads, worker);
+
+        if (error) std::rethrow_exception(error);
+    }
+
+   private:
+    static constexpr size_t npos = size_t(-1);
+
+    struct Task {
+        std::function<void()> f;
+        double cost;
+        double priority;
+        size_t npred;
+        std::vector<size_t> successors;
+    };
+
+    struct HandleState {
+        size_t lastWriter = npos;
+        std::vector<size_t> readers;
+    };
+
+    std::vector<Task> tasks;
+    std::unordered_map<size_t, HandleState> handles;
+
+    void add_edge(size_t from, size_t to)
+    {
+        // A task that accesses the same handle twice does not depend on itself
+        if (from == to) return;
+        auto& succ = tasks[from].successors;
+        if (succ.empty() || succ.back() != to) {
+            succ.push_back(to);
+            ++tasks[to].npred;
+        }
+    }
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BASE_TASKGRAPH_HH
@@ -0,0 +1,244 @@
+/// @file base/ThreadPool.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BASE_THREADPOOL_HH
+#define TLAPACK_BASE_THREADPOOL_HH
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tlapack {
+
+/**
+ * @brief Lightweight work-stealing thread pool.
+ *
+ * Each worker owns a queue of jobs. A worker runs the most recent job of its
+ * own queue and, when the queue is empty, steals the oldest job of the other
+ * queues. Jobs submitted from a worker go to the worker's own queue, so that
+ * nested parallel regions do not need extra threads.
+ *
+ * The pool is used through parallel_for(), which blocks until all tasks are
+ * done. The calling thread takes part in the computation, so a pool with p
+ * workers runs up to p+1 tasks concurrently. A pool with no workers runs all
+ * tasks in the calling thread.
+ */
+class ThreadPool {
+   public:
+    /// Constructs a pool with nworkers threads
+    explicit ThreadPool(size_t nworkers) : nworkers(nworkers)
+    {
+        queues.reserve(nworkers);
+        for (size_t i = 0; i < nworkers; ++i)
+            queues.emplace_back(new Queue);
+        workers.reserve(nworkers);
+        for (size_t i = 0; i < nworkers; ++i)
+            workers.emplace_back([this, i]() { worker_loop(i); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stop = true;
+        }
+        wakeUp.notify_all();
+        for (auto& w : workers)
+            w.join();
+    }
+
+    /// Number of worker threads
+    size_t size() const noexcept { return nworkers; }
+
+    /**
+     * @brief Runs f(0), f(1), ..., f(ntasks-1) using at most nthreads threads.
+     *
+     * Tasks are distributed dynamically, so tasks of different cost are
+     * balanced among the threads. The first exception thrown by a task is
+     * rethrown in the calling thread after all running tasks finish.
+     *
+     * @param[in] ntasks Number of tasks.
+     * @param[in] nthreads Maximum number of threads, including the calling
+     *      thread.
+     * @param[in] f Callable object with signature void(size_t).
+     */
+    template <class F>
+    void parallel_for(size_t ntasks, size_t nthreads, F&& f)
+    {
+        const size_t nt =
+            std::min({size() + 1, ntasks, std::max<size_t>(nthreads, 1)});
+
+        if (nt <= 1) {
+            for (size_t t = 0; t < ntasks; ++t)
+                f(t);
+            return;
+        }
+
+        const size_t nhelpers = nt - 1;
+
+        std::atomic<size_t> next(0);
+        std::atomic<size_t> active(nhelpers);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        auto body = [&]() {
+            try {
+                for (size_t t; (t = next++) < ntasks;)
+                    f(t);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) error = std::current_exception();
+                next = ntasks;
+            }
+        };
+
+        for (size_t h = 0; h < nhelpers; ++h)
+            submit([&]() {
+                body();
+                active.fetch_sub(1, std::memory_order_release);
+            });
+        body();
+
+        // Help with other jobs while the helpers finish
+        while (active.load(std::memory_order_acquire) > 0)
+            if (!try_run_one()) std::this_thread::yield();
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    /**
+     * @brief Pool shared by the routines of <T>LAPACK.
+     *
+     * The number of workers is given by the environment variable
+     * TLAPACK_NUM_THREADS minus one, if it is set, and by the number of
+     * hardware threads minus one otherwise.
+     */
+    static ThreadPool& global()
+    {
+        static ThreadPool pool(default_size());
+        return pool;
+    }
+
+   private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> jobs;
+    };
+
+    const size_t nworkers;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    std::atomic<size_t> pending{0};
+    std::atomic<size_t> nextQueue{0};
+    bool stop = false;
+
+    /// Index of the current thread in this pool, or size() if the thread is
+    /// not a worker of this pool
+    size_t current_index() const noexcept
+    {
+        return (current_pool() == this) ? current_worker() : size();
+    }
+
+    static const ThreadPool*& current_pool() noexcept
+    {
+        static thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& current_worker() noexcept
+    {
+        static thread_local size_t id = 0;
+        return id;
+    }
+
+    static size_t default_size()
+    {
+        if (const char* env = std::getenv("TLAPACK_NUM_THREADS")) {
+            const long n = std::atol(env);
+            if (n > 0) return size_t(n - 1);
+        }
+        const size_t hw = std::thread::hardware_concurrency();
+        return (hw > 1) ? hw - 1 : 0;
+    }
+
+    void submit(std::function<void()> job)
+    {
+        const size_t me = current_index();
+        const size_t q = (me < size()) ? me : (nextQueue++ % size());
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            ++pending;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[q]->mutex);
+            queues[q]->jobs.push_back(std::move(job));
+        }
+        wakeUp.notify_one();
+    }
+
+    /// Runs one job from the own queue or stolen from another queue. Returns
+    /// false if no job was found.
+    bool try_run_one()
+    {
+        const size_t n = size();
+        const size_t me = current_index();
+        std::function<void()> job;
+
+        if (me < n) {
+            std::lock_guard<std::mutex> lock(queues[me]->mutex);
+            if (!queues[me]->jobs.empty()) {
+                job = std::move(queues[me]->jobs.back());
+                queues[me]->jobs.pop_back();
+            }
+        }
+        for (size_t i = 1; i <= n && !job; ++i) {
+            Queue& q = *queues[(me + i) % n];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.jobs.empty()) {
+                job = std::move(q.jobs.front());
+                q.jobs.pop_front();
+            }
+        }
+
+        if (!job) return false;
+        --pending;
+        job();
+        return true;
+    }
+
+    void worker_loop(size_t id)
+    {
+        current_pool() = this;
+        current_worker() = id;
+        while (true) {
+            if (try_run_one()) continue;
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]() { return stop || pending > 0; });
+            if (stop && pending == 0) return;
+        }
+    }
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BASE_THREADPOOL_HH
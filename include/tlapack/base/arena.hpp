@@ -0,0 +1,364 @@
+/// @file base/arena.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BASE_ARENA_HH
+#define TLAPACK_BASE_ARENA_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace tlapack {
+
+/**
+ * @brief Bump allocator that keeps its memory between uses.
+ *
+ * Memory is taken from a list of chunks. Allocations are aligned to
+ * Arena::alignment. The most recent allocation can be given back with
+ * deallocate(), so that temporaries created and destroyed in a stack-like
+ * order reuse the same memory. All allocations made after a call to mark() are
+ * released at once by release(). The chunks are only freed when the arena is
+ * destroyed; when the arena becomes empty, they are merged into a single chunk
+ * so that the next uses fit without new allocations.
+ *
+ * Each thread has its own arena, see thread_arena(). Use ArenaScope to
+ * activate it.
+ */
+class Arena {
+   public:
+    /// Alignment of all allocations
+    static constexpr size_t alignment = alignof(std::max_align_t);
+
+    /// Size of the first chunk
+    static constexpr size_t min_chunk_size = size_t(1) << 16;
+
+    /// Position in the arena returned by mark()
+    struct Mark {
+        size_t chunk = 0;
+        size_t offset = 0;
+    };
+
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena()
+    {
+        for (auto& c : chunks)
+            ::operator delete(c.data);
+    }
+
+    /// Returns nbytes bytes of memory aligned to Arena::alignment
+    void* allocate(size_t nbytes)
+    {
+        nbytes = round_up(nbytes);
+
+        // Look for space in the current chunk and in the free chunks after it
+        while (current < chunks.size() &&
+               offset + nbytes > chunks[current].size) {
+            if (current + 1 == chunks.size()) break;
+            ++current;
+            offset = 0;
+        }
+        if (current >= chunks.size() || offset + nbytes > chunks[current].size)
+        {
+            const size_t last = chunks.empty() ? 0 : chunks.back().size;
+            const size_t size = std::max({nbytes, 2 * last, min_chunk_size});
+            chunks.push_back({static_cast<char*>(::operator new(size)), size});
+            current = chunks.size() - 1;
+            offset = 0;
+        }
+
+        void* p = chunks[current].data + offset;
+        offset += nbytes;
+        return p;
+    }
+
+    /// Gives back p if it is the most recent allocation. Does nothing
+    /// otherwise
+    void deallocate(void* p, size_t nbytes) noexcept
+    {
+        nbytes = round_up(nbytes);
+        if (current < chunks.size() && nbytes <= offset &&
+            static_cast<char*>(p) == chunks[current].data + offset - nbytes)
+            offset -= nbytes;
+    }
+
+    /// Current position in the arena
+    Mark mark() const noexcept { return {current, offset}; }
+
+    /**
+     * @brief Releases all memory allocated after the position m.
+     *
+     * If the arena becomes empty and has more than one chunk, the chunks are
+     * merged into a single one.
+     */
+    void release(const Mark& m) noexcept
+    {
+        current = m.chunk;
+        offset = m.offset;
+        if (current == 0 && offset == 0 && chunks.size() > 1) {
+            size_t size = 0;
+            for (auto& c : chunks) {
+                size += c.size;
+                ::operator delete(c.data);
+            }
+            chunks.clear();
+            try {
+                chunks.push_back(
+                    {static_cast<char*>(::operator new(size)), size});
+            }
+            catch (...) {
+                // Keep the arena empty. The next allocation will retry
+            }
+        }
+    }
+
+    /// Makes sure that the arena holds at least nbytes bytes in a single chunk
+    void reserve(size_t nbytes)
+    {
+        if (used() == 0 && (chunks.empty() || chunks.back().size < nbytes)) {
+            const Mark m = mark();
+            allocate(nbytes);
+            release(m);
+        }
+    }
+
+    /// Total size of the chunks, in bytes
+    size_t capacity() const noexcept
+    {
+        size_t size = 0;
+        for (auto& c : chunks)
+            size += c.size;
+        return size;
+    }
+
+    /// Number of bytes in use, including those skipped at the end of chunks
+    size_t used() const noexcept
+    {
+        size_t size = offset;
+        for (size_t i = 0; i < current && i < chunks.size(); ++i)
+            size += chunks[i].size;
+        return size;
+    }
+
+    /// True if the allocations of ArenaAllocator go to this arena
+    bool active() const noexcept { return depth > 0; }
+
+   private:
+    struct Chunk {
+        char* data;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks;
+    size_t current = 0;  ///< Index of the chunk in use
+    size_t offset = 0;   ///< Number of bytes in use in the current chunk
+    int depth = 0;       ///< Number of active ArenaScope objects
+
+    static constexpr size_t round_up(size_t nbytes) noexcept
+    {
+        return ((nbytes + alignment - 1) / alignment) * alignment;
+    }
+
+    friend class ArenaScope;
+};
+
+/// Arena of the calling thread
+inline Arena& thread_arena()
+{
+    thread_local Arena arena;
+    return arena;
+}
+
+/**
+ * @brief Activates the arena of the calling thread.
+ *
+ * While an ArenaScope is alive, the workspaces that <T>LAPACK routines create
+ * internally are taken from thread_arena() instead of the heap. All of them
+ * are released when the scope ends. Since the arena keeps its memory, calling
+ * the same routines again in a new scope does not allocate.
+ *
+ * Usage:
+ * @code{.cpp}
+ * for (auto& A : problems) {
+ *     tlapack::ArenaScope scope;
+ *     tlapack::gesvd(false, false, A, s, U, Vt);
+ * }
+ * @endcode
+ *
+ * @note Memory taken from the arena must not be used after the scope ends.
+ * Scopes may be nested.
+ */
+class ArenaScope {
+   public:
+    /// Activates the arena and reserves nbytes bytes in it
+    explicit ArenaScope(size_t nbytes = 0)
+        : arena(thread_arena()), start(arena.mark())
+    {
+        arena.reserve(nbytes);
+        ++arena.depth;
+    }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    ~ArenaScope()
+    {
+        --arena.depth;
+        arena.release(start);
+    }
+
+   private:
+    Arena& arena;
+    const Arena::Mark start;
+};
+
+/**
+ * @brief Allocator that takes memory from thread_arena() if it is active,
+ * and from the heap otherwise.
+ *
+ * Each allocation is preceded by a header that records where the memory comes
+ * from, so that memory can be deallocated from any thread.
+ *
+ * @tparam T Type of the elements.
+ */
+template <class T>
+struct ArenaAllocator {
+    static_assert(alignof(T) <= Arena::alignment,
+                  "ArenaAllocator does not support over-aligned types");
+
+    using value_type = T;
+
+    constexpr ArenaAllocator() noexcept = default;
+
+    template <class U>
+    constexpr ArenaAllocator(const ArenaAllocator<U>&) noexcept
+    {}
+
+    T* allocate(size_t n)
+    {
+        if (n > (size_t(-1) - header) / sizeof(T)) throw std::bad_alloc();
+        const size_t nbytes = header + n * sizeof(T);
+
+        Arena& arena = thread_arena();
+        char* p;
+        if (arena.active()) {
+            p = static_cast<char*>(arena.allocate(nbytes));
+            *p = fromArena;
+        }
+        else {
+            p = static_cast<char*>(::operator new(nbytes));
+            *p = fromHeap;
+        }
+        return reinterpret_cast<T*>(p + header);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+        char* p = reinterpret_cast<char*>(ptr) - header;
+        if (*p == fromHeap)
+            ::operator delete(p);
+        else
+            thread_arena().deallocate(p, header + n * sizeof(T));
+    }
+
+    template <class U>
+    constexpr bool operator==(const ArenaAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template <class U>
+    constexpr bool operator!=(const ArenaAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+
+   private:
+    static constexpr size_t header = Arena::alignment;
+    static constexpr char fromHeap = 0;
+    static constexpr char fromArena = 1;
+};
+
+/**
+ * @brief Allocator that aligns its allocations to a given number of bytes.
+ *
+ * Used for buffers that are kept across calls, e.g., the workspace of a Plan,
+ * so that they start at a cache line.
+ *
+ * @tparam T Type of the elements.
+ * @tparam alignment Alignment in bytes. Must be a power of two.
+ */
+template <class T, size_t alignment = 64>
+struct AlignedAllocator {
+    static_assert((alignment & (alignment - 1)) == 0,
+                  "The alignment must be a power of two");
+
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = AlignedAllocator<U, alignment>;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template <class U>
+    constexpr AlignedAllocator(const AlignedAllocator<U, alignment>&) noexcept
+    {}
+
+    T* allocate(size_t n)
+    {
+        if (n > size_t(-1) / sizeof(T)) throw std::bad_alloc();
+        return static_cast<T*>(
+            ::operator new(n * sizeof(T), std::align_val_t(alignment)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+
+    template <class U>
+    constexpr bool operator==(
+        const AlignedAllocator<U, alignment>&) const noexcept
+    {
+        return true;
+    }
+
+    template <class U>
+    constexpr bool operator!=(
+        const AlignedAllocator<U, alignment>&) const noexcept
+    {
+        return false;
+    }
+};
+
+/**
+ * @brief Vector that draws its memory from the arena of the calling thread.
+ *
+ * The routines of <T>LAPACK use this type for the containers of the matrices
+ * and vectors that they create with tlapack::Create. Outside an ArenaScope it
+ * behaves like std::vector<T>.
+ *
+ * The member @c heap holds the data instead when the Create functor of the
+ * matrix type only accepts std::vector<T>.
+ */
+template <class T>
+struct arena_vector : public std::vector<T, ArenaAllocator<T>> {
+    using std::vector<T, ArenaAllocator<T>>::vector;
+
+    std::vector<T> heap;  ///< Fallback storage on the heap
+};
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BASE_ARENA_HH
@@ -10,6 +10,7 @@
 #ifndef TLAPACK_ARRAY_TRAITS_HH
 #define TLAPACK_ARRAY_TRAITS_HH
 
+#include "tlapack/base/arena.hpp"
 #include "tlapack/base/types.hpp"
 
 namespace tlapack {
@@ -76,6 +77,23 @@ namespace traits {
         static constexpr Layout value = Layout::Unspecified;
     };
 
+    /**
+     * @brief Trait to determine the sizes of a matrix known at compile time.
+     *
+     * The sizes are defined on @c static_size_trait<matrix_t,int>::nrows and
+     * @c static_size_trait<matrix_t,int>::ncols. A size that is only known at
+     * runtime is -1. Use the tlapack::static_nrows and tlapack::static_ncols
+     * aliases instead.
+     *
+     * @tparam matrix_t Data structure.
+     * @tparam class If this is not an int, then the trait is not defined.
+     */
+    template <class matrix_t, class = int>
+    struct static_size_trait {
+        static constexpr int nrows = -1;
+        static constexpr int ncols = -1;
+    };
+
     /**
      * @brief Functor for data creation
      *
@@ -101,8 +119,10 @@ namespace traits {
          *
          * @return The new m-by-n matrix
          */
-        template <class T, class idx_t>
-        constexpr auto operator()(std::vector<T>& v, idx_t m, idx_t n = 1) const
+        template <class T, class Allocator, class idx_t>
+        constexpr auto operator()(std::vector<T, Allocator>& v,
+                                  idx_t m,
+                                  idx_t n = 1) const
         {
             return matrix_t();
         }
@@ -117,8 +137,8 @@ namespace traits {
          *
          * @return The new vector of size n
          */
-        template <class T, class idx_t>
-        constexpr auto operator()(std::vector<T>& v, idx_t n) const
+        template <class T, class Allocator, class idx_t>
+        constexpr auto operator()(std::vector<T, Allocator>& v, idx_t n) const
         {
             return matrix_t();
         }
@@ -231,8 +251,21 @@ using size_type = typename traits::size_type_trait<T, int>::type;
 template <class array_t>
 constexpr Layout layout = traits::layout_trait<array_t, int>::value;
 
+/// Number of rows of a matrix known at compile time, or -1.
+template <class matrix_t>
+constexpr int static_nrows = traits::static_size_trait<matrix_t, int>::nrows;
+
+/// Number of columns of a matrix known at compile time, or -1.
+template <class matrix_t>
+constexpr int static_ncols = traits::static_size_trait<matrix_t, int>::ncols;
+
 /**
- * @brief Alias for @c traits::CreateFunctor<,int>.
+ * @brief Functor for data creation. Extends @c traits::CreateFunctor<,int>.
+ *
+ * If @c traits::CreateFunctor<matrix_t,int> does not accept an arena_vector,
+ * the data is created on the member arena_vector::heap, which is a
+ * std::vector<T>. This way, the routines of <T>LAPACK can use arena_vector
+ * for any matrix type that satisfies tlapack::concepts::ConstructableArray.
  *
  * Usage:
  * @code{.cpp}
@@ -247,8 +280,23 @@ constexpr Layout layout = traits::layout_trait<array_t, int>::value;
  * auto A = new_matrix(A_container, m, n); // Initialize A_container if needed
  * @endcode
  */
-template <class T>
-using Create = traits::CreateFunctor<T, int>;
+template <class matrix_t>
+struct Create : public traits::CreateFunctor<matrix_t, int> {
+    using traits::CreateFunctor<matrix_t, int>::operator();
+
+    template <class T,
+              class... dims_t,
+              enable_if_t<!std::is_invocable_v<
+                              const traits::CreateFunctor<matrix_t, int>&,
+                              arena_vector<T>&,
+                              dims_t...>,
+                          int> = 0>
+    constexpr auto operator()(arena_vector<T>& v, dims_t... dims) const
+    {
+        return traits::CreateFunctor<matrix_t, int>::operator()(v.heap,
+                                                                dims...);
+    }
+};
 
 /**
  * @brief Alias for @c traits::CreateStaticFunctor<,int>.
@@ -0,0 +1,318 @@
+/// @file batch.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Options and helpers of the batched routines
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BATCH_HH
+#define TLAPACK_BATCH_HH
+
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include "tlapack/StridedBatch.hpp"
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for the batched routines, e.g., gemm_batched() and
+ * getrf_batched().
+ *
+ * A batch is either a StridedBatch or a container of matrices (or vectors)
+ * with operator[], e.g., `std::vector<LegacyMatrix<T>>`. All matrices in a
+ * batch have the same sizes. The arguments are checked once per call.
+ *
+ * The matrices are processed in groups of nb, with the loops over the
+ * matrices of a group innermost so that they run in SIMD lanes. If all
+ * batches of a call are interleaved, i.e., StridedBatch::bstride = 1, the
+ * groups are processed in place. Otherwise, each group is copied to an
+ * interleaved workspace, which is allocated once per thread. The groups are
+ * distributed among the threads of a ThreadPool.
+ */
+struct BatchOpts {
+    size_t nb = 16;              ///< Number of matrices processed together
+    size_t num_threads = 0;      ///< Number of threads. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
+};
+
+namespace internal {
+
+    template <class T>
+    constexpr bool is_strided_batch = false;
+    template <class T, class idx_t>
+    constexpr bool is_strided_batch<StridedBatch<T, idx_t>> = true;
+
+    /// View of a container of matrices or vectors as a batch
+    template <class container_t>
+    struct ArrayBatch {
+        container_t* X;
+
+        decltype(auto) operator()(size_t b, size_t i, size_t j) const
+        {
+            using elem_t = std::decay_t<decltype((*X)[b])>;
+            if constexpr (traits::internal::is_matrix<elem_t>)
+                return (*X)[b](i, j);
+            else
+                return (*X)[b][i];
+        }
+    };
+
+    /// Interleaved batch, i.e., StridedBatch with bstride = 1
+    template <class T>
+    struct InterleavedBatch {
+        T* ptr;
+        size_t rstride, cstride;
+
+        constexpr T& operator()(size_t b, size_t i, size_t j) const noexcept
+        {
+            return ptr[b + i * rstride + j * cstride];
+        }
+    };
+
+    template <class T, class idx_t>
+    constexpr StridedBatch<T, idx_t> batch_view(StridedBatch<T, idx_t>& X)
+    {
+        return X;
+    }
+    template <class T, class idx_t>
+    constexpr StridedBatch<const T, idx_t> batch_view(
+        const StridedBatch<T, idx_t>& X)
+    {
+        return StridedBatch<const T, idx_t>(X.m, X.n, X.count, X.ptr,
+                                            X.bstride, X.rstride, X.cstride);
+    }
+    template <class container_t,
+              enable_if_t<!is_strided_batch<std::remove_const_t<container_t>>,
+                          int> = 0>
+    constexpr ArrayBatch<container_t> batch_view(container_t& X)
+    {
+        return ArrayBatch<container_t>{&X};
+    }
+
+    template <class T, class idx_t>
+    constexpr size_t batch_count(const StridedBatch<T, idx_t>& X)
+    {
+        return X.count;
+    }
+    template <class container_t>
+    constexpr size_t batch_count(const ArrayBatch<container_t>& X)
+    {
+        return std::size(*X.X);
+    }
+
+    /// Number of rows of the matrices, or size of the vectors, of X. X must
+    /// not be empty
+    template <class T, class idx_t>
+    constexpr size_t batch_nrows(const StridedBatch<T, idx_t>& X)
+    {
+        return X.m;
+    }
+    template <class container_t>
+    constexpr size_t batch_nrows(const ArrayBatch<container_t>& X)
+    {
+        const auto& A = (*X.X)[0];
+        if constexpr (traits::internal::is_matrix<std::decay_t<decltype(A)>>)
+            return nrows(A);
+        else
+            return size(A);
+    }
+
+    /// Number of columns of the matrices of X, or 1 for vectors. X must not
+    /// be empty
+    template <class T, class idx_t>
+    constexpr size_t batch_ncols(const StridedBatch<T, idx_t>& X)
+    {
+        return X.n;
+    }
+    template <class container_t>
+    constexpr size_t batch_ncols(const ArrayBatch<container_t>& X)
+    {
+        const auto& A = (*X.X)[0];
+        if constexpr (traits::internal::is_matrix<std::decay_t<decltype(A)>>)
+            return ncols(A);
+        else
+            return 1;
+    }
+
+    /// True if every matrix of X is m-by-n
+    template <class T, class idx_t>
+    bool batch_is(const StridedBatch<T, idx_t>& X, size_t m, size_t n)
+    {
+        return (size_t)X.m == m && (size_t)X.n == n;
+    }
+    template <class container_t>
+    bool batch_is(const ArrayBatch<container_t>& X, size_t m, size_t n)
+    {
+        for (const auto& A : *X.X)
+            if ((size_t)nrows(A) != m || (size_t)ncols(A) != n) return false;
+        return true;
+    }
+
+    /// True if the vectors of X have the same size, of at least n
+    template <class T, class idx_t>
+    bool batch_fits(const StridedBatch<T, idx_t>& X, size_t n)
+    {
+        return (size_t)X.m >= n && X.n == 1;
+    }
+    template <class container_t>
+    bool batch_fits(const ArrayBatch<container_t>& X, size_t n)
+    {
+        if (batch_count(X) == 0) return true;
+        const size_t m = batch_nrows(X);
+        for (const auto& v : *X.X)
+            if ((size_t)size(v) != m) return false;
+        return m >= n;
+    }
+
+    /// True if X is an interleaved batch
+    template <class T, class idx_t>
+    constexpr bool is_interleaved(const StridedBatch<T, idx_t>& X)
+    {
+        return X.bstride == 1;
+    }
+    template <class container_t>
+    constexpr bool is_interleaved(const ArrayBatch<container_t>&)
+    {
+        return false;
+    }
+
+    /// View of an interleaved StridedBatch
+    template <class T, class idx_t>
+    constexpr InterleavedBatch<T> interleaved_view(
+        const StridedBatch<T, idx_t>& X)
+    {
+        return InterleavedBatch<T>{X.ptr, (size_t)X.rstride,
+                                   (size_t)X.cstride};
+    }
+
+    /// Interleaved copy of groups of matrices of a batch
+    template <class batch_t>
+    struct BatchBuffer {
+        using ref_t = decltype(std::declval<batch_t>()(0, 0, 0));
+        using T = std::remove_cv_t<std::remove_reference_t<ref_t>>;
+
+        /// The matrices of X are not copied back if they are const
+        static constexpr bool writable =
+            !std::is_const_v<std::remove_reference_t<ref_t>>;
+
+        const batch_t& X;
+        size_t m, n, nb;
+        std::vector<T> data;
+
+        BatchBuffer(const batch_t& X, size_t nb)
+            : X(X),
+              m(batch_nrows(X)),
+              n(batch_ncols(X)),
+              nb(nb),
+              data(m * n * nb)
+        {}
+
+        InterleavedBatch<T> view() { return {data.data(), nb, nb * m}; }
+
+        /// Copies the matrices b0:b1 of X to the buffer
+        void pack(size_t b0, size_t b1)
+        {
+            T* p = data.data();
+            for (size_t j = 0; j < n; ++j)
+                for (size_t i = 0; i < m; ++i, p += nb)
+                    for (size_t b = b0; b < b1; ++b)
+                        p[b - b0] = X(b, i, j);
+        }
+
+        /// Copies the buffer back to the matrices b0:b1 of X
+        void unpack(size_t b0, size_t b1)
+        {
+            if constexpr (writable) {
+                const T* p = data.data();
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < m; ++i, p += nb)
+                        for (size_t b = b0; b < b1; ++b)
+                            X(b, i, j) = p[b - b0];
+            }
+        }
+    };
+
+    /**
+     * @brief Calls f(b0, b1, first, X...) on groups of opts.nb matrices that
+     * cover the batch.
+     *
+     * The batches are passed to f as InterleavedBatch objects, in which the
+     * matrices b0:b1 are the matrices first:first+b1-b0 of X. They are either
+     * views of X, if all batches X are interleaved, or views of copies of the
+     * matrices of the group, in which case b0 = 0. The groups are distributed
+     * among the threads.
+     */
+    template <class F, class... batch_t>
+    void batch_for_each(size_t count,
+                        const BatchOpts& opts,
+                        F&& f,
+                        const batch_t&... X)
+    {
+        // Quick return
+        if (count == 0) return;
+
+        ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+        const size_t nthreads =
+            (opts.num_threads == 0) ? pool.size() + 1 : opts.num_threads;
+        const size_t nb = max<size_t>(opts.nb, 1);
+        const size_t ngroups = (count + nb - 1) / nb;
+        const size_t ntasks = min(ngroups, nthreads);
+        const bool interleaved = (is_interleaved(X) && ...);
+
+        pool.parallel_for(ntasks, nthreads, [&](size_t t) {
+            const size_t g0 = ngroups * t / ntasks;
+            const size_t g1 = ngroups * (t + 1) / ntasks;
+
+            if constexpr ((is_strided_batch<batch_t> && ...)) {
+                if (interleaved) {
+                    for (size_t g = g0; g < g1; ++g)
+                        f(g * nb, min(count, (g + 1) * nb), g * nb,
+                          interleaved_view(X)...);
+                    return;
+                }
+            }
+
+            // Workspace of this thread
+            std::tuple<BatchBuffer<batch_t>...> buffers(
+                BatchBuffer<batch_t>(X, nb)...);
+
+            std::apply(
+                [&](auto&... buf) {
+                    for (size_t g = g0; g < g1; ++g) {
+                        const size_t b0 = g * nb;
+                        const size_t b1 = min(count, (g + 1) * nb);
+                        (buf.pack(b0, b1), ...);
+                        f(0, b1 - b0, b0, buf.view()...);
+                        (buf.unpack(b0, b1), ...);
+                    }
+                },
+                buffers);
+        });
+    }
+
+    /// Entry (i,j) of op(A), where A is the b-th matrix of a batch
+    template <Op op, class batch_t>
+    constexpr auto op_entry(const batch_t& A, size_t b, size_t i, size_t j)
+    {
+        if constexpr (op == Op::NoTrans)
+            return A(b, i, j);
+        else if constexpr (op == Op::Trans)
+            return A(b, j, i);
+        else
+            return conj(A(b, j, i));
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BATCH_HH
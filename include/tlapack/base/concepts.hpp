@@ -749,6 +749,11 @@ namespace concepts {
      * tlapack::type_t<array_t> and idx_t = tlapack::size_type<array_t>. The
      * output of the functor satisfies the concept tlapack::concepts::Vector.
      *
+     * - Optionally, the two methods above may also accept
+     * tlapack::arena_vector<T>, e.g., by taking a std::vector<T, Allocator>
+     * with any Allocator. Only then the workspaces of the routines of
+     * <T>LAPACK come from the arena. See tlapack::Create.
+     *
      * - @c tlapack::traits::CreateStaticFunctor<tlapack::matrix_type<array_t>,
      * m, n, int> must provide the method @c operator()(T*), where T =
      * tlapack::type_t<array_t>. The output of the functor satisfies the concept
@@ -0,0 +1,61 @@
+/// @file base/simd.hpp Detection of the instruction sets used by the
+/// vectorized kernels.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BASE_SIMD_HH
+#define TLAPACK_BASE_SIMD_HH
+
+#ifndef TLAPACK_NO_SIMD_KERNELS
+    #if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+        #define TLAPACK_SIMD_X86 1
+        #include <immintrin.h>
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define TLAPACK_SIMD_NEON 1
+        #include <arm_neon.h>
+    #endif
+#endif
+
+namespace tlapack {
+
+/// @brief Instruction sets used by the vectorized kernels.
+enum class SimdIsa : char {
+    Generic = 'G',  ///< Portable C++ loops
+    AVX2 = '2',     ///< x86 AVX2 with FMA
+    AVX512 = '5',   ///< x86 AVX-512F
+    NEON = 'N'      ///< ARMv8 Advanced SIMD
+};
+
+/**
+ * @brief Instruction set used by the vectorized kernels on this machine.
+ *
+ * The CPU features are detected once, at the first call. Define
+ * TLAPACK_NO_SIMD_KERNELS to always use the portable kernels.
+ *
+ * @ingroup auxiliary
+ */
+inline SimdIsa simd_isa() noexcept
+{
+    static const SimdIsa isa = []() {
+#if defined(TLAPACK_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdIsa::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return SimdIsa::AVX2;
+#elif defined(TLAPACK_SIMD_NEON)
+        return SimdIsa::NEON;
+#endif
+        return SimdIsa::Generic;
+    }();
+    return isa;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BASE_SIMD_HH
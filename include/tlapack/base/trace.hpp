@@ -0,0 +1,367 @@
+/// @file base/trace.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Tracing of the calls to <T>LAPACK routines
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BASE_TRACE_HH
+#define TLAPACK_BASE_TRACE_HH
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "tlapack/base/scalar_type_traits.hpp"
+
+namespace tlapack {
+
+/// Call to a <T>LAPACK routine recorded by Trace
+struct TraceEvent {
+    const char* name;  ///< Name of the routine
+    size_t thread;     ///< Index of the calling thread, in order of first call
+    int depth;         ///< Number of enclosing events in the same thread
+    long parent;       ///< Index of the enclosing event, or -1
+    double start;      ///< Entry time, in seconds since the trace started
+    double duration;   ///< Time spent in the routine, in seconds. Negative
+                       ///< while the routine has not returned
+    double flops;      ///< Estimated number of floating-point operations
+    double bytes;      ///< Estimated number of bytes read and written
+};
+
+/// Totals of the events of a routine, see Trace::summary()
+struct TraceSummary {
+    size_t calls = 0;        ///< Number of calls
+    double time = 0;         ///< Total time, in seconds
+    double self_time = 0;    ///< Time not spent in nested events, in seconds
+    double flops = 0;        ///< Total estimated floating-point operations
+    double bytes = 0;        ///< Total estimated bytes read and written
+};
+
+/**
+ * @brief Records the calls to <T>LAPACK routines as a call tree.
+ *
+ * Tracing is compiled in only if the macro TLAPACK_TRACE is defined, e.g.,
+ * with the CMake option TLAPACK_TRACE=ON. Otherwise, the calls to
+ * tlapack_trace() in the routines expand to nothing and no event is ever
+ * recorded.
+ *
+ * When compiled in, events are recorded between start() and stop(). Each
+ * event holds the entry time and the duration of the call, and estimates of
+ * the number of floating-point operations and of the bytes touched. Calls
+ * made inside another call of the same thread are nested in it through
+ * TraceEvent::parent.
+ *
+ * Usage:
+ * @code{.cpp}
+ * tlapack::Trace& trace = tlapack::Trace::global();
+ * trace.start();
+ * tlapack::gesvd(true, true, A, s, U, Vt);
+ * trace.stop();
+ *
+ * for (const auto& [name, s] : trace.summary())
+ *     std::cout << name << ": " << s.self_time << " s\n";
+ *
+ * std::ofstream f("gesvd.json");
+ * trace.write_chrome_trace(f);  // Open in chrome://tracing or Perfetto
+ * @endcode
+ *
+ * Callbacks set by set_callbacks() are called at the entry and exit of each
+ * event, e.g., to forward the events to a profiler or to production
+ * telemetry.
+ */
+class Trace {
+   public:
+    using callback_t = std::function<void(const TraceEvent&)>;
+
+    /// Trace used by all routines
+    static Trace& global()
+    {
+        static Trace trace;
+        return trace;
+    }
+
+    /// Starts recording events. The time origin is set if there are no
+    /// events
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (ev.empty()) origin = clock::now();
+        recording.store(true, std::memory_order_relaxed);
+    }
+
+    /// Stops recording events. Calls that have not returned are still closed
+    void stop() { recording.store(false, std::memory_order_relaxed); }
+
+    /// True if events are being recorded
+    bool active() const noexcept
+    {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    /// Removes all events
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        ev.clear();
+        ++generation;
+        origin = clock::now();
+    }
+
+    /// Copy of the recorded events, in order of entry
+    std::vector<TraceEvent> events() const
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        return ev;
+    }
+
+    /**
+     * @brief Totals per routine of the events that have returned.
+     *
+     * Calls nested in a call to the same routine, e.g., in recursive
+     * algorithms, are accounted for in the outermost call only.
+     */
+    std::map<std::string, TraceSummary> summary() const
+    {
+        const std::vector<TraceEvent> e = events();
+
+        std::vector<double> child_time(e.size(), 0);
+        for (size_t i = 0; i < e.size(); ++i)
+            if (e[i].parent >= 0 && e[i].duration >= 0)
+                child_time[e[i].parent] += e[i].duration;
+
+        std::map<std::string, TraceSummary> s;
+        for (size_t i = 0; i < e.size(); ++i) {
+            if (e[i].duration < 0) continue;
+            TraceSummary& si = s[e[i].name];
+            si.calls++;
+            si.self_time += e[i].duration - child_time[i];
+
+            bool recursive = false;
+            for (long p = e[i].parent; p >= 0 && !recursive; p = e[p].parent)
+                recursive = (std::string(e[p].name) == e[i].name);
+            if (!recursive) {
+                si.time += e[i].duration;
+                si.flops += e[i].flops;
+                si.bytes += e[i].bytes;
+            }
+        }
+        return s;
+    }
+
+    /// Writes the events that have returned in the Chrome trace event format
+    void write_chrome_trace(std::ostream& out) const
+    {
+        const std::vector<TraceEvent> e = events();
+
+        out << "{\"traceEvents\": [";
+        bool first = true;
+        for (const TraceEvent& x : e) {
+            if (x.duration < 0) continue;
+            out << (first ? "\n" : ",\n") << "  {\"name\": \"" << x.name
+                << "\", \"cat\": \"tlapack\", \"ph\": \"X\", \"pid\": 0"
+                << ", \"tid\": " << x.thread << ", \"ts\": " << x.start * 1e6
+                << ", \"dur\": " << x.duration * 1e6
+                << ", \"args\": {\"flops\": " << x.flops
+                << ", \"bytes\": " << x.bytes << "}}";
+            first = false;
+        }
+        out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+    }
+
+    /// Sets the functions called at the entry and at the exit of each
+    /// event. Empty functions are not called
+    void set_callbacks(callback_t on_enter, callback_t on_exit)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        enter_cb = std::move(on_enter);
+        exit_cb = std::move(on_exit);
+    }
+
+    /// Records the entry in a routine. Returns the index of the event, or -1
+    /// if the trace is not active. Use TraceScope instead
+    long enter(const char* name, double flops, double bytes)
+    {
+        ThreadState& ts = thread_state();
+        TraceEvent x;
+        callback_t cb;
+        long id;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!active()) return -1;
+            if (ts.generation != generation) {
+                ts.stack.clear();
+                ts.generation = generation;
+            }
+            if (ts.index == size_t(-1)) ts.index = nthreads++;
+
+            id = (long)ev.size();
+            x = {name,
+                 ts.index,
+                 (int)ts.stack.size(),
+                 ts.stack.empty() ? -1 : ts.stack.back(),
+                 seconds(clock::now()),
+                 -1,
+                 flops,
+                 bytes};
+            ev.push_back(x);
+            ts.stack.push_back(id);
+            cb = enter_cb;
+        }
+        if (cb) cb(x);
+        return id;
+    }
+
+    /// Records the exit of the event id returned by enter()
+    void exit(long id)
+    {
+        const clock::time_point t = clock::now();
+        ThreadState& ts = thread_state();
+        TraceEvent x;
+        callback_t cb;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (ts.generation != generation) return;
+            if (!ts.stack.empty() && ts.stack.back() == id) ts.stack.pop_back();
+            if (id < 0 || id >= (long)ev.size()) return;
+
+            ev[id].duration = seconds(t) - ev[id].start;
+            x = ev[id];
+            cb = exit_cb;
+        }
+        if (cb) cb(x);
+    }
+
+   private:
+    using clock = std::chrono::steady_clock;
+
+    /// Position of a thread in the call tree
+    struct ThreadState {
+        size_t index = size_t(-1);  ///< Index of the thread
+        size_t generation = 0;      ///< Value of Trace::generation
+        std::vector<long> stack;    ///< Events that have not returned
+    };
+
+    static ThreadState& thread_state()
+    {
+        thread_local ThreadState ts;
+        return ts;
+    }
+
+    double seconds(clock::time_point t) const
+    {
+        return std::chrono::duration<double>(t - origin).count();
+    }
+
+    mutable std::mutex mtx;
+    std::atomic<bool> recording{false};
+    std::vector<TraceEvent> ev;
+    clock::time_point origin = clock::now();
+    size_t generation = 1;  ///< Incremented by clear()
+    size_t nthreads = 0;
+    callback_t enter_cb, exit_cb;
+};
+
+/// Records an event of Trace::global() during its lifetime
+class TraceScope {
+   public:
+    TraceScope(const char* name, double flops = 0, double bytes = 0)
+        : id(Trace::global().active()
+                 ? Trace::global().enter(name, flops, bytes)
+                 : -1)
+    {}
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope()
+    {
+        if (id >= 0) Trace::global().exit(id);
+    }
+
+   private:
+    const long id;
+};
+
+namespace internal {
+
+    /// Number of floating-point operations of an operation that takes f
+    /// operations in real arithmetic. A complex operation counts as 4
+    template <class T>
+    constexpr double trace_flops(double f) noexcept
+    {
+        return is_complex<T> ? 4 * f : f;
+    }
+
+    // Operation counts in real arithmetic, from LAPACK Working Note 41
+
+    /// LU factorization of an m-by-n matrix
+    constexpr double flops_getrf(double m, double n) noexcept
+    {
+        const double k = (m < n) ? m : n;
+        return m * n * k - (m + n) * k * k / 2 + k * k * k / 3;
+    }
+
+    /// QR factorization of an m-by-n matrix
+    constexpr double flops_geqrf(double m, double n) noexcept
+    {
+        const double k = (m < n) ? m : n;
+        return 2 * m * n * k - (m + n) * k * k + 2 * k * k * k / 3;
+    }
+
+    /// Generation of an m-by-n matrix Q from k reflectors
+    constexpr double flops_ungq(double m, double n, double k) noexcept
+    {
+        return 4 * m * n * k - 2 * (m + n) * k * k + 4 * k * k * k / 3;
+    }
+
+    /// Multiplication of a matrix C by Q from k reflectors of order q. p is
+    /// the other dimension of C
+    constexpr double flops_unmq(double q, double p, double k) noexcept
+    {
+        return 4 * q * p * k - 2 * p * k * k;
+    }
+
+    /// Reduction of an m-by-n matrix to bidiagonal form
+    constexpr double flops_gebrd(double m, double n) noexcept
+    {
+        const double k = (m < n) ? m : n;
+        const double l = (m < n) ? n : m;
+        return 4 * l * k * k - 4 * k * k * k / 3;
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#ifdef TLAPACK_TRACE
+
+    /**
+     * @brief Records the call to the enclosing routine in
+     * tlapack::Trace::global(), until the end of the scope.
+     *
+     * @param name Name of the routine.
+     * @param flops Estimated number of floating-point operations.
+     * @param bytes Estimated number of bytes read and written.
+     *
+     * @note Expands to nothing unless TLAPACK_TRACE is defined. The arguments
+     * are not evaluated in that case.
+     */
+    #define tlapack_trace(name, flops, bytes) \
+        tlapack::TraceScope tlapack_trace_scope_((name), (flops), (bytes))
+
+#else
+
+    #define tlapack_trace(name, flops, bytes) ((void)0)
+
+#endif
+
+#endif  // TLAPACK_BASE_TRACE_HH
@@ -0,0 +1,184 @@
+/// @file tuning.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Tuning profiles for the default values of the options structs
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TUNING_HH
+#define TLAPACK_TUNING_HH
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace tlapack {
+
+/**
+ * @brief Set of tuning parameters, such as block sizes.
+ *
+ * Each parameter has a name and one or more values. A value applies to the
+ * problems of size n or larger, up to the next value. In text form, a profile
+ * has one value per line:
+ *
+ *      # Comment
+ *      gehrd.nb 48
+ *      multishift_qr.nshifts@3000 96
+ *
+ * where `name value` is the same as `name@0 value`.
+ *
+ * The options structs take their default values from the profile
+ * TuningProfile::global() through tuned(). Parameters that are not in the
+ * profile keep the default values of <T>LAPACK. The global profile is read on
+ * first use from the file given by the environment variable
+ * TLAPACK_TUNING_PROFILE, if set. It is meant to be generated by the tool
+ * tlapack_autotune.
+ *
+ * The global profile must not be modified while other threads construct
+ * options structs.
+ */
+class TuningProfile {
+   public:
+    /// Value of the parameter name for problems of size n, or defval if the
+    /// parameter is not in the profile
+    size_t get(std::string_view name, size_t n, size_t defval) const
+    {
+        if (params.empty()) return defval;
+        const auto it = params.find(name);
+        if (it == params.end()) return defval;
+        auto v = it->second.upper_bound(n);
+        if (v == it->second.begin()) return defval;
+        return (--v)->second;
+    }
+
+    /// Value of the parameter name, or defval if the parameter is not in the
+    /// profile
+    size_t get(std::string_view name, size_t defval) const
+    {
+        return get(name, 0, defval);
+    }
+
+    /// Sets the value of the parameter name for problems of size n or larger
+    void set(const std::string& name, size_t value, size_t n = 0)
+    {
+        params[name][n] = value;
+    }
+
+    /// Removes all parameters
+    void clear() noexcept { params.clear(); }
+
+    /// True if there are no parameters
+    bool empty() const noexcept { return params.empty(); }
+
+    /**
+     * @brief Reads parameters from a stream.
+     *
+     * The parameters read are added to the profile.
+     *
+     * @return true if all lines were read, false if a line is not valid. The
+     *      lines before the invalid one are kept.
+     */
+    bool read(std::istream& is)
+    {
+        std::string line;
+        while (std::getline(is, line)) {
+            const size_t c = line.find('#');
+            if (c != std::string::npos) line.erase(c);
+
+            std::istringstream ls(line);
+            std::string key;
+            if (!(ls >> key)) continue;  // Empty line
+
+            long long value;
+            if (!(ls >> value) || value < 0) return false;
+            std::string extra;
+            if (ls >> extra) return false;
+
+            size_t n = 0;
+            const size_t at = key.find('@');
+            if (at != std::string::npos) {
+                const std::string nstr = key.substr(at + 1);
+                char* end = nullptr;
+                const long long nl = std::strtoll(nstr.c_str(), &end, 10);
+                if (nstr.empty() || *end != '\0' || nl < 0) return false;
+                n = size_t(nl);
+                key.erase(at);
+            }
+            if (key.empty()) return false;
+
+            set(key, size_t(value), n);
+        }
+        return true;
+    }
+
+    /// Writes the profile in the format accepted by read()
+    void write(std::ostream& os) const
+    {
+        for (const auto& [name, values] : params) {
+            for (const auto& [n, value] : values) {
+                os << name;
+                if (n > 0) os << '@' << n;
+                os << ' ' << value << '\n';
+            }
+        }
+    }
+
+    /// Reads parameters from the file filename. Returns false if the file
+    /// cannot be opened or is not valid
+    bool load(const std::string& filename)
+    {
+        std::ifstream f(filename);
+        return f && read(f);
+    }
+
+    /// Writes the profile to the file filename. Returns false on failure
+    bool save(const std::string& filename) const
+    {
+        std::ofstream f(filename);
+        if (!f) return false;
+        write(f);
+        return bool(f);
+    }
+
+    /// Profile used by the options structs
+    static TuningProfile& global()
+    {
+        static TuningProfile profile = []() {
+            TuningProfile p;
+            if (const char* env = std::getenv("TLAPACK_TUNING_PROFILE")) {
+                if (!p.load(env)) p.clear();
+            }
+            return p;
+        }();
+        return profile;
+    }
+
+   private:
+    std::map<std::string, std::map<size_t, size_t>, std::less<>> params;
+};
+
+/// Value of the parameter name in TuningProfile::global(), or defval
+inline size_t tuned(std::string_view name, size_t defval)
+{
+    return TuningProfile::global().get(name, defval);
+}
+
+/// Value of the parameter name for problems of size n in
+/// TuningProfile::global(), or defval
+inline size_t tuned(std::string_view name, size_t n, size_t defval)
+{
+    return TuningProfile::global().get(name, n, defval);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TUNING_HH
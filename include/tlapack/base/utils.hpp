@@ -16,9 +16,11 @@
 #include <type_traits>
 #include <utility>
 
+#include "tlapack/base/arena.hpp"
 #include "tlapack/base/arrayTraits.hpp"
 #include "tlapack/base/concepts.hpp"
 #include "tlapack/base/exceptionHandling.hpp"
+#include "tlapack/base/trace.hpp"
 #include "tlapack/base/types.hpp"
 #include "tlapack/base/workspace.hpp"
 
@@ -302,6 +304,66 @@ template <class T1, class... Ts>
 using disable_if_allow_optblas_t =
     enable_if_t<(!allow_optblas<T1, Ts...>), int>;
 
+namespace internal {
+    /// Calls f(std::integral_constant<int, i>{}) for i = first, ..., last-1.
+    /// The loop is unrolled at compile time
+    template <int first, int last, class F>
+    constexpr void static_for(F&& f)
+    {
+        if constexpr (first < last) {
+            f(std::integral_constant<int, first>{});
+            static_for<first + 1, last>(f);
+        }
+    }
+
+    /// Calls f with std::integral_constant<Op, op>
+    template <class F>
+    void dispatch_op(Op op, F&& f)
+    {
+        if (op == Op::NoTrans)
+            f(std::integral_constant<Op, Op::NoTrans>{});
+        else if (op == Op::Trans)
+            f(std::integral_constant<Op, Op::Trans>{});
+        else
+            f(std::integral_constant<Op, Op::ConjTrans>{});
+    }
+
+    /// Entry (i,j) of op(A)
+    template <Op op, class matrix_t, class i_t, class j_t>
+    constexpr auto op_entry(const matrix_t& A, i_t i, j_t j)
+    {
+        if constexpr (op == Op::NoTrans)
+            return A(i, j);
+        else if constexpr (op == Op::Trans)
+            return A(j, i);
+        else
+            return conj(A(j, i));
+    }
+
+    /// Largest size of the matrices handled by the fixed-size kernels, e.g.,
+    /// gemm_static()
+    constexpr int max_static_size = 8;
+
+    /// True if the sizes of all matrices are known at compile time and are at
+    /// most max_static_size
+    template <class... matrix_t>
+    constexpr bool use_static_kernels =
+        ((static_nrows<matrix_t> >= 0 &&
+          static_nrows<matrix_t> <= max_static_size &&
+          static_ncols<matrix_t> >= 0 &&
+          static_ncols<matrix_t> <= max_static_size) &&
+         ...);
+
+    /// True if C is row-major and all matrices in matrix_t... have a known
+    /// layout, so that they can be transposed with transpose_view(). Routines
+    /// use it to solve the transposed problem, whose loops walk C with unit
+    /// stride
+    template <class C, class... matrix_t>
+    constexpr bool use_transposed_problem =
+        (layout<C> == Layout::RowMajor) &&
+        ((layout<matrix_t> != Layout::Unspecified) && ...);
+}  // namespace internal
+
 #ifdef TLAPACK_USE_LAPACKPP
 namespace traits {
     template <>
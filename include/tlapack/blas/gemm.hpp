@@ -12,6 +12,8 @@
 #define TLAPACK_BLAS_GEMM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm_blocked.hpp"
+#include "tlapack/blas/gemm_static.hpp"
 
 namespace tlapack {
 
@@ -45,6 +47,12 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A m-by-n matrix.
  *
+ * @note If m, n and k are all at least GemmBlockedOpts::nx, the product is
+ * computed by gemm_blocked(). Use the overload with a GemmBlockedOpts argument
+ * to set the block sizes and the number of threads.
+ * If the sizes of A, B and C are known at compile time and are at most
+ * internal::max_static_size, the product is computed by gemm_static().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -86,6 +94,36 @@ void gemm(Op transA,
     tlapack_check_false(
         (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
 
+    tlapack_trace("gemm", internal::trace_flops<T>(2. * m * n * k),
+                  sizeof(T) * (double(m) * k + double(k) * n + 2. * m * n));
+
+    // Small matrices of fixed size go through unrolled kernels
+    if constexpr (internal::use_static_kernels<matrixA_t, matrixB_t,
+                                               matrixC_t>) {
+        constexpr int M = static_nrows<matrixC_t>;
+        constexpr int N = static_ncols<matrixC_t>;
+        if (transA == Op::NoTrans)
+            return gemm_static<M, N, static_ncols<matrixA_t>>(
+                transA, transB, alpha, A, B, beta, C);
+        else
+            return gemm_static<M, N, static_nrows<matrixA_t>>(
+                transA, transB, alpha, A, B, beta, C);
+    }
+    else if constexpr (internal::use_transposed_problem<matrixC_t, matrixA_t,
+                                                         matrixB_t>) {
+        // Row-major C: compute C^T = op(B)^T op(A)^T instead
+        auto Ct = transpose_view(C);
+        return gemm(transB, transA, alpha, transpose_view(B),
+                    transpose_view(A), beta, Ct);
+    }
+    else {
+        // Large problems go through the packed and cache-blocked engine
+        const GemmBlockedOpts opts;
+        const idx_t nx = opts.nx;
+        if (m >= nx && n >= nx && k >= nx)
+            return gemm_blocked(transA, transB, alpha, A, B, beta, C, opts);
+    }
+
     if (transA == Op::NoTrans) {
         using scalar_t = scalar_type<alpha_t, TB>;
 
@@ -194,6 +232,43 @@ void gemm(Op transA,
     }
 }
 
+/**
+ * General matrix-matrix multiply using the packed gemm engine.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute the
+ *        tiles of C.
+ *
+ * @see gemm(
+    Op transA,
+    Op transB,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    const matrixB_t& B,
+    const beta_t& beta,
+    matrixC_t& C )
+ * @see gemm_blocked()
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemm(Op transA,
+          Op transB,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          const matrixB_t& B,
+          const beta_t& beta,
+          matrixC_t& C,
+          const GemmBlockedOpts& opts)
+{
+    return gemm_blocked(transA, transB, alpha, A, B, beta, C, opts);
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 /**
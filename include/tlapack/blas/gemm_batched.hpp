@@ -0,0 +1,118 @@
+/// @file gemm_batched.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMM_BATCHED_HH
+#define TLAPACK_BLAS_GEMM_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+
+namespace tlapack {
+
+/**
+ * Batched general matrix-matrix multiply:
+ * \[
+ *     C_b := \alpha op(A_b) \times op(B_b) + \beta C_b,
+ * \]
+ * for each matrix b of the batches A, B and C. See gemm().
+ *
+ * @param[in] transA
+ *     The operation $op(A)$ to be used:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] transB
+ *     The operation $op(B)$ to be used:
+ *     - Op::NoTrans:   $op(B) = B$.
+ *     - Op::Trans:     $op(B) = B^T$.
+ *     - Op::ConjTrans: $op(B) = B^H$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A Batch of matrices. $op(A_b)$ is an m-by-k matrix.
+ * @param[in] B Batch of matrices. $op(B_b)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C Batch of m-by-n matrices.
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @ingroup blas3
+ */
+template <class batchA_t,
+          class batchB_t,
+          class batchC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemm_batched(Op transA,
+                  Op transB,
+                  const alpha_t& alpha,
+                  const batchA_t& A,
+                  const batchB_t& B,
+                  const beta_t& beta,
+                  batchC_t& C,
+                  const BatchOpts& opts = {})
+{
+    const auto A_ = internal::batch_view(A);
+    const auto B_ = internal::batch_view(B);
+    const auto C_ = internal::batch_view(C);
+    const size_t count = internal::batch_count(C_);
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false(internal::batch_count(A_) != count);
+    tlapack_check_false(internal::batch_count(B_) != count);
+
+    // Quick return
+    if (count == 0) return;
+
+    // constants
+    const size_t m = internal::batch_nrows(C_);
+    const size_t n = internal::batch_ncols(C_);
+    const size_t k = (transA == Op::NoTrans) ? internal::batch_ncols(A_)
+                                             : internal::batch_nrows(A_);
+
+    // check arguments
+    tlapack_check_false(!internal::batch_is(C_, m, n));
+    tlapack_check_false(
+        !internal::batch_is(A_, (transA == Op::NoTrans) ? m : k,
+                            (transA == Op::NoTrans) ? k : m));
+    tlapack_check_false(
+        !internal::batch_is(B_, (transB == Op::NoTrans) ? k : n,
+                            (transB == Op::NoTrans) ? n : k));
+
+    internal::dispatch_op(transA, [&](auto opA) {
+        internal::dispatch_op(transB, [&](auto opB) {
+            constexpr Op oA = decltype(opA)::value;
+            constexpr Op oB = decltype(opB)::value;
+            internal::batch_for_each(
+                count, opts,
+                [&](size_t b0, size_t b1, size_t, const auto& A, const auto& B,
+                    const auto& C) {
+                    using internal::op_entry;
+                    for (size_t j = 0; j < n; ++j) {
+                        for (size_t i = 0; i < m; ++i)
+                            for (size_t b = b0; b < b1; ++b)
+                                C(b, i, j) *= beta;
+                        for (size_t l = 0; l < k; ++l)
+                            for (size_t i = 0; i < m; ++i)
+                                for (size_t b = b0; b < b1; ++b)
+                                    C(b, i, j) +=
+                                        alpha * op_entry<oA>(A, b, i, l) *
+                                        op_entry<oB>(B, b, l, j);
+                    }
+                },
+                A_, B_, C_);
+        });
+    });
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_GEMM_BATCHED_HH
@@ -0,0 +1,419 @@
+/// @file gemm_blocked.hpp Packed and cache-blocked general matrix-matrix
+/// multiply.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMM_BLOCKED_HH
+#define TLAPACK_BLAS_GEMM_BLOCKED_HH
+
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm_kernels.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for gemm_blocked()
+ *
+ * The engine follows the GotoBLAS design: op(B) is packed in blocks of size
+ * kc-by-nc, op(A) is packed in blocks of size mc-by-kc, and a register-tiled
+ * micro-kernel computes mr-by-nr blocks of C from the packed panels.
+ *
+ * If num_threads is not 1, the output matrix is partitioned in 2-D tiles that
+ * are computed concurrently on a ThreadPool.
+ */
+struct GemmBlockedOpts {
+    size_t mc = 128;   ///< Number of rows of op(A) in each packed block
+    size_t kc = 256;   ///< Depth of each packed block of op(A) and op(B)
+    size_t nc = 2048;  ///< Number of columns of op(B) in each packed block
+    size_t nx = 16;    ///< The level 3 BLAS templates use the blocked engine
+                       ///< only if all dimensions are at least nx
+    size_t nb = 64;    ///< Size of the diagonal blocks in trsm_blocked() and
+                       ///< trmm_blocked()
+    size_t num_threads = 1;  ///< Number of threads. If 0, use all threads of
+                             ///< the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
+};
+
+namespace internal {
+
+    /**
+     * @brief Packs a block of op(A) into mr-row panels.
+     *
+     * The (i,l)-th entry of the block op(A)(i0:i0+mb,l0:l0+kb) is stored at
+     * Ap[(i/mr)*kb*mr + l*mr + i%mr]. Rows of the last panel beyond mb are
+     * padded with zeros.
+     */
+    template <int mr, class matrix_t, class T, class idx_t>
+    void gemm_pack_A(
+        Op trans, const matrix_t& A, idx_t i0, idx_t mb, idx_t l0, idx_t kb, T* Ap)
+    {
+        for (idx_t ip = 0; ip < mb; ip += mr) {
+            const idx_t ib = min<idx_t>(mr, mb - ip);
+            T* panel = Ap + ip * kb;
+            for (idx_t l = 0; l < kb; ++l) {
+                T* p = panel + l * mr;
+                if (trans == Op::NoTrans)
+                    for (idx_t i = 0; i < ib; ++i)
+                        p[i] = A(i0 + ip + i, l0 + l);
+                else if (trans == Op::Trans)
+                    for (idx_t i = 0; i < ib; ++i)
+                        p[i] = A(l0 + l, i0 + ip + i);
+                else
+                    for (idx_t i = 0; i < ib; ++i)
+                        p[i] = conj(A(l0 + l, i0 + ip + i));
+                for (idx_t i = ib; i < mr; ++i)
+                    p[i] = T(0);
+            }
+        }
+    }
+
+    /**
+     * @brief Packs a block of op(B) into nr-column panels.
+     *
+     * The (l,j)-th entry of the block op(B)(l0:l0+kb,j0:j0+nb) is stored at
+     * Bp[(j/nr)*kb*nr + l*nr + j%nr]. Columns of the last panel beyond nb are
+     * padded with zeros.
+     */
+    template <int nr, class matrix_t, class T, class idx_t>
+    void gemm_pack_B(
+        Op trans, const matrix_t& B, idx_t l0, idx_t kb, idx_t j0, idx_t nb, T* Bp)
+    {
+        for (idx_t jp = 0; jp < nb; jp += nr) {
+            const idx_t jb = min<idx_t>(nr, nb - jp);
+            T* panel = Bp + jp * kb;
+            for (idx_t l = 0; l < kb; ++l) {
+                T* p = panel + l * nr;
+                if (trans == Op::NoTrans)
+                    for (idx_t j = 0; j < jb; ++j)
+                        p[j] = B(l0 + l, j0 + jp + j);
+                else if (trans == Op::Trans)
+                    for (idx_t j = 0; j < jb; ++j)
+                        p[j] = B(j0 + jp + j, l0 + l);
+                else
+                    for (idx_t j = 0; j < jb; ++j)
+                        p[j] = conj(B(j0 + jp + j, l0 + l));
+                for (idx_t j = jb; j < nr; ++j)
+                    p[j] = T(0);
+            }
+        }
+    }
+
+    /// Entry (i,j) of op(A)
+    template <class matrix_t, class idx_t>
+    inline type_t<matrix_t> op_entry(Op trans,
+                                     const matrix_t& A,
+                                     idx_t i,
+                                     idx_t j)
+    {
+        return (trans == Op::NoTrans) ? A(i, j)
+               : (trans == Op::Trans) ? A(j, i)
+                                      : conj(A(j, i));
+    }
+
+    /// True if the block C(i0:i0+mb,j0:j0+nb) has entries in the part of C
+    /// specified by uplo
+    template <class idx_t>
+    constexpr bool gemm_block_in_uplo(
+        Uplo uplo, idx_t i0, idx_t mb, idx_t j0, idx_t nb) noexcept
+    {
+        if (uplo == Uplo::Upper)
+            return i0 < j0 + nb;
+        else if (uplo == Uplo::Lower)
+            return i0 + mb > j0;
+        else
+            return true;
+    }
+
+    /// True if the entry C(i,j) is in the part of C specified by uplo
+    template <class idx_t>
+    constexpr bool gemm_entry_in_uplo(Uplo uplo, idx_t i, idx_t j) noexcept
+    {
+        return (uplo == Uplo::Upper)   ? (i <= j)
+               : (uplo == Uplo::Lower) ? (i >= j)
+                                       : true;
+    }
+
+    /// Number of threads requested by opts
+    inline size_t gemm_num_threads(const GemmBlockedOpts& opts)
+    {
+        if (opts.num_threads == 1) return 1;
+        const ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+        return (opts.num_threads == 0) ? pool.size() + 1 : opts.num_threads;
+    }
+
+    /// True if a problem with m*n*k multiply-adds is worth splitting among
+    /// threads
+    template <class idx_t>
+    bool gemm_use_threads(const GemmBlockedOpts& opts,
+                          idx_t m,
+                          idx_t n,
+                          idx_t k)
+    {
+        return gemm_num_threads(opts) > 1 &&
+               double(m) * double(n) * double(k) >= 262144.0;
+    }
+
+    /**
+     * @brief Partitions an m-by-n matrix in about ntiles tiles and calls
+     * f(i0, mb, j0, nb) for each tile (i0:i0+mb,j0:j0+nb) using the threads
+     * specified in opts.
+     *
+     * The tiles are as square as possible. The row and column offsets of the
+     * tiles are multiples of ra and ca, respectively.
+     */
+    template <class idx_t, class F>
+    void gemm_parallel_tiles(const GemmBlockedOpts& opts,
+                             idx_t m,
+                             idx_t n,
+                             idx_t ra,
+                             idx_t ca,
+                             size_t ntiles,
+                             F&& f)
+    {
+        ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+
+        // Number of tiles in each direction
+        const size_t mu = (m + ra - 1) / ra;
+        const size_t nu = (n + ca - 1) / ca;
+        size_t pc = size_t(sqrt(double(ntiles) * double(n) / double(m)) +
+                           0.5);
+        pc = std::min(std::max<size_t>(pc, 1), nu);
+        const size_t pr =
+            std::min(std::max<size_t>((ntiles + pc - 1) / pc, 1), mu);
+
+        pool.parallel_for(pr * pc, gemm_num_threads(opts), [&](size_t t) {
+            const size_t r = t % pr;
+            const size_t c = t / pr;
+            const idx_t i0 = min<idx_t>(idx_t(r * mu / pr) * ra, m);
+            const idx_t i1 = min<idx_t>(idx_t((r + 1) * mu / pr) * ra, m);
+            const idx_t j0 = min<idx_t>(idx_t(c * nu / pc) * ca, n);
+            const idx_t j1 = min<idx_t>(idx_t((c + 1) * nu / pc) * ca, n);
+            if (i1 > i0 && j1 > j0) f(i0, i1 - i0, j0, j1 - j0);
+        });
+    }
+
+    /**
+     * @brief Packed and cache-blocked update of a block of C.
+     *
+     * Computes
+     * \[
+     *     C(i0:i0+m,j0:j0+n) := \alpha op(A)(i0:i0+m,p0:p0+k)
+     *                               op(B)(p0:p0+k,j0:j0+n)
+     *                           + \beta C(i0:i0+m,j0:j0+n),
+     * \]
+     * touching only the entries of C in the part specified by uplo. Blocks
+     * of op(A) and op(B) are copied to contiguous buffers so that the
+     * micro-kernel runs over memory that fits in cache. If opts asks for
+     * more than one thread, the block of C is split in tiles that are updated
+     * concurrently.
+     *
+     * @see gemm_blocked() for the description of the other parameters.
+     */
+    template <class matrixA_t,
+              class matrixB_t,
+              class matrixC_t,
+              class alpha_t,
+              class beta_t,
+              class idx_t>
+    void gemm_blocked_engine(Uplo uplo,
+                             Op transA,
+                             Op transB,
+                             const alpha_t& alpha,
+                             const matrixA_t& A,
+                             const matrixB_t& B,
+                             const beta_t& beta,
+                             matrixC_t& C,
+                             idx_t i0,
+                             idx_t m,
+                             idx_t j0,
+                             idx_t n,
+                             idx_t p0,
+                             idx_t k,
+                             const GemmBlockedOpts& opts)
+    {
+        // data traits
+        using TA = type_t<matrixA_t>;
+        using TB = type_t<matrixB_t>;
+        using scalar_t = scalar_type<TA, TB>;
+        using kernel = gemm_kernel_traits<TA, TB>;
+
+        // constants
+        constexpr int mr = kernel::mr;
+        constexpr int nr = kernel::nr;
+
+        // Block sizes rounded up to multiples of the register tile
+        const idx_t mc = ((max<idx_t>(opts.mc, 1) + mr - 1) / mr) * mr;
+        const idx_t nc = ((max<idx_t>(opts.nc, 1) + nr - 1) / nr) * nr;
+        const idx_t kc = max<idx_t>(opts.kc, 1);
+
+        // quick return
+        if (m <= 0 || n <= 0) return;
+
+        // Split C in tiles. More tiles than threads balance the work when
+        // only a triangle of C is updated
+        if (gemm_use_threads(opts, m, n, k)) {
+            GemmBlockedOpts tileOpts = opts;
+            tileOpts.num_threads = 1;
+            const size_t nthreads = gemm_num_threads(opts);
+            gemm_parallel_tiles(
+                opts, m, n, idx_t(mr), idx_t(nr),
+                (uplo == Uplo::General) ? nthreads : 4 * nthreads,
+                [&](idx_t ti, idx_t tm, idx_t tj, idx_t tn) {
+                    if (gemm_block_in_uplo(uplo, i0 + ti, tm, j0 + tj, tn))
+                        gemm_blocked_engine(uplo, transA, transB, alpha, A, B,
+                                            beta, C, i0 + ti, tm, j0 + tj, tn,
+                                            p0, k, tileOpts);
+                });
+            return;
+        }
+
+        // C := beta C
+        for (idx_t j = j0; j < j0 + n; ++j)
+            for (idx_t i = i0; i < i0 + m; ++i)
+                if (gemm_entry_in_uplo(uplo, i, j)) C(i, j) *= beta;
+
+        if (k <= 0) return;
+
+        // Micro-kernel
+        const auto microkernel =
+            gemm_microkernel_selector<TA, TB, scalar_t, mr, nr>::select();
+
+        // Packing buffers
+        arena_vector<TA> Ap_(min(mc, ((m + mr - 1) / mr) * mr) * min(kc, k));
+        arena_vector<TB> Bp_(min(nc, ((n + nr - 1) / nr) * nr) * min(kc, k));
+        TA* Ap = Ap_.data();
+        TB* Bp = Bp_.data();
+
+        // Register tile
+        scalar_t acc[mr * nr];
+
+        for (idx_t jc = j0; jc < j0 + n; jc += nc) {
+            const idx_t nb = min(nc, j0 + n - jc);
+            if (!gemm_block_in_uplo(uplo, i0, m, jc, nb)) continue;
+
+            for (idx_t pc = p0; pc < p0 + k; pc += kc) {
+                const idx_t kb = min(kc, p0 + k - pc);
+
+                gemm_pack_B<nr>(transB, B, pc, kb, jc, nb, Bp);
+
+                for (idx_t ic = i0; ic < i0 + m; ic += mc) {
+                    const idx_t mb = min(mc, i0 + m - ic);
+                    if (!gemm_block_in_uplo(uplo, ic, mb, jc, nb)) continue;
+
+                    gemm_pack_A<mr>(transA, A, ic, mb, pc, kb, Ap);
+
+                    // Macro-kernel
+                    for (idx_t jr = 0; jr < nb; jr += nr) {
+                        const idx_t jb = min<idx_t>(nr, nb - jr);
+                        for (idx_t ir = 0; ir < mb; ir += mr) {
+                            const idx_t ib = min<idx_t>(mr, mb - ir);
+                            if (!gemm_block_in_uplo(uplo, ic + ir, ib, jc + jr,
+                                                    jb))
+                                continue;
+
+                            microkernel(kb, Ap + ir * kb, Bp + jr * kb, acc);
+
+                            for (idx_t j = 0; j < jb; ++j)
+                                for (idx_t i = 0; i < ib; ++i)
+                                    if (gemm_entry_in_uplo(uplo, ic + ir + i,
+                                                           jc + jr + j))
+                                        C(ic + ir + i, jc + jr + j) +=
+                                            alpha * acc[i + j * mr];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
+/**
+ * General matrix-matrix multiply using a packed and cache-blocked algorithm:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * where $op(X)$ is one of
+ *     $op(X) = X$,
+ *     $op(X) = X^T$, or
+ *     $op(X) = X^H$,
+ * alpha and beta are scalars, and A, B, and C are matrices, with
+ * $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
+ *
+ * Blocks of op(A) and op(B) are copied to contiguous buffers so that the
+ * innermost loops run over memory that fits in cache, independently of the
+ * matrix types of A and B. The mr-by-nr blocks of C are computed by the
+ * micro-kernels in gemm_kernels.hpp, which are vectorized for float, double,
+ * std::complex<float> and std::complex<double>.
+ *
+ * @param[in] transA
+ *     The operation $op(A)$ to be used:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] transB
+ *     The operation $op(B)$ to be used:
+ *     - Op::NoTrans:   $op(B) = B$.
+ *     - Op::Trans:     $op(B) = B^T$.
+ *     - Op::ConjTrans: $op(B) = B^H$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix.
+ * @param[in] opts Options.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute the
+ *        tiles of C.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemm_blocked(Op transA,
+                  Op transB,
+                  const alpha_t& alpha,
+                  const matrixA_t& A,
+                  const matrixB_t& B,
+                  const beta_t& beta,
+                  matrixC_t& C,
+                  const GemmBlockedOpts& opts = {})
+{
+    // data traits
+    using idx_t = size_type<matrixC_t>;
+
+    // constants
+    const idx_t m = (transA == Op::NoTrans) ? nrows(A) : ncols(A);
+    const idx_t n = (transB == Op::NoTrans) ? ncols(B) : nrows(B);
+    const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false((idx_t)nrows(C) != m);
+    tlapack_check_false((idx_t)ncols(C) != n);
+    tlapack_check_false(
+        (idx_t)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
+
+    internal::gemm_blocked_engine(Uplo::General, transA, transB, alpha, A, B,
+                                  beta, C, idx_t(0), m, idx_t(0), n, idx_t(0), k,
+                                  opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_GEMM_BLOCKED_HH
@@ -0,0 +1,446 @@
+/// @file gemm_kernels.hpp Micro-kernels used by the packed gemm engine.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMM_KERNELS_HH
+#define TLAPACK_BLAS_GEMM_KERNELS_HH
+
+#include <complex>
+#include <cstddef>
+
+#include "tlapack/base/simd.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /**
+     * @brief Register tile sizes of the gemm micro-kernel.
+     *
+     * The micro-kernel computes an mr-by-nr block of C. Specialize this trait
+     * to tune the register tile of a given entry type.
+     *
+     * @tparam TA Entry type of the packed panels of op(A).
+     * @tparam TB Entry type of the packed panels of op(B).
+     */
+    template <class TA, class TB, class = int>
+    struct gemm_kernel_traits {
+        static constexpr int mr = 4;  ///< Rows of the register tile
+        static constexpr int nr = 4;  ///< Columns of the register tile
+    };
+
+    template <>
+    struct gemm_kernel_traits<float, float, int> {
+        static constexpr int mr = 16;
+        static constexpr int nr = 6;
+    };
+
+    template <>
+    struct gemm_kernel_traits<double, double, int> {
+        static constexpr int mr = 8;
+        static constexpr int nr = 6;
+    };
+
+    template <>
+    struct gemm_kernel_traits<std::complex<float>, std::complex<float>, int> {
+        static constexpr int mr = 8;
+        static constexpr int nr = 3;
+    };
+
+    template <>
+    struct gemm_kernel_traits<std::complex<double>,
+                              std::complex<double>,
+                              int> {
+        static constexpr int mr = 4;
+        static constexpr int nr = 3;
+    };
+
+    /**
+     * @brief Micro-kernel: computes the mr-by-nr product of two packed panels.
+     *
+     * On exit, acc[i + j*mr] = sum_l Ap[l*mr + i] * Bp[l*nr + j].
+     */
+    template <int mr, int nr, class TA, class TB, class Tacc>
+    void gemm_microkernel(std::size_t kb,
+                          const TA* Ap,
+                          const TB* Bp,
+                          Tacc* acc)
+    {
+        for (int ij = 0; ij < mr * nr; ++ij)
+            acc[ij] = Tacc(0);
+        for (std::size_t l = 0; l < kb; ++l) {
+            const TA* a = Ap + l * mr;
+            const TB* b = Bp + l * nr;
+            for (int j = 0; j < nr; ++j) {
+                const TB& bj = b[j];
+                for (int i = 0; i < mr; ++i)
+                    acc[i + j * mr] += a[i] * bj;
+            }
+        }
+    }
+
+    /**
+     * @brief Complex micro-kernel without the Inf/NaN recovery of the C++
+     * complex product.
+     *
+     * Used as the portable fallback of the complex specializations so that it
+     * computes the same quantities as the vectorized kernels.
+     */
+    template <int mr, int nr, class real_t>
+    void gemm_microkernel_complex(std::size_t kb,
+                                  const std::complex<real_t>* Ap,
+                                  const std::complex<real_t>* Bp,
+                                  std::complex<real_t>* acc)
+    {
+        real_t cr[mr * nr] = {};
+        real_t ci[mr * nr] = {};
+        for (std::size_t l = 0; l < kb; ++l) {
+            const std::complex<real_t>* a = Ap + l * mr;
+            const std::complex<real_t>* b = Bp + l * nr;
+            for (int j = 0; j < nr; ++j) {
+                const real_t br = b[j].real();
+                const real_t bi = b[j].imag();
+                for (int i = 0; i < mr; ++i) {
+                    const real_t ar = a[i].real();
+                    const real_t ai = a[i].imag();
+                    cr[i + j * mr] += ar * br - ai * bi;
+                    ci[i + j * mr] += ar * bi + ai * br;
+                }
+            }
+        }
+        for (int ij = 0; ij < mr * nr; ++ij)
+            acc[ij] = std::complex<real_t>(cr[ij], ci[ij]);
+    }
+
+#if defined(TLAPACK_SIMD_X86)
+
+    // -------------------------------------------------------------------------
+    // x86 AVX2 + FMA
+
+    __attribute__((target("avx2,fma"))) inline void gemm_microkernel_avx2(
+        std::size_t kb, const double* Ap, const double* Bp, double* acc)
+    {
+        __m256d c[6][2];
+        for (int j = 0; j < 6; ++j)
+            c[j][0] = c[j][1] = _mm256_setzero_pd();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 8, Bp += 6) {
+            const __m256d a0 = _mm256_loadu_pd(Ap);
+            const __m256d a1 = _mm256_loadu_pd(Ap + 4);
+            for (int j = 0; j < 6; ++j) {
+                const __m256d b = _mm256_broadcast_sd(Bp + j);
+                c[j][0] = _mm256_fmadd_pd(a0, b, c[j][0]);
+                c[j][1] = _mm256_fmadd_pd(a1, b, c[j][1]);
+            }
+        }
+        for (int j = 0; j < 6; ++j) {
+            _mm256_storeu_pd(acc + 8 * j, c[j][0]);
+            _mm256_storeu_pd(acc + 8 * j + 4, c[j][1]);
+        }
+    }
+
+    __attribute__((target("avx2,fma"))) inline void gemm_microkernel_avx2(
+        std::size_t kb, const float* Ap, const float* Bp, float* acc)
+    {
+        __m256 c[6][2];
+        for (int j = 0; j < 6; ++j)
+            c[j][0] = c[j][1] = _mm256_setzero_ps();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 16, Bp += 6) {
+            const __m256 a0 = _mm256_loadu_ps(Ap);
+            const __m256 a1 = _mm256_loadu_ps(Ap + 8);
+            for (int j = 0; j < 6; ++j) {
+                const __m256 b = _mm256_broadcast_ss(Bp + j);
+                c[j][0] = _mm256_fmadd_ps(a0, b, c[j][0]);
+                c[j][1] = _mm256_fmadd_ps(a1, b, c[j][1]);
+            }
+        }
+        for (int j = 0; j < 6; ++j) {
+            _mm256_storeu_ps(acc + 16 * j, c[j][0]);
+            _mm256_storeu_ps(acc + 16 * j + 8, c[j][1]);
+        }
+    }
+
+    // Complex products are accumulated as a*Re(b) and a*Im(b), and combined
+    // at the end with a single add-subtract.
+    __attribute__((target("avx2,fma"))) inline void gemm_microkernel_avx2(
+        std::size_t kb,
+        const std::complex<double>* Ap_,
+        const std::complex<double>* Bp_,
+        std::complex<double>* acc_)
+    {
+        const double* Ap = reinterpret_cast<const double*>(Ap_);
+        const double* Bp = reinterpret_cast<const double*>(Bp_);
+        double* acc = reinterpret_cast<double*>(acc_);
+
+        __m256d cr[3][2], ci[3][2];
+        for (int j = 0; j < 3; ++j)
+            cr[j][0] = cr[j][1] = ci[j][0] = ci[j][1] = _mm256_setzero_pd();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 8, Bp += 6) {
+            const __m256d a0 = _mm256_loadu_pd(Ap);
+            const __m256d a1 = _mm256_loadu_pd(Ap + 4);
+            for (int j = 0; j < 3; ++j) {
+                const __m256d br = _mm256_broadcast_sd(Bp + 2 * j);
+                const __m256d bi = _mm256_broadcast_sd(Bp + 2 * j + 1);
+                cr[j][0] = _mm256_fmadd_pd(a0, br, cr[j][0]);
+                cr[j][1] = _mm256_fmadd_pd(a1, br, cr[j][1]);
+                ci[j][0] = _mm256_fmadd_pd(a0, bi, ci[j][0]);
+                ci[j][1] = _mm256_fmadd_pd(a1, bi, ci[j][1]);
+            }
+        }
+        for (int j = 0; j < 3; ++j)
+            for (int h = 0; h < 2; ++h)
+                _mm256_storeu_pd(
+                    acc + 8 * j + 4 * h,
+                    _mm256_addsub_pd(cr[j][h], _mm256_permute_pd(ci[j][h], 5)));
+    }
+
+    __attribute__((target("avx2,fma"))) inline void gemm_microkernel_avx2(
+        std::size_t kb,
+        const std::complex<float>* Ap_,
+        const std::complex<float>* Bp_,
+        std::complex<float>* acc_)
+    {
+        const float* Ap = reinterpret_cast<const float*>(Ap_);
+        const float* Bp = reinterpret_cast<const float*>(Bp_);
+        float* acc = reinterpret_cast<float*>(acc_);
+
+        __m256 cr[3][2], ci[3][2];
+        for (int j = 0; j < 3; ++j)
+            cr[j][0] = cr[j][1] = ci[j][0] = ci[j][1] = _mm256_setzero_ps();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 16, Bp += 6) {
+            const __m256 a0 = _mm256_loadu_ps(Ap);
+            const __m256 a1 = _mm256_loadu_ps(Ap + 8);
+            for (int j = 0; j < 3; ++j) {
+                const __m256 br = _mm256_broadcast_ss(Bp + 2 * j);
+                const __m256 bi = _mm256_broadcast_ss(Bp + 2 * j + 1);
+                cr[j][0] = _mm256_fmadd_ps(a0, br, cr[j][0]);
+                cr[j][1] = _mm256_fmadd_ps(a1, br, cr[j][1]);
+                ci[j][0] = _mm256_fmadd_ps(a0, bi, ci[j][0]);
+                ci[j][1] = _mm256_fmadd_ps(a1, bi, ci[j][1]);
+            }
+        }
+        for (int j = 0; j < 3; ++j)
+            for (int h = 0; h < 2; ++h)
+                _mm256_storeu_ps(acc + 16 * j + 8 * h,
+                                 _mm256_addsub_ps(
+                                     cr[j][h], _mm256_permute_ps(ci[j][h], 0xB1)));
+    }
+
+    // -------------------------------------------------------------------------
+    // x86 AVX-512F
+
+    __attribute__((target("avx512f"))) inline void gemm_microkernel_avx512(
+        std::size_t kb, const double* Ap, const double* Bp, double* acc)
+    {
+        __m512d c[6];
+        for (int j = 0; j < 6; ++j)
+            c[j] = _mm512_setzero_pd();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 8, Bp += 6) {
+            const __m512d a = _mm512_loadu_pd(Ap);
+            for (int j = 0; j < 6; ++j)
+                c[j] = _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[j]), c[j]);
+        }
+        for (int j = 0; j < 6; ++j)
+            _mm512_storeu_pd(acc + 8 * j, c[j]);
+    }
+
+    __attribute__((target("avx512f"))) inline void gemm_microkernel_avx512(
+        std::size_t kb, const float* Ap, const float* Bp, float* acc)
+    {
+        __m512 c[6];
+        for (int j = 0; j < 6; ++j)
+            c[j] = _mm512_setzero_ps();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 16, Bp += 6) {
+            const __m512 a = _mm512_loadu_ps(Ap);
+            for (int j = 0; j < 6; ++j)
+                c[j] = _mm512_fmadd_ps(a, _mm512_set1_ps(Bp[j]), c[j]);
+        }
+        for (int j = 0; j < 6; ++j)
+            _mm512_storeu_ps(acc + 16 * j, c[j]);
+    }
+
+    __attribute__((target("avx512f"))) inline void gemm_microkernel_avx512(
+        std::size_t kb,
+        const std::complex<double>* Ap_,
+        const std::complex<double>* Bp_,
+        std::complex<double>* acc_)
+    {
+        const double* Ap = reinterpret_cast<const double*>(Ap_);
+        const double* Bp = reinterpret_cast<const double*>(Bp_);
+        double* acc = reinterpret_cast<double*>(acc_);
+
+        __m512d cr[3], ci[3];
+        for (int j = 0; j < 3; ++j)
+            cr[j] = ci[j] = _mm512_setzero_pd();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 8, Bp += 6) {
+            const __m512d a = _mm512_loadu_pd(Ap);
+            for (int j = 0; j < 3; ++j) {
+                cr[j] = _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[2 * j]), cr[j]);
+                ci[j] =
+                    _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[2 * j + 1]), ci[j]);
+            }
+        }
+        const __m512d one = _mm512_set1_pd(1.0);
+        for (int j = 0; j < 3; ++j)
+            _mm512_storeu_pd(acc + 8 * j,
+                             _mm512_fmaddsub_pd(
+                                 cr[j], one,
+                                 _mm512_shuffle_pd(ci[j], ci[j], 0x55)));
+    }
+
+    __attribute__((target("avx512f"))) inline void gemm_microkernel_avx512(
+        std::size_t kb,
+        const std::complex<float>* Ap_,
+        const std::complex<float>* Bp_,
+        std::complex<float>* acc_)
+    {
+        const float* Ap = reinterpret_cast<const float*>(Ap_);
+        const float* Bp = reinterpret_cast<const float*>(Bp_);
+        float* acc = reinterpret_cast<float*>(acc_);
+
+        __m512 cr[3], ci[3];
+        for (int j = 0; j < 3; ++j)
+            cr[j] = ci[j] = _mm512_setzero_ps();
+        for (std::size_t l = 0; l < kb; ++l, Ap += 16, Bp += 6) {
+            const __m512 a = _mm512_loadu_ps(Ap);
+            for (int j = 0; j < 3; ++j) {
+                cr[j] = _mm512_fmadd_ps(a, _mm512_set1_ps(Bp[2 * j]), cr[j]);
+                ci[j] =
+                    _mm512_fmadd_ps(a, _mm512_set1_ps(Bp[2 * j + 1]), ci[j]);
+            }
+        }
+        const __m512 one = _mm512_set1_ps(1.0f);
+        for (int j = 0; j < 3; ++j)
+            _mm512_storeu_ps(acc + 16 * j,
+                             _mm512_fmaddsub_ps(
+                                 cr[j], one,
+                                 _mm512_shuffle_ps(ci[j], ci[j], 0xB1)));
+    }
+
+#elif defined(TLAPACK_SIMD_NEON)
+
+    // -------------------------------------------------------------------------
+    // ARMv8 Advanced SIMD
+
+    inline void gemm_microkernel_neon(std::size_t kb,
+                                      const double* Ap,
+                                      const double* Bp,
+                                      double* acc)
+    {
+        float64x2_t c[6][4];
+        for (int j = 0; j < 6; ++j)
+            for (int h = 0; h < 4; ++h)
+                c[j][h] = vdupq_n_f64(0.0);
+        for (std::size_t l = 0; l < kb; ++l, Ap += 8, Bp += 6) {
+            float64x2_t a[4];
+            for (int h = 0; h < 4; ++h)
+                a[h] = vld1q_f64(Ap + 2 * h);
+            for (int j = 0; j < 6; ++j)
+                for (int h = 0; h < 4; ++h)
+                    c[j][h] = vfmaq_n_f64(c[j][h], a[h], Bp[j]);
+        }
+        for (int j = 0; j < 6; ++j)
+            for (int h = 0; h < 4; ++h)
+                vst1q_f64(acc + 8 * j + 2 * h, c[j][h]);
+    }
+
+    inline void gemm_microkernel_neon(std::size_t kb,
+                                      const float* Ap,
+                                      const float* Bp,
+                                      float* acc)
+    {
+        float32x4_t c[6][4];
+        for (int j = 0; j < 6; ++j)
+            for (int h = 0; h < 4; ++h)
+                c[j][h] = vdupq_n_f32(0.0f);
+        for (std::size_t l = 0; l < kb; ++l, Ap += 16, Bp += 6) {
+            float32x4_t a[4];
+            for (int h = 0; h < 4; ++h)
+                a[h] = vld1q_f32(Ap + 4 * h);
+            for (int j = 0; j < 6; ++j)
+                for (int h = 0; h < 4; ++h)
+                    c[j][h] = vfmaq_n_f32(c[j][h], a[h], Bp[j]);
+        }
+        for (int j = 0; j < 6; ++j)
+            for (int h = 0; h < 4; ++h)
+                vst1q_f32(acc + 16 * j + 4 * h, c[j][h]);
+    }
+
+#endif
+
+    /**
+     * @brief Selects the micro-kernel for the packed panels of op(A) and
+     * op(B).
+     *
+     * The generic version returns the portable micro-kernel. The
+     * specializations for float, double, std::complex<float> and
+     * std::complex<double> return a vectorized kernel for the instruction set
+     * reported by simd_isa().
+     */
+    template <class TA, class TB, class Tacc, int mr, int nr>
+    struct gemm_microkernel_selector {
+        using kernel_t = void (*)(std::size_t, const TA*, const TB*, Tacc*);
+
+        static kernel_t select() noexcept
+        {
+            return &gemm_microkernel<mr, nr, TA, TB, Tacc>;
+        }
+    };
+
+    template <class T, int mr, int nr>
+    struct gemm_simd_microkernel_selector {
+        using kernel_t = void (*)(std::size_t, const T*, const T*, T*);
+
+        static kernel_t select() noexcept
+        {
+            static const kernel_t kernel = []() -> kernel_t {
+#if defined(TLAPACK_SIMD_X86)
+                if (simd_isa() == SimdIsa::AVX512)
+                    return &gemm_microkernel_avx512;
+                if (simd_isa() == SimdIsa::AVX2) return &gemm_microkernel_avx2;
+#elif defined(TLAPACK_SIMD_NEON)
+                if constexpr (is_real<T>) return &gemm_microkernel_neon;
+#endif
+                if constexpr (is_complex<T>)
+                    return &gemm_microkernel_complex<mr, nr, real_type<T>>;
+                else
+                    return &gemm_microkernel<mr, nr, T, T, T>;
+            }();
+            return kernel;
+        }
+    };
+
+    template <>
+    struct gemm_microkernel_selector<float, float, float, 16, 6>
+        : gemm_simd_microkernel_selector<float, 16, 6> {};
+
+    template <>
+    struct gemm_microkernel_selector<double, double, double, 8, 6>
+        : gemm_simd_microkernel_selector<double, 8, 6> {};
+
+    template <>
+    struct gemm_microkernel_selector<std::complex<float>,
+                                     std::complex<float>,
+                                     std::complex<float>,
+                                     8,
+                                     3>
+        : gemm_simd_microkernel_selector<std::complex<float>, 8, 3> {};
+
+    template <>
+    struct gemm_microkernel_selector<std::complex<double>,
+                                     std::complex<double>,
+                                     std::complex<double>,
+                                     4,
+                                     3>
+        : gemm_simd_microkernel_selector<std::complex<double>, 4, 3> {};
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_GEMM_KERNELS_HH
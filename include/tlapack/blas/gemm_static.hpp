@@ -0,0 +1,110 @@
+/// @file gemm_static.hpp General matrix-matrix multiply for matrices of fixed
+/// size.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_GEMM_STATIC_HH
+#define TLAPACK_BLAS_GEMM_STATIC_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/**
+ * General matrix-matrix multiply for matrices of sizes known at compile time
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * where $op(X)$ is one of
+ *     $op(X) = X$,
+ *     $op(X) = X^T$, or
+ *     $op(X) = X^H$,
+ * alpha and beta are scalars, and A, B, and C are matrices, with
+ * $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
+ *
+ * The loops are unrolled at compile time, so that each entry of C is computed
+ * with a sequence of k multiply-adds. gemm() calls this routine when the sizes
+ * of A, B and C are known at compile time and are at most
+ * internal::max_static_size.
+ *
+ * @tparam m Number of rows of C.
+ * @tparam n Number of columns of C.
+ * @tparam k Number of columns of op(A).
+ *
+ * @param[in] transA The operation $op(A)$ to be used.
+ * @param[in] transB The operation $op(B)$ to be used.
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix.
+ *
+ * @ingroup blas3
+ */
+template <int m,
+          int n,
+          int k,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void gemm_static(Op transA,
+                 Op transB,
+                 const alpha_t& alpha,
+                 const matrixA_t& A,
+                 const matrixB_t& B,
+                 const beta_t& beta,
+                 matrixC_t& C)
+{
+    static_assert(m >= 0 && n >= 0 && k >= 0);
+
+    // data traits
+    using TA = type_t<matrixA_t>;
+    using TB = type_t<matrixB_t>;
+    using scalar_t = scalar_type<TA, TB>;
+
+    // check arguments
+    tlapack_check_false(transA != Op::NoTrans && transA != Op::Trans &&
+                        transA != Op::ConjTrans);
+    tlapack_check_false(transB != Op::NoTrans && transB != Op::Trans &&
+                        transB != Op::ConjTrans);
+    tlapack_check_false((int)nrows(C) != m);
+    tlapack_check_false((int)ncols(C) != n);
+    tlapack_check_false(
+        (int)((transA == Op::NoTrans) ? nrows(A) : ncols(A)) != m);
+    tlapack_check_false(
+        (int)((transA == Op::NoTrans) ? ncols(A) : nrows(A)) != k);
+    tlapack_check_false(
+        (int)((transB == Op::NoTrans) ? nrows(B) : ncols(B)) != k);
+
+    internal::dispatch_op(transA, [&](auto opA) {
+        internal::dispatch_op(transB, [&](auto opB) {
+            constexpr Op oA = decltype(opA)::value;
+            constexpr Op oB = decltype(opB)::value;
+
+            internal::static_for<0, n>([&](auto j_) {
+                constexpr int j = j_;
+                internal::static_for<0, m>([&](auto i_) {
+                    constexpr int i = i_;
+                    scalar_t sum(0);
+                    internal::static_for<0, k>([&](auto l_) {
+                        constexpr int l = l_;
+                        sum += internal::op_entry<oA>(A, i, l) *
+                               internal::op_entry<oB>(B, l, j);
+                    });
+                    C(i, j) = alpha * sum + beta * C(i, j);
+                });
+            });
+        });
+    });
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_GEMM_STATIC_HH
@@ -81,6 +81,15 @@ void gemv(Op trans,
     // quick return
     if (m == 0 || n == 0) return;
 
+    if constexpr (internal::use_transposed_problem<matrixA_t>) {
+        // Row-major A: use the column-major view of A^T instead
+        const Op transT = (trans == Op::NoTrans) ? Op::Trans
+                          : (trans == Op::Trans) ? Op::NoTrans
+                          : (trans == Op::Conj)  ? Op::ConjTrans
+                                                 : Op::Conj;
+        return gemv(transT, alpha, transpose_view(A), x, beta, y);
+    }
+
     // form y := beta*y
     for (idx_t i = 0; i < m; ++i)
         y[i] *= beta;
@@ -56,10 +56,19 @@ void ger(const alpha_t& alpha,
     tlapack_check_false(size(x) != m);
     tlapack_check_false(size(y) != n);
 
-    for (idx_t j = 0; j < n; ++j) {
-        const scalar_t tmp = alpha * conj(y[j]);
-        for (idx_t i = 0; i < m; ++i)
-            A(i, j) += x[i] * tmp;
+    if constexpr (layout<matrixA_t> == Layout::RowMajor) {
+        for (idx_t i = 0; i < m; ++i) {
+            const scalar_type<alpha_t, type_t<vectorX_t> > tmp = alpha * x[i];
+            for (idx_t j = 0; j < n; ++j)
+                A(i, j) += tmp * conj(y[j]);
+        }
+    }
+    else {
+        for (idx_t j = 0; j < n; ++j) {
+            const scalar_t tmp = alpha * conj(y[j]);
+            for (idx_t i = 0; i < m; ++i)
+                A(i, j) += x[i] * tmp;
+        }
     }
 }
 
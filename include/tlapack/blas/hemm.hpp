@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_HEMM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/hemm_blocked.hpp"
 
 namespace tlapack {
 
@@ -47,6 +48,10 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A m-by-n matrix.
  *
+ * @note If m and n are at least GemmBlockedOpts::nx, the product is computed
+ * by hemm_blocked(). Use the overload with a GemmBlockedOpts argument to set the
+ * block sizes and the number of threads.
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -86,6 +91,19 @@ void hemm(Side side,
     tlapack_check_false(nrows(C) != m);
     tlapack_check_false(ncols(C) != n);
 
+    tlapack_trace(
+        "hemm",
+        internal::trace_flops<TB>(2. * m * n * ((side == Side::Left) ? m : n)),
+        sizeof(TB) * (0.5 * nrows(A) * nrows(A) + 3. * m * n));
+
+    // Large problems go through the packed and cache-blocked engine
+    {
+        const GemmBlockedOpts opts;
+        const idx_t nx = opts.nx;
+        if (m >= nx && n >= nx)
+            return hemm_blocked(side, uplo, alpha, A, B, beta, C, opts);
+    }
+
     if (side == Side::Left) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
@@ -173,6 +191,40 @@ void hemm(Side side,
     }
 }
 
+/**
+ * Hermitian matrix-matrix multiply using the packed gemm engine.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute the
+ *        tiles of C.
+ *
+ * @see hemm(
+    Side side,
+    Uplo uplo,
+    const alpha_t& alpha, const matrixA_t& A, const matrixB_t& B,
+    const beta_t& beta, matrixC_t& C )
+ * @see hemm_blocked()
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void hemm(Side side,
+          Uplo uplo,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          const matrixB_t& B,
+          const beta_t& beta,
+          matrixC_t& C,
+          const GemmBlockedOpts& opts)
+{
+    return hemm_blocked(side, uplo, alpha, A, B, beta, C, opts);
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 /**
@@ -0,0 +1,102 @@
+/// @file hemm_blocked.hpp Blocked Hermitian matrix-matrix multiply.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_HEMM_BLOCKED_HH
+#define TLAPACK_BLAS_HEMM_BLOCKED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/symm_blocked.hpp"
+
+namespace tlapack {
+
+/**
+ * Hermitian matrix-matrix multiply using the packed gemm engine:
+ * \[
+ *     C := \alpha A B + \beta C,
+ * \]
+ * or
+ * \[
+ *     C := \alpha B A + \beta C,
+ * \]
+ * where alpha and beta are scalars, A is an m-by-m or n-by-n Hermitian matrix,
+ * and B and C are m-by-n matrices.
+ *
+ * @param[in] side
+ *     The side the matrix A appears on:
+ *     - Side::Left:  $C = \alpha A B + \beta C$,
+ *     - Side::Right: $C = \alpha B A + \beta C$.
+ *
+ * @param[in] uplo
+ *     What part of the matrix A is referenced:
+ *     - Uplo::Lower: only the lower triangular part of A is referenced.
+ *     - Uplo::Upper: only the upper triangular part of A is referenced.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A
+ *     - If side = Left:  A m-by-m Hermitian matrix.
+ *     - If side = Right: A n-by-n Hermitian matrix.
+ *     Imaginary parts of the diagonal elements need not be set and are
+ *     assumed to be zero.
+ * @param[in] B A m-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix.
+ * @param[in] opts Options.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute the
+ *        tiles of C.
+ *
+ * @see symm_blocked()
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void hemm_blocked(Side side,
+                  Uplo uplo,
+                  const alpha_t& alpha,
+                  const matrixA_t& A,
+                  const matrixB_t& B,
+                  const beta_t& beta,
+                  matrixC_t& C,
+                  const GemmBlockedOpts& opts = {})
+{
+    // data traits
+    using idx_t = size_type<matrixC_t>;
+
+    // constants
+    const idx_t m = nrows(B);
+    const idx_t n = ncols(B);
+    const Uplo uploA = (uplo == Uplo::Lower) ? Uplo::Lower : Uplo::Upper;
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper &&
+                        uplo != Uplo::General);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
+    tlapack_check_false(nrows(C) != m);
+    tlapack_check_false(ncols(C) != n);
+
+    const internal::SymmetricView<matrixA_t> fullA{A, uploA, true};
+    if (side == Side::Left)
+        internal::gemm_blocked_engine(Uplo::General, Op::NoTrans, Op::NoTrans,
+                                      alpha, fullA, B, beta, C, idx_t(0), m,
+                                      idx_t(0), n, idx_t(0), m, opts);
+    else
+        internal::gemm_blocked_engine(Uplo::General, Op::NoTrans, Op::NoTrans,
+                                      alpha, B, fullA, beta, C, idx_t(0), m,
+                                      idx_t(0), n, idx_t(0), n, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_HEMM_BLOCKED_HH
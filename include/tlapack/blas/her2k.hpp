@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_HER2K_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm_blocked.hpp"
 
 namespace tlapack {
 
@@ -52,6 +53,11 @@ namespace tlapack {
  *     Imaginary parts of the diagonal elements need not be set,
  *     are assumed to be zero on entry, and are set to zero on exit.
  *
+ * @note If n and k are at least GemmBlockedOpts::nx, the update is computed by
+ * the packed gemm engine, restricted to the referenced triangle of C. Use the
+ * overload with a GemmBlockedOpts argument to set the block sizes and the
+ * number of threads.
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -95,6 +101,17 @@ void her2k(Uplo uplo,
     tlapack_check_false(nrows(C) != ncols(C));
     tlapack_check_false(nrows(C) != n);
 
+    tlapack_trace("her2k", internal::trace_flops<TC>(2. * n * n * k),
+                  sizeof(TC) * (2. * n * k + double(n) * n));
+
+    // Large problems go through the packed and cache-blocked engine
+    {
+        const GemmBlockedOpts opts;
+        const idx_t nx = opts.nx;
+        if (n >= nx && k >= nx)
+            return her2k(uplo, trans, alpha, A, B, beta, C, opts);
+    }
+
     if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
@@ -192,6 +209,79 @@ void her2k(Uplo uplo,
     }
 }
 
+/**
+ * Hermitian rank-2k update using the packed gemm engine, restricted to the
+ * referenced triangle of C.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute the
+ *        tiles of C.
+ *
+ * @see her2k(
+    Uplo uplo,
+    Op trans,
+    const alpha_t& alpha, const matrixA_t& A, const matrixB_t& B,
+    const beta_t& beta, matrixC_t& C )
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_REAL beta_t,
+          enable_if_t<(
+                          /* Requires: */
+                          is_real<beta_t>),
+                      int> = 0>
+void her2k(Uplo uplo,
+           Op trans,
+           const alpha_t& alpha,
+           const matrixA_t& A,
+           const matrixB_t& B,
+           const beta_t& beta,
+           matrixC_t& C,
+           const GemmBlockedOpts& opts)
+{
+    // data traits
+    using TC = type_t<matrixC_t>;
+    using idx_t = size_type<matrixA_t>;
+
+    // constants
+    const real_type<TC> one(1);
+    const idx_t n = (trans == Op::NoTrans) ? nrows(A) : ncols(A);
+    const idx_t k = (trans == Op::NoTrans) ? ncols(A) : nrows(A);
+    const Uplo uploC = (uplo == Uplo::Lower) ? Uplo::Lower : Uplo::Upper;
+    const Op transB = (trans == Op::NoTrans) ? Op::ConjTrans : Op::NoTrans;
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper &&
+                        uplo != Uplo::General);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::ConjTrans);
+    tlapack_check_false(nrows(B) != nrows(A) || ncols(B) != ncols(A));
+    tlapack_check_false(nrows(C) != ncols(C));
+    tlapack_check_false(nrows(C) != n);
+
+    // C := alpha op(A) op(B)^H + beta C, then C += conj(alpha) op(B) op(A)^H
+    internal::gemm_blocked_engine(uploC, trans, transB, alpha, A, B, beta, C,
+                                  idx_t(0), n, idx_t(0), n, idx_t(0), k, opts);
+    internal::gemm_blocked_engine(uploC, trans, transB, conj(alpha), B, A,
+                                  one, C, idx_t(0), n, idx_t(0), n, idx_t(0),
+                                  k, opts);
+
+    // The diagonal of a Hermitian matrix is real
+    for (idx_t j = 0; j < n; ++j)
+        C(j, j) = TC(real(C(j, j)));
+
+    if (uplo == Uplo::General) {
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = j + 1; i < n; ++i)
+                C(i, j) = conj(C(j, i));
+        }
+    }
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 /**
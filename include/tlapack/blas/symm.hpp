@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_SYMM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/symm_blocked.hpp"
 
 namespace tlapack {
 
@@ -45,6 +46,10 @@ namespace tlapack {
  * @param[in] beta Scalar.
  * @param[in,out] C A m-by-n matrix.
  *
+ * @note If m and n are at least GemmBlockedOpts::nx, the product is computed
+ * by symm_blocked(). Use the overload with a GemmBlockedOpts argument to set the
+ * block sizes and the number of threads.
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -84,6 +89,19 @@ void symm(Side side,
     tlapack_check_false(nrows(C) != m);
     tlapack_check_false(ncols(C) != n);
 
+    tlapack_trace(
+        "symm",
+        internal::trace_flops<TB>(2. * m * n * ((side == Side::Left) ? m : n)),
+        sizeof(TB) * (0.5 * nrows(A) * nrows(A) + 3. * m * n));
+
+    // Large problems go through the packed and cache-blocked engine
+    {
+        const GemmBlockedOpts opts;
+        const idx_t nx = opts.nx;
+        if (m >= nx && n >= nx)
+            return symm_blocked(side, uplo, alpha, A, B, beta, C, opts);
+    }
+
     if (side == Side::Left) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
@@ -171,6 +189,40 @@ void symm(Side side,
     }
 }
 
+/**
+ * Symmetric matrix-matrix multiply using the packed gemm engine.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute the
+ *        tiles of C.
+ *
+ * @see symm(
+    Side side,
+    Uplo uplo,
+    const alpha_t& alpha, const matrixA_t& A, const matrixB_t& B,
+    const beta_t& beta, matrixC_t& C )
+ * @see symm_blocked()
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixC_t,
+          TLAPACK_SCALAR alpha_t,
+          TLAPACK_SCALAR beta_t>
+void symm(Side side,
+          Uplo uplo,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          const matrixB_t& B,
+          const beta_t& beta,
+          matrixC_t& C,
+          const GemmBlockedOpts& opts)
+{
+    return symm_blocked(side, uplo, alpha, A, B, beta, C, opts);
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 /**
@@ -86,6 +86,9 @@ void syr2k(Uplo uplo,
     tlapack_check_false(nrows(C) != ncols(C));
     tlapack_check_false(nrows(C) != n);
 
+    tlapack_trace("syr2k", internal::trace_flops<TB>(2. * n * n * k),
+                  sizeof(TB) * (2. * n * k + double(n) * n));
+
     if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
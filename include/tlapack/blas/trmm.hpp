@@ -12,6 +12,7 @@
 #define TLAPACK_BLAS_TRMM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trmm_blocked.hpp"
 
 namespace tlapack {
 
@@ -60,6 +61,11 @@ namespace tlapack {
  *     - If side = Right: a n-by-n matrix.
  * @param[in,out] B A m-by-n matrix.
  *
+ * @note If m and n are at least GemmBlockedOpts::nx and A is larger than
+ * GemmBlockedOpts::nb, the result is computed by trmm_blocked(). Use the
+ * overload with a GemmBlockedOpts argument to set the block sizes and the
+ * number of threads.
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -95,6 +101,28 @@ void trmm(Side side,
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
 
+    tlapack_trace(
+        "trmm",
+        internal::trace_flops<TB>(double(m) * n * ((side == Side::Left) ? m : n)),
+        sizeof(TB) * (0.5 * nrows(A) * nrows(A) + 2. * m * n));
+
+    if constexpr (internal::use_transposed_problem<matrixB_t, matrixA_t>) {
+        // Row-major B: compute the transposed product on the other side
+        // instead
+        auto Bt = transpose_view(B);
+        return trmm((side == Side::Left) ? Side::Right : Side::Left,
+                    (uplo == Uplo::Lower) ? Uplo::Upper : Uplo::Lower, trans,
+                    diag, alpha, transpose_view(A), Bt);
+    }
+    else {
+        // Large problems go through the blocked algorithm
+        const GemmBlockedOpts opts;
+        const idx_t nx = opts.nx;
+        const idx_t nb = opts.nb;
+        if (m >= nx && n >= nx && (idx_t)nrows(A) > nb)
+            return trmm_blocked(side, uplo, trans, diag, alpha, A, B, opts);
+    }
+
     if (side == Side::Left) {
         if (trans == Op::NoTrans) {
             using scalar_t = scalar_type<alpha_t, TB>;
@@ -279,6 +307,42 @@ void trmm(Side side,
     }
 }
 
+/**
+ * Triangular matrix-matrix multiply using the blocked algorithm.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: size of the diagonal blocks.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes of the updates.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute tiles of
+ *        columns (side = Left) or rows (side = Right) of B.
+ *
+ * @see trmm(
+    Side side,
+    Uplo uplo,
+    Op trans,
+    Diag diag,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    matrixB_t& B )
+ * @see trmm_blocked()
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_SCALAR alpha_t>
+void trmm(Side side,
+          Uplo uplo,
+          Op trans,
+          Diag diag,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          matrixB_t& B,
+          const GemmBlockedOpts& opts)
+{
+    return trmm_blocked(side, uplo, trans, diag, alpha, A, B, opts);
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 /**
@@ -12,6 +12,8 @@
 #define TLAPACK_BLAS_TRSM_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trsm_blocked.hpp"
+#include "tlapack/blas/trsm_static.hpp"
 
 namespace tlapack {
 
@@ -64,6 +66,13 @@ namespace tlapack {
  *      On entry, the m-by-n matrix B.
  *      On exit,  the m-by-n matrix X.
  *
+ * @note If m and n are at least GemmBlockedOpts::nx and A is larger than
+ * GemmBlockedOpts::nb, the result is computed by trsm_blocked(). Use the
+ * overload with a GemmBlockedOpts argument to set the block sizes and the
+ * number of threads.
+ * If the sizes of A and B are known at compile time and are at most
+ * internal::max_static_size, the result is computed by trsm_static().
+ *
  * @ingroup blas3
  */
 template <TLAPACK_MATRIX matrixA_t,
@@ -98,6 +107,31 @@ void trsm(Side side,
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(nrows(A) != ((side == Side::Left) ? m : n));
 
+    tlapack_trace(
+        "trsm",
+        internal::trace_flops<TB>(double(m) * n * ((side == Side::Left) ? m : n)),
+        sizeof(TB) * (0.5 * nrows(A) * nrows(A) + 2. * m * n));
+
+    // Small matrices of fixed size go through unrolled kernels
+    if constexpr (internal::use_static_kernels<matrixA_t, matrixB_t>)
+        return trsm_static<static_nrows<matrixB_t>, static_ncols<matrixB_t>>(
+            side, uplo, trans, diag, alpha, A, B);
+    else if constexpr (internal::use_transposed_problem<matrixB_t, matrixA_t>) {
+        // Row-major B: solve the transposed system on the other side instead
+        auto Bt = transpose_view(B);
+        return trsm((side == Side::Left) ? Side::Right : Side::Left,
+                    (uplo == Uplo::Lower) ? Uplo::Upper : Uplo::Lower, trans,
+                    diag, alpha, transpose_view(A), Bt);
+    }
+    else {
+        // Large problems go through the blocked algorithm
+        const GemmBlockedOpts opts;
+        const idx_t nx = opts.nx;
+        const idx_t nb = opts.nb;
+        if (m >= nx && n >= nx && (idx_t)nrows(A) > nb)
+            return trsm_blocked(side, uplo, trans, diag, alpha, A, B, opts);
+    }
+
     if (side == Side::Left) {
         using scalar_t = scalar_type<alpha_t, TB>;
         if (trans == Op::NoTrans) {
@@ -265,6 +299,42 @@ void trsm(Side side,
     }
 }
 
+/**
+ * Triangular solve using the blocked algorithm.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: size of the diagonal blocks.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes of the updates.
+ *      - @c opts.num_threads, @c opts.pool: threads used to compute tiles of
+ *        columns (side = Left) or rows (side = Right) of B.
+ *
+ * @see trsm(
+    Side side,
+    Uplo uplo,
+    Op trans,
+    Diag diag,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    matrixB_t& B )
+ * @see trsm_blocked()
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_SCALAR alpha_t>
+void trsm(Side side,
+          Uplo uplo,
+          Op trans,
+          Diag diag,
+          const alpha_t& alpha,
+          const matrixA_t& A,
+          matrixB_t& B,
+          const GemmBlockedOpts& opts)
+{
+    return trsm_blocked(side, uplo, trans, diag, alpha, A, B, opts);
+}
+
 #ifdef TLAPACK_USE_LAPACKPP
 
 template <TLAPACK_LEGACY_MATRIX matrixA_t,
@@ -0,0 +1,166 @@
+/// @file trsm_batched.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_TRSM_BATCHED_HH
+#define TLAPACK_BLAS_TRSM_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /**
+     * @brief Solves op(A_b) X_b = alpha B_b or X_b op(A_b) = alpha B_b for
+     * the matrices b0:b1 of the batches A and B.
+     *
+     * The solution overwrites B_b. B_b is m-by-n.
+     */
+    template <Op op, class batchA_t, class batchB_t, class alpha_t>
+    void trsm_batched_kernel(Side side,
+                             Uplo uplo,
+                             Diag diag,
+                             const alpha_t& alpha,
+                             const batchA_t& A,
+                             const batchB_t& B,
+                             size_t m,
+                             size_t n,
+                             size_t b0,
+                             size_t b1)
+    {
+        // op(A) is lower triangular
+        const bool lower = ((uplo == Uplo::Lower) == (op == Op::NoTrans));
+        const bool nonunit = (diag == Diag::NonUnit);
+
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < m; ++i)
+                for (size_t b = b0; b < b1; ++b)
+                    B(b, i, j) *= alpha;
+
+        if (side == Side::Left) {
+            for (size_t j = 0; j < n; ++j) {
+                for (size_t kk = 0; kk < m; ++kk) {
+                    const size_t k = lower ? kk : m - 1 - kk;
+                    if (nonunit)
+                        for (size_t b = b0; b < b1; ++b)
+                            B(b, k, j) /= op_entry<op>(A, b, k, k);
+                    const size_t i0 = lower ? k + 1 : 0;
+                    const size_t i1 = lower ? m : k;
+                    for (size_t i = i0; i < i1; ++i)
+                        for (size_t b = b0; b < b1; ++b)
+                            B(b, i, j) -= B(b, k, j) * op_entry<op>(A, b, i, k);
+                }
+            }
+        }
+        else {
+            for (size_t jj = 0; jj < n; ++jj) {
+                const size_t j = lower ? n - 1 - jj : jj;
+                const size_t k0 = lower ? j + 1 : 0;
+                const size_t k1 = lower ? n : j;
+                for (size_t k = k0; k < k1; ++k)
+                    for (size_t i = 0; i < m; ++i)
+                        for (size_t b = b0; b < b1; ++b)
+                            B(b, i, j) -= B(b, i, k) * op_entry<op>(A, b, k, j);
+                if (nonunit)
+                    for (size_t i = 0; i < m; ++i)
+                        for (size_t b = b0; b < b1; ++b)
+                            B(b, i, j) /= op_entry<op>(A, b, j, j);
+            }
+        }
+    }
+
+}  // namespace internal
+
+/**
+ * Batched solution of triangular systems:
+ * \[
+ *     op(A_b) X_b = \alpha B_b \quad\text{or}\quad X_b op(A_b) = \alpha B_b,
+ * \]
+ * for each matrix b of the batches A and B. See trsm().
+ *
+ * @param[in] side
+ *     Whether $op(A)$ is on the left or right of X:
+ *     - Side::Left:  $op(A) X = B$.
+ *     - Side::Right: $X op(A) = B$.
+ *
+ * @param[in] uplo
+ *     - Uplo::Upper: A is an upper triangular matrix.
+ *     - Uplo::Lower: A is a lower triangular matrix.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] diag
+ *     Whether A has a unit or non-unit diagonal:
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A Batch of triangular matrices.
+ *     - If side = Left: each A_b is m-by-m.
+ *     - If side = Right: each A_b is n-by-n.
+ * @param[in,out] B Batch of m-by-n matrices.
+ *     On entry, the matrices B_b.
+ *     On exit, overwritten by the solutions X_b.
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @ingroup blas3
+ */
+template <class batchA_t, class batchB_t, TLAPACK_SCALAR alpha_t>
+void trsm_batched(Side side,
+                  Uplo uplo,
+                  Op trans,
+                  Diag diag,
+                  const alpha_t& alpha,
+                  const batchA_t& A,
+                  batchB_t& B,
+                  const BatchOpts& opts = {})
+{
+    const auto A_ = internal::batch_view(A);
+    const auto B_ = internal::batch_view(B);
+    const size_t count = internal::batch_count(B_);
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false(internal::batch_count(A_) != count);
+
+    // Quick return
+    if (count == 0) return;
+
+    // constants
+    const size_t m = internal::batch_nrows(B_);
+    const size_t n = internal::batch_ncols(B_);
+
+    // check arguments
+    tlapack_check_false(side == Side::Left ? !internal::batch_is(A_, m, m)
+                                           : !internal::batch_is(A_, n, n));
+    tlapack_check_false(!internal::batch_is(B_, m, n));
+
+    internal::dispatch_op(trans, [&](auto op) {
+        constexpr Op o = decltype(op)::value;
+        internal::batch_for_each(
+            count, opts,
+            [&](size_t b0, size_t b1, size_t, const auto& A, const auto& B) {
+                internal::trsm_batched_kernel<o>(side, uplo, diag, alpha, A, B,
+                                                 m, n, b0, b1);
+            },
+            A_, B_);
+    });
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_TRSM_BATCHED_HH
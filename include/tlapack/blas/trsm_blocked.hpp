@@ -0,0 +1,301 @@
+/// @file trsm_blocked.hpp Blocked triangular solve with multiple right-hand
+/// sides.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_TRSM_BLOCKED_HH
+#define TLAPACK_BLAS_TRSM_BLOCKED_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm_blocked.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /**
+     * @brief Solves op(A)(k0:k1,k0:k1) X = B(k0:k1,j0:j1) in place.
+     *
+     * @param[in] lowerOpA True if op(A) is lower triangular.
+     */
+    template <class matrixA_t, class matrixB_t, class idx_t>
+    void trsm_left_diag_block(bool lowerOpA,
+                              Op trans,
+                              Diag diag,
+                              const matrixA_t& A,
+                              matrixB_t& B,
+                              idx_t k0,
+                              idx_t k1,
+                              idx_t j0,
+                              idx_t j1)
+    {
+        using scalar_t = scalar_type<type_t<matrixA_t>, type_t<matrixB_t>>;
+
+        for (idx_t j = j0; j < j1; ++j) {
+            if (lowerOpA) {
+                for (idx_t i = k0; i < k1; ++i) {
+                    scalar_t x = B(i, j);
+                    for (idx_t l = k0; l < i; ++l)
+                        x -= op_entry(trans, A, i, l) * B(l, j);
+                    if (diag == Diag::NonUnit) x /= op_entry(trans, A, i, i);
+                    B(i, j) = x;
+                }
+            }
+            else {
+                for (idx_t i = k1; i-- > k0;) {
+                    scalar_t x = B(i, j);
+                    for (idx_t l = i + 1; l < k1; ++l)
+                        x -= op_entry(trans, A, i, l) * B(l, j);
+                    if (diag == Diag::NonUnit) x /= op_entry(trans, A, i, i);
+                    B(i, j) = x;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Solves X op(A)(k0:k1,k0:k1) = B(i0:i1,k0:k1) in place.
+     *
+     * @param[in] lowerOpA True if op(A) is lower triangular.
+     */
+    template <class matrixA_t, class matrixB_t, class idx_t>
+    void trsm_right_diag_block(bool lowerOpA,
+                               Op trans,
+                               Diag diag,
+                               const matrixA_t& A,
+                               matrixB_t& B,
+                               idx_t k0,
+                               idx_t k1,
+                               idx_t i0,
+                               idx_t i1)
+    {
+        using TA = type_t<matrixA_t>;
+
+        if (!lowerOpA) {
+            for (idx_t j = k0; j < k1; ++j) {
+                for (idx_t l = k0; l < j; ++l) {
+                    const TA alj = op_entry(trans, A, l, j);
+                    for (idx_t i = i0; i < i1; ++i)
+                        B(i, j) -= B(i, l) * alj;
+                }
+                if (diag == Diag::NonUnit) {
+                    const TA ajj = op_entry(trans, A, j, j);
+                    for (idx_t i = i0; i < i1; ++i)
+                        B(i, j) /= ajj;
+                }
+            }
+        }
+        else {
+            for (idx_t j = k1; j-- > k0;) {
+                for (idx_t l = j + 1; l < k1; ++l) {
+                    const TA alj = op_entry(trans, A, l, j);
+                    for (idx_t i = i0; i < i1; ++i)
+                        B(i, j) -= B(i, l) * alj;
+                }
+                if (diag == Diag::NonUnit) {
+                    const TA ajj = op_entry(trans, A, j, j);
+                    for (idx_t i = i0; i < i1; ++i)
+                        B(i, j) /= ajj;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Solves op(A) X = alpha B(:,b0:b1) if side = Left, or
+     * X op(A) = alpha B(b0:b1,:) if side = Right, in place.
+     *
+     * @see trsm_blocked() for the description of the other parameters.
+     */
+    template <class matrixA_t, class matrixB_t, class alpha_t, class idx_t>
+    void trsm_blocked_work(Side side,
+                           Uplo uplo,
+                           Op trans,
+                           Diag diag,
+                           const alpha_t& alpha,
+                           const matrixA_t& A,
+                           matrixB_t& B,
+                           idx_t b0,
+                           idx_t b1,
+                           const GemmBlockedOpts& opts)
+    {
+        // data traits
+        using TB = type_t<matrixB_t>;
+        using real_t = real_type<TB>;
+
+        // constants
+        const real_t one(1);
+        const idx_t i0 = (side == Side::Left) ? idx_t(0) : b0;
+        const idx_t j0 = (side == Side::Left) ? b0 : idx_t(0);
+        const idx_t m = (side == Side::Left) ? idx_t(nrows(B)) : b1 - b0;
+        const idx_t n = (side == Side::Left) ? b1 - b0 : idx_t(ncols(B));
+        const idx_t nb = max<idx_t>(opts.nb, 1);
+        const bool lowerOpA = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+
+        // B := alpha B
+        for (idx_t j = j0; j < j0 + n; ++j)
+            for (idx_t i = i0; i < i0 + m; ++i)
+                B(i, j) *= alpha;
+
+        if (side == Side::Left) {
+            if (lowerOpA) {
+                for (idx_t k0 = 0; k0 < m; k0 += nb) {
+                    const idx_t k1 = min(k0 + nb, m);
+                    trsm_left_diag_block(lowerOpA, trans, diag, A, B, k0, k1,
+                                         j0, j0 + n);
+                    // B(k1:m,:) -= op(A)(k1:m,k0:k1) B(k0:k1,:)
+                    gemm_blocked_engine(Uplo::General, trans, Op::NoTrans, -one,
+                                        A, B, one, B, k1, m - k1, j0, n, k0,
+                                        k1 - k0, opts);
+                }
+            }
+            else {
+                for (idx_t k1 = m; k1 > 0;) {
+                    const idx_t k0 = (k1 > nb) ? k1 - nb : 0;
+                    trsm_left_diag_block(lowerOpA, trans, diag, A, B, k0, k1,
+                                         j0, j0 + n);
+                    // B(0:k0,:) -= op(A)(0:k0,k0:k1) B(k0:k1,:)
+                    gemm_blocked_engine(Uplo::General, trans, Op::NoTrans, -one,
+                                        A, B, one, B, idx_t(0), k0, j0, n, k0,
+                                        k1 - k0, opts);
+                    k1 = k0;
+                }
+            }
+        }
+        else {  // side == Side::Right
+            if (!lowerOpA) {
+                for (idx_t k0 = 0; k0 < n; k0 += nb) {
+                    const idx_t k1 = min(k0 + nb, n);
+                    trsm_right_diag_block(lowerOpA, trans, diag, A, B, k0, k1,
+                                          i0, i0 + m);
+                    // B(:,k1:n) -= B(:,k0:k1) op(A)(k0:k1,k1:n)
+                    gemm_blocked_engine(Uplo::General, Op::NoTrans, trans, -one,
+                                        B, A, one, B, i0, m, k1, n - k1, k0,
+                                        k1 - k0, opts);
+                }
+            }
+            else {
+                for (idx_t k1 = n; k1 > 0;) {
+                    const idx_t k0 = (k1 > nb) ? k1 - nb : 0;
+                    trsm_right_diag_block(lowerOpA, trans, diag, A, B, k0, k1,
+                                          i0, i0 + m);
+                    // B(:,0:k0) -= B(:,k0:k1) op(A)(k0:k1,0:k0)
+                    gemm_blocked_engine(Uplo::General, Op::NoTrans, trans, -one,
+                                        B, A, one, B, i0, m, idx_t(0), k0, k0,
+                                        k1 - k0, opts);
+                    k1 = k0;
+                }
+            }
+        }
+    }
+
+}  // namespace internal
+
+/**
+ * Solve the triangular matrix-vector equation using a blocked algorithm
+ * \[
+ *     op(A) X = \alpha B,
+ * \]
+ * or
+ * \[
+ *     X op(A) = \alpha B,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$,
+ * X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
+ * upper or lower triangular matrix.
+ *
+ * The diagonal blocks of size @c opts.nb are solved with unblocked loops, and
+ * the remaining part of B is updated with the packed gemm engine.
+ *
+ * @param[in] side
+ *     Whether $op(A)$ is on the left or right of X:
+ *     - Side::Left:  $op(A) X = B$.
+ *     - Side::Right: $X op(A) = B$.
+ * @param[in] uplo
+ *     - Uplo::Upper: A is an upper triangular matrix.
+ *     - Uplo::Lower: A is a lower triangular matrix.
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ * @param[in] diag
+ *     Whether A has a unit or non-unit diagonal:
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ * @param[in] alpha Scalar.
+ * @param[in] A
+ *     - If side = Left: a m-by-m matrix.
+ *     - If side = Right: a n-by-n matrix.
+ * @param[in,out] B
+ *      On entry, the m-by-n matrix B.
+ *      On exit,  the m-by-n matrix X.
+ * @param[in] opts Options.
+ *      - @c opts.nb: size of the diagonal blocks.
+ *      - @c opts.mc, @c opts.kc, @c opts.nc: cache block sizes of the updates.
+ *      - @c opts.num_threads, @c opts.pool: threads used to solve for tiles of
+ *        columns (side = Left) or rows (side = Right) of B.
+ *
+ * @ingroup blas3
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_SCALAR alpha_t>
+void trsm_blocked(Side side,
+                  Uplo uplo,
+                  Op trans,
+                  Diag diag,
+                  const alpha_t& alpha,
+                  const matrixA_t& A,
+                  matrixB_t& B,
+                  const GemmBlockedOpts& opts = {})
+{
+    // data traits
+    using idx_t = size_type<matrixB_t>;
+
+    // constants
+    const idx_t m = nrows(B);
+    const idx_t n = ncols(B);
+    const idx_t k = (side == Side::Left) ? m : n;
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(A) != k);
+
+    if (internal::gemm_use_threads(opts, m, n, k)) {
+        // The columns (side = Left) or the rows (side = Right) of B are
+        // independent, so tiles of them are solved concurrently
+        GemmBlockedOpts tileOpts = opts;
+        tileOpts.num_threads = 1;
+        const bool left = (side == Side::Left);
+        internal::gemm_parallel_tiles(
+            opts, m, n, left ? m : idx_t(16), left ? idx_t(16) : n,
+            internal::gemm_num_threads(opts),
+            [&](idx_t i0, idx_t mb, idx_t j0, idx_t nb) {
+                internal::trsm_blocked_work(
+                    side, uplo, trans, diag, alpha, A, B, left ? j0 : i0,
+                    left ? j0 + nb : i0 + mb, tileOpts);
+            });
+    }
+    else
+        internal::trsm_blocked_work(side, uplo, trans, diag, alpha, A, B,
+                                    idx_t(0), (side == Side::Left) ? n : m,
+                                    opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_TRSM_BLOCKED_HH
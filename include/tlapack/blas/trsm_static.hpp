@@ -0,0 +1,173 @@
+/// @file trsm_static.hpp Triangular solve for matrices of fixed size.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_BLAS_TRSM_STATIC_HH
+#define TLAPACK_BLAS_TRSM_STATIC_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/**
+ * Solve the triangular matrix-vector equation for matrices of sizes known at
+ * compile time
+ * \[
+ *     op(A) X = \alpha B,
+ * \]
+ * or
+ * \[
+ *     X op(A) = \alpha B,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$,
+ * X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
+ * upper or lower triangular matrix. See trsm().
+ *
+ * The substitutions are unrolled at compile time. trsm() calls this routine
+ * when the sizes of A and B are known at compile time and are at most
+ * internal::max_static_size.
+ *
+ * @tparam m Number of rows of B.
+ * @tparam n Number of columns of B.
+ *
+ * @param[in] side
+ *     Whether $op(A)$ is on the left or right of X:
+ *     - Side::Left:  $op(A) X = B$.
+ *     - Side::Right: $X op(A) = B$.
+ *
+ * @param[in] uplo
+ *     - Uplo::Lower: A is lower triangular.
+ *     - Uplo::Upper: A is upper triangular.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] diag
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A
+ *     - If side = Left: a m-by-m matrix.
+ *     - If side = Right: a n-by-n matrix.
+ * @param[in,out] B
+ *      On entry, the m-by-n matrix B.
+ *      On exit,  the m-by-n matrix X.
+ *
+ * @ingroup blas3
+ */
+template <int m,
+          int n,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_SCALAR alpha_t>
+void trsm_static(Side side,
+                 Uplo uplo,
+                 Op trans,
+                 Diag diag,
+                 const alpha_t& alpha,
+                 const matrixA_t& A,
+                 matrixB_t& B)
+{
+    static_assert(m >= 0 && n >= 0);
+
+    // check arguments
+    tlapack_check_false(side != Side::Left && side != Side::Right);
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false((int)nrows(B) != m);
+    tlapack_check_false((int)ncols(B) != n);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false((int)nrows(A) != ((side == Side::Left) ? m : n));
+
+    // op(A) is lower triangular
+    const bool lower = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+    const bool nonunit = (diag == Diag::NonUnit);
+
+    internal::dispatch_op(trans, [&](auto opA) {
+        constexpr Op op = decltype(opA)::value;
+
+        // Entry (i,j) of op(A)
+        auto a = [&](int i, int j) { return internal::op_entry<op>(A, i, j); };
+
+        internal::static_for<0, m>([&](auto i_) {
+            constexpr int i = i_;
+            internal::static_for<0, n>([&](auto j_) {
+                constexpr int j = j_;
+                B(i, j) *= alpha;
+            });
+        });
+
+        if (side == Side::Left) {
+            internal::static_for<0, n>([&](auto j_) {
+                constexpr int j = j_;
+                if (lower) {
+                    // Forward substitution
+                    internal::static_for<0, m>([&](auto i_) {
+                        constexpr int i = i_;
+                        internal::static_for<0, i>([&](auto l_) {
+                            constexpr int l = l_;
+                            B(i, j) -= a(i, l) * B(l, j);
+                        });
+                        if (nonunit) B(i, j) /= a(i, i);
+                    });
+                }
+                else {
+                    // Backward substitution
+                    internal::static_for<0, m>([&](auto ii_) {
+                        constexpr int i = m - 1 - ii_;
+                        internal::static_for<i + 1, m>([&](auto l_) {
+                            constexpr int l = l_;
+                            B(i, j) -= a(i, l) * B(l, j);
+                        });
+                        if (nonunit) B(i, j) /= a(i, i);
+                    });
+                }
+            });
+        }
+        else {
+            internal::static_for<0, m>([&](auto i_) {
+                constexpr int i = i_;
+                if (!lower) {
+                    // Forward substitution
+                    internal::static_for<0, n>([&](auto j_) {
+                        constexpr int j = j_;
+                        internal::static_for<0, j>([&](auto l_) {
+                            constexpr int l = l_;
+                            B(i, j) -= B(i, l) * a(l, j);
+                        });
+                        if (nonunit) B(i, j) /= a(j, j);
+                    });
+                }
+                else {
+                    // Backward substitution
+                    internal::static_for<0, n>([&](auto jj_) {
+                        constexpr int j = n - 1 - jj_;
+                        internal::static_for<j + 1, n>([&](auto l_) {
+                            constexpr int l = l_;
+                            B(i, j) -= B(i, l) * a(l, j);
+                        });
+                        if (nonunit) B(i, j) /= a(j, j);
+                    });
+                }
+            });
+        }
+    });
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_BLAS_TRSM_STATIC_HH
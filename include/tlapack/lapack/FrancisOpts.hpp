@@ -13,6 +13,8 @@
 #include <cmath>
 #include <functional>
 
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 
 namespace tlapack {
@@ -22,29 +24,49 @@ namespace tlapack {
  */
 struct FrancisOpts {
     /// Function that returns the number of shifts to use
-    /// for a given matrix size
+    /// for a given matrix size. Uses the tuning parameter
+    /// multishift_qr.nshifts if it is set for size n
     std::function<size_t(size_t, size_t)> nshift_recommender =
         [](size_t n, size_t nh) -> size_t {
-        if (n < 30) return 2;
-        if (n < 60) return 4;
-        if (n < 150) return 10;
-        if (n < 590) return size_t(n / std::log2(n));
-        if (n < 3000) return 64;
-        if (n < 6000) return 128;
-        return 256;
+        size_t ns;
+        if (n < 30)
+            ns = 2;
+        else if (n < 60)
+            ns = 4;
+        else if (n < 150)
+            ns = 10;
+        else if (n < 590)
+            ns = size_t(n / std::log2(n));
+        else if (n < 3000)
+            ns = 64;
+        else if (n < 6000)
+            ns = 128;
+        else
+            ns = 256;
+        return tuned("multishift_qr.nshifts", n, ns);
     };
 
-    /// Function that returns the number of shifts to use
-    /// for a given matrix size
+    /// Function that returns the size of the deflation window
+    /// for a given matrix size. Uses the tuning parameter
+    /// multishift_qr.nw if it is set for size n
     std::function<size_t(size_t, size_t)> deflation_window_recommender =
         [](size_t n, size_t nh) -> size_t {
-        if (n < 30) return 2;
-        if (n < 60) return 4;
-        if (n < 150) return 10;
-        if (n < 590) return size_t(n / std::log2(n));
-        if (n < 3000) return 96;
-        if (n < 6000) return 192;
-        return 384;
+        size_t nw;
+        if (n < 30)
+            nw = 2;
+        else if (n < 60)
+            nw = 4;
+        else if (n < 150)
+            nw = 10;
+        else if (n < 590)
+            nw = size_t(n / std::log2(n));
+        else if (n < 3000)
+            nw = 96;
+        else if (n < 6000)
+            nw = 192;
+        else
+            nw = 384;
+        return tuned("multishift_qr.nw", n, nw);
     };
 
     // On exit of the routine. Stores the number of times AED and sweep were
@@ -57,6 +79,13 @@ struct FrancisOpts {
     size_t nmin = 75;
     /// Threshold of percent of AED window that must converge to skip a sweep
     size_t nibble = 14;
+
+    /// Number of threads used to update the parts of A and Z away from the
+    /// diagonal after each chain of bulges and each AED. If 0, use all threads
+    /// of the pool. The default runs the updates in the calling thread
+    size_t num_threads = 1;
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
 };
 
 // Forward declarations:
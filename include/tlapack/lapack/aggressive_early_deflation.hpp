@@ -11,7 +11,6 @@
 #define TLAPACK_AED_HH
 
 #include "tlapack/base/utils.hpp"
-#include "tlapack/blas/gemm.hpp"
 #include "tlapack/lapack/FrancisOpts.hpp"
 #include "tlapack/lapack/gehd2.hpp"
 #include "tlapack/lapack/gehrd.hpp"
@@ -21,6 +20,7 @@
 #include "tlapack/lapack/larfg.hpp"
 #include "tlapack/lapack/laset.hpp"
 #include "tlapack/lapack/multishift_qr.hpp"
+#include "tlapack/lapack/multishift_qr_far_update.hpp"
 #include "tlapack/lapack/schur_move.hpp"
 #include "tlapack/lapack/schur_swap.hpp"
 #include "tlapack/lapack/unghr.hpp"
@@ -205,6 +205,8 @@ void aggressive_early_deflation_work(bool want_t,
     }
     tlapack_check((idx_t)size(s) == n);
 
+    tlapack_trace("aggressive_early_deflation", 0, 2. * sizeof(T) * jw * jw);
+
     // s is the value just outside the window. It determines the spike
     // together with the orthogonal schur factors.
     T s_spike;
@@ -457,45 +459,8 @@ void aggressive_early_deflation_work(bool want_t,
         istart_m = ilo;
         istop_m = ihi;
     }
-    // Horizontal multiply
-    if (ihi < istop_m) {
-        idx_t i = ihi;
-        while (i < istop_m) {
-            idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-            auto A_slice = slice(A, range{kwtop, ihi}, range{i, i + iblock});
-            auto WH_slice =
-                slice(WH, range{0, nrows(A_slice)}, range{0, ncols(A_slice)});
-            gemm(CONJ_TRANS, NO_TRANS, one, V, A_slice, WH_slice);
-            lacpy(GENERAL, WH_slice, A_slice);
-            i = i + iblock;
-        }
-    }
-    // Vertical multiply
-    if (istart_m < kwtop) {
-        idx_t i = istart_m;
-        while (i < kwtop) {
-            idx_t iblock = std::min<idx_t>(kwtop - i, nrows(WV));
-            auto A_slice = slice(A, range{i, i + iblock}, range{kwtop, ihi});
-            auto WV_slice =
-                slice(WV, range{0, nrows(A_slice)}, range{0, ncols(A_slice)});
-            gemm(NO_TRANS, NO_TRANS, one, A_slice, V, WV_slice);
-            lacpy(GENERAL, WV_slice, A_slice);
-            i = i + iblock;
-        }
-    }
-    // Update Z (also a vertical multiplication)
-    if (want_z) {
-        idx_t i = 0;
-        while (i < n) {
-            idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-            auto Z_slice = slice(Z, range{i, i + iblock}, range{kwtop, ihi});
-            auto WV_slice =
-                slice(WV, range{0, nrows(Z_slice)}, range{0, ncols(Z_slice)});
-            gemm(NO_TRANS, NO_TRANS, one, Z_slice, V, WV_slice);
-            lacpy(GENERAL, WV_slice, Z_slice);
-            i = i + iblock;
-        }
-    }
+    internal::multishift_qr_far_update(want_z, A, Z, V, kwtop, istart_m,
+                                       istop_m, WH, WV, opts);
 }
 
 /** @overload void aggressive_early_deflation_work( bool want_t,
@@ -649,7 +614,7 @@ void aggressive_early_deflation(bool want_t,
     // Allocates workspace
     WorkInfo workinfo = aggressive_early_deflation_worksize<T>(
         want_t, want_z, ilo, ihi, nw, A, s, Z, ns, nd, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     aggressive_early_deflation_work(want_t, want_z, ilo, ihi, nw, A, s, Z, ns,
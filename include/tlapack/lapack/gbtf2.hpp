@@ -0,0 +1,139 @@
+/// @file gbtf2.hpp Computes the LU factorization of a general band matrix
+/// using a level-2 algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GBTF2_HH
+#define TLAPACK_GBTF2_HH
+
+#include "tlapack/LegacyBandedMatrix.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /// Sets to zero the kl superdiagonals of A that hold the fill-in of the
+    /// band LU factorization
+    template <typename T, class idx_t>
+    void gbtrf_zero_fillin(LegacyBandedMatrix<T, idx_t>& A)
+    {
+        const idx_t m = A.m;
+        const idx_t n = A.n;
+        const idx_t kv = A.ku;
+        const idx_t ku = A.ku - A.kl;
+
+        for (idx_t j = ku + 1; j < n; ++j) {
+            const idx_t i0 = (j > kv) ? j - kv : 0;
+            const idx_t i1 = min(m, j - ku);
+            for (idx_t i = i0; i < i1; ++i)
+                A(i, j) = T(0);
+        }
+    }
+
+}  // namespace internal
+
+/** Computes an LU factorization of an m-by-n band matrix A with kl
+ * subdiagonals and ku superdiagonals using partial pivoting with row
+ * interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *      A = P L U
+ * \]
+ * where P is a permutation matrix, L is lower triangular with unit diagonal
+ * elements and at most kl nonzeros below the diagonal in each column, and U is
+ * upper triangular with kl+ku superdiagonals.
+ *
+ * This is the level-2 version of gbtrf().
+ *
+ * @param[in,out] A m-by-n band matrix with A.kl = kl subdiagonals and
+ *      A.ku = kl+ku superdiagonals.
+ *      On entry, the band matrix A in the rows 0 to kl+ku of the band storage.
+ *      The first kl superdiagonals of the storage are used for the fill-in
+ *      of U and need not be set on entry, as in LAPACK's DGBTRF.
+ *      On exit, U in the upper band and the multipliers of L in the kl
+ *      subdiagonals. Column j of L is stored before the row interchanges of
+ *      the following columns, as required by gbtrs().
+ *
+ * @param[out] piv Vector of size at least min(m,n).
+ *      Row j of A was interchanged with row piv[j].
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @ingroup computational
+ */
+template <typename T, class idx_t, TLAPACK_VECTOR piv_t>
+int gbtf2(LegacyBandedMatrix<T, idx_t>& A, piv_t& piv)
+{
+    using real_t = real_type<T>;
+
+    // Constants
+    const idx_t m = A.m;
+    const idx_t n = A.n;
+    const idx_t kl = A.kl;
+    const idx_t ku = A.ku - A.kl;
+    const idx_t end = min(m, n);
+
+    // Check arguments
+    tlapack_check_false(A.ku < A.kl);
+    tlapack_check_false((idx_t)size(piv) < end);
+
+    // Quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    internal::gbtrf_zero_fillin(A);
+
+    // ju is the index of the last column affected by the current stage
+    idx_t ju = 0;
+    for (idx_t j = 0; j < end; ++j) {
+        const idx_t km = min(kl, m - 1 - j);
+
+        // Find pivot
+        idx_t p = j;
+        for (idx_t i = j + 1; i <= j + km; ++i)
+            if (abs1(A(i, j)) > abs1(A(p, j))) p = i;
+        piv[j] = p;
+
+        // If nonzero pivot does not exist, return
+        if (A(p, j) == real_t(0)) return j + 1;
+
+        ju = max(ju, min(ku + p, n - 1));
+
+        // Swap rows j and p of the columns j to ju
+        if (p != j) {
+            for (idx_t c = j; c <= ju; ++c) {
+                const T aux = A(j, c);
+                A(j, c) = A(p, c);
+                A(p, c) = aux;
+            }
+        }
+
+        if (km > 0) {
+            // Compute multipliers
+            const T ajj = A(j, j);
+            for (idx_t i = j + 1; i <= j + km; ++i)
+                A(i, j) /= ajj;
+
+            // Update the trailing part of the band
+            for (idx_t c = j + 1; c <= ju; ++c) {
+                const T ajc = A(j, c);
+                if (ajc != real_t(0))
+                    for (idx_t i = j + 1; i <= j + km; ++i)
+                        A(i, c) -= A(i, j) * ajc;
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GBTF2_HH
@@ -0,0 +1,173 @@
+/// @file gbtrf.hpp Computes the LU factorization of a general band matrix
+/// using a blocked algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GBTRF_HH
+#define TLAPACK_GBTRF_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/gbtf2.hpp"
+#include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/laswp.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for gbtrf()
+struct GbtrfOpts {
+    size_t nb = tuned("gbtrf.nb", 32);  ///< Block size
+};
+
+/** Computes an LU factorization of an m-by-n band matrix A with kl
+ * subdiagonals and ku superdiagonals using partial pivoting with row
+ * interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *      A = P L U
+ * \]
+ * where P is a permutation matrix, L is lower triangular with unit diagonal
+ * elements and at most kl nonzeros below the diagonal in each column, and U is
+ * upper triangular with kl+ku superdiagonals.
+ *
+ * The band is factored in blocks of opts.nb columns. Each block only modifies
+ * the rows and columns that overlap the band of the block, i.e., a window of
+ * at most (nb+kl)-by-(nb+kl+ku) entries. The window is copied to a dense
+ * workspace, factored with getrf(), trsm() and gemm(), and copied back, in the
+ * spirit of the work arrays of LAPACK's DGBTRF. The cost is
+ * $O(n \cdot kl \cdot (kl+ku))$ operations and the workspace does not depend
+ * on n. gbtf2() is used if opts.nb <= 1 or opts.nb > kl.
+ *
+ * @param[in,out] A m-by-n band matrix with A.kl = kl subdiagonals and
+ *      A.ku = kl+ku superdiagonals.
+ *      On entry, the band matrix A in the rows 0 to kl+ku of the band storage.
+ *      The first kl superdiagonals of the storage are used for the fill-in
+ *      of U and need not be set on entry, as in LAPACK's DGBTRF.
+ *      On exit, U in the upper band and the multipliers of L in the kl
+ *      subdiagonals. Column j of L is stored before the row interchanges of
+ *      the following columns, as required by gbtrs().
+ *
+ * @param[out] piv Vector of size at least min(m,n).
+ *      Row j of A was interchanged with row piv[j].
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: number of columns in each block.
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @ingroup computational
+ */
+template <typename T, class idx_t, TLAPACK_VECTOR piv_t>
+int gbtrf(LegacyBandedMatrix<T, idx_t>& A,
+          piv_t& piv,
+          const GbtrfOpts& opts = {})
+{
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t m = A.m;
+    const idx_t n = A.n;
+    const idx_t kl = A.kl;
+    const idx_t kv = A.ku;
+    const idx_t end = min(m, n);
+    const idx_t nb = opts.nb;
+
+    // Check arguments
+    tlapack_check_false(A.ku < A.kl);
+    tlapack_check_false((idx_t)size(piv) < end);
+
+    tlapack_trace("gbtrf", internal::trace_flops<T>(2. * end * kl * kv),
+                  sizeof(T) * (double(kl) + kv + 1) * n);
+
+    // Quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    // Unblocked code
+    if (nb <= 1 || nb > kl) return gbtf2(A, piv);
+
+    internal::gbtrf_zero_fillin(A);
+
+    // Workspace for the window of each block
+    Create<LegacyMatrix<T, idx_t>> new_matrix;
+    arena_vector<T> W_;
+    auto W = new_matrix(W_, nb + kl, nb + kv);
+    arena_vector<idx_t> pivb(nb);
+
+    for (idx_t j = 0; j < end; j += nb) {
+        const idx_t jb = min(nb, end - j);
+
+        // Rows and columns modified by the block
+        const idx_t mw = min(m, j + jb + kl) - j;
+        const idx_t nw = min(n, j + jb + kv) - j;
+
+        // Copy the window, with zeros outside the band
+        for (idx_t c = 0; c < nw; ++c)
+            for (idx_t i = 0; i < mw; ++i)
+                W(i, c) = (i <= c + kl && c <= i + kv) ? A(j + i, j + c)
+                                                       : T(0);
+
+        // Factor the panel
+        auto W1 = slice(W, range(0, mw), range(0, jb));
+        for (idx_t k = 0; k < jb; ++k)
+            pivb[k] = k;
+        int info = getrf(W1, pivb);
+
+        if (info == 0) {
+            // Apply the interchanges and update the trailing columns
+            if (jb < nw) {
+                auto W2 = slice(W, range(0, mw), range(jb, nw));
+                laswp(FORWARD, W2, pivb, 0, jb);
+
+                auto L11 = slice(W, range(0, jb), range(0, jb));
+                auto U12 = slice(W, range(0, jb), range(jb, nw));
+                trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, L11,
+                     U12);
+
+                if (jb < mw) {
+                    auto L21 = slice(W, range(jb, mw), range(0, jb));
+                    auto A22 = slice(W, range(jb, mw), range(jb, nw));
+                    gemm(NO_TRANS, NO_TRANS, -one, L21, U12, one, A22);
+                }
+            }
+
+            // Undo the interchanges in the columns of L to the left of each
+            // interchange, so that column k of L is stored unpermuted by the
+            // interchanges k+1, ..., jb-1
+            for (idx_t k = jb - 1; k > 0; --k) {
+                if (pivb[k] != k) {
+                    auto r0 = slice(W, k, range(0, k));
+                    auto r1 = slice(W, pivb[k], range(0, k));
+                    tlapack::swap(r0, r1);
+                }
+            }
+        }
+
+        // Copy the window back
+        for (idx_t c = 0; c < nw; ++c)
+            for (idx_t i = 0; i < mw; ++i)
+                if (i <= c + kl && c <= i + kv) A(j + i, j + c) = W(i, c);
+        for (idx_t k = 0; k < jb; ++k)
+            piv[j + k] = j + pivb[k];
+
+        if (info != 0) return j + info;
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GBTRF_HH
@@ -0,0 +1,130 @@
+/// @file gbtrs.hpp Solves a linear system using the band LU factorization
+/// computed by gbtrf.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GBTRS_HH
+#define TLAPACK_GBTRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/tbtrs.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * with the band LU factorization $A = P L U$ computed by gbtrf().
+ *
+ * @tparam op_t Either Op or any class that implements `operator Op()`.
+ *
+ * @param[in] trans
+ *      - Op::NoTrans:   Solve $A X = B$;
+ *      - Op::Trans:     Solve $A^T X = B$;
+ *      - Op::ConjTrans: Solve $A^H X = B$.
+ *
+ * @param[in] A n-by-n band matrix.
+ *      The factors L and U from the factorization computed by gbtrf(), with
+ *      A.kl subdiagonals and A.ku superdiagonals.
+ *
+ * @param[in] piv Vector of size n.
+ *      The pivot indices computed by gbtrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit, the solution X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          typename T,
+          class idx_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t>
+int gbtrs(op_t trans,
+          const LegacyBandedMatrix<T, idx_t>& A,
+          const piv_t& piv,
+          matrixB_t& B)
+{
+    using TB = type_t<matrixB_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const idx_t n = A.n;
+    const idx_t nrhs = ncols(B);
+    const idx_t kl = A.kl;
+
+    // Check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(A.m != A.n);
+    tlapack_check_false((idx_t)nrows(B) != n);
+    tlapack_check_false((idx_t)size(piv) < n);
+
+    tlapack_trace("gbtrs",
+                  internal::trace_flops<T>(2. * n * (2. * kl + A.ku) * nrhs),
+                  sizeof(T) * ((double(kl) + A.ku + 1) * n + 2. * n * nrhs));
+
+    // Quick return
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    if (trans == Op::NoTrans) {
+        // Solve L*X = B, applying the interchanges as they were computed
+        if (kl > 0) {
+            for (idx_t j = 0; j + 1 < n; ++j) {
+                const idx_t lm = min(kl, n - 1 - j);
+                if ((idx_t)piv[j] != j) {
+                    auto b0 = slice(B, j, range(0, nrhs));
+                    auto b1 = slice(B, piv[j], range(0, nrhs));
+                    tlapack::swap(b0, b1);
+                }
+                for (idx_t k = 0; k < nrhs; ++k) {
+                    const TB bjk = B(j, k);
+                    for (idx_t i = j + 1; i <= j + lm; ++i)
+                        B(i, k) -= A(i, j) * bjk;
+                }
+            }
+        }
+
+        // Solve U*X = B
+        tbtrs(UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, A, B);
+    }
+    else {
+        // Solve op(U)*X = B
+        tbtrs(UPPER_TRIANGLE, trans, NON_UNIT_DIAG, A, B);
+
+        // Solve op(L)*X = B, applying the interchanges in reverse order
+        if (kl > 0) {
+            for (idx_t j = n - 1; j-- > 0;) {
+                const idx_t lm = min(kl, n - 1 - j);
+                for (idx_t k = 0; k < nrhs; ++k) {
+                    TB bjk = B(j, k);
+                    for (idx_t i = j + 1; i <= j + lm; ++i)
+                        bjk -= ((trans == Op::ConjTrans) ? conj(A(i, j))
+                                                         : A(i, j)) *
+                               B(i, k);
+                    B(j, k) = bjk;
+                }
+                if ((idx_t)piv[j] != j) {
+                    auto b0 = slice(B, j, range(0, nrhs));
+                    auto b1 = slice(B, piv[j], range(0, nrhs));
+                    tlapack::swap(b0, b1);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GBTRS_HH
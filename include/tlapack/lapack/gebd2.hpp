@@ -223,7 +223,7 @@ int gebd2(matrix_t& A, vector_t& tauv, vector_t& tauw)
 
     // Allocates workspace
     WorkInfo workinfo = gebd2_worksize<T>(A, tauv, tauw);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gebd2_work(A, tauv, tauw, work);
@@ -92,6 +92,10 @@ int gebrd_work(matrix_t& A,
     const idx_t k = min(m, n);
     const idx_t nb = min((idx_t)opts.nb, k);
 
+    tlapack_trace("gebrd",
+                  internal::trace_flops<TA>(internal::flops_gebrd(m, n)),
+                  2. * sizeof(TA) * m * n);
+
     // Matrices X and Y
     auto [X, work2] = reshape(work, m, nb);
     auto [Y, work3] = reshape(work2, n, nb);
@@ -212,7 +216,7 @@ int gebrd(matrix_t& A,
 
     // Allocates workspace
     WorkInfo workinfo = gebrd_worksize<T>(A, tauv, tauw, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gebrd_work(A, tauv, tauw, work, opts);
@@ -173,7 +173,7 @@ int gehd2(size_type<matrix_t> ilo,
 
     // Allocates workspace
     WorkInfo workinfo = gehd2_worksize<T>(ilo, ihi, A, tau);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gehd2_work(ilo, ihi, A, tau, work);
@@ -12,6 +12,7 @@
 #ifndef TLAPACK_GEHRD_HH
 #define TLAPACK_GEHRD_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/lapack/gehd2.hpp"
@@ -25,7 +26,8 @@ namespace tlapack {
  * Options struct for gehrd
  */
 struct GehrdOpts {
-    size_t nb = 32;          ///< Block size used in the blocked reduction
+    size_t nb = tuned("gehrd.nb", 32);  ///< Block size used in the blocked
+                                        ///< reduction
     size_t nx_switch = 128;  ///< If only nx_switch columns are left, the
                              ///< algorithm will use unblocked code
 };
@@ -125,6 +127,11 @@ int gehrd_work(size_type<matrix_t> ilo,
     tlapack_check_false(ncols(A) != nrows(A));
     tlapack_check_false((idx_t)size(tau) < n - 1);
 
+    tlapack_trace("gehrd",
+                  internal::trace_flops<TA>(10. / 3 * (ihi - ilo) * (ihi - ilo) *
+                                            (ihi - ilo)),
+                  2. * sizeof(TA) * n * n);
+
     // quick return
     if (n <= 0) return 0;
 
@@ -240,7 +247,7 @@ int gehrd(size_type<matrix_t> ilo,
 
     // Allocates workspace
     WorkInfo workinfo = gehrd_worksize<T>(ilo, ihi, A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gehrd_work(ilo, ihi, A, tau, work, opts);
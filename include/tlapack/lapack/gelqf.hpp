@@ -91,6 +91,10 @@ int gelqf_work(A_t& A, tau_t& tau, work_t& work, const GelqfOpts& opts = {})
     // check arguments
     tlapack_check((idx_t)size(tau) >= k);
 
+    tlapack_trace("gelqf",
+                  internal::trace_flops<type_t<A_t>>(internal::flops_geqrf(n, m)),
+                  2. * sizeof(type_t<A_t>) * m * n);
+
     // Matrix TT
     auto [TT, work2] = (m > nb) ? reshape(work, nb, nb) : reshape(work, 0, 0);
 
@@ -162,7 +166,7 @@ int gelqf(A_t& A, tau_t& tau, const GelqfOpts& opts = {})
 
     // Allocate or get workspace
     WorkInfo workinfo = gelqf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gelqf_work(A, tau, work, opts);
@@ -152,7 +152,7 @@ int gelqt(matrix_t& A, matrix_t& TT)
 
     // Allocates workspace
     WorkInfo workinfo = gelqt_worksize<T>(A, TT);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return gelqt_work(A, TT, work);
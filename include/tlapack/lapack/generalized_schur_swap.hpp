@@ -177,9 +177,9 @@ int generalized_schur_swap(bool want_q,
         // Swap 1-by-1 block with 2-by-2 block
         //
 
-        std::vector<T> H_;
+        arena_vector<T> H_;
         auto H = new_matrix(H_, 2, 3);
-        std::vector<T> v(3);
+        arena_vector<T> v(3);
 
         complex_type<T> alpha1, alpha2;
         T beta1, beta2;
@@ -264,9 +264,9 @@ int generalized_schur_swap(bool want_q,
         //
         // Swap 2-by-2 block with 1-by-1 block
         //
-        std::vector<T> H_;
+        arena_vector<T> H_;
         auto H = new_matrix(H_, 2, 3);
-        std::vector<T> v(3);
+        arena_vector<T> v(3);
 
         complex_type<T> alpha1, alpha2;
         T beta1, beta2;
@@ -350,10 +350,10 @@ int generalized_schur_swap(bool want_q,
         //
         // Swap 2-by-2 block with 2-by-2 block
         //
-        std::vector<T> M_;
+        arena_vector<T> M_;
         auto M = new_matrix(M_, 8, 8);
-        std::vector<T> x(8);
-        std::vector<idx_t> piv(8);
+        arena_vector<T> x(8);
+        arena_vector<idx_t> piv(8);
 
         for (idx_t j = 0; j < 8; ++j)
             for (idx_t i = 0; i < 8; ++i)
@@ -474,9 +474,9 @@ int generalized_schur_swap(bool want_q,
         rotg(ssy2, temp, cy2, sy2);
 
         // Perform the swap on a local matrix and check the error
-        std::vector<T> AA_;
+        arena_vector<T> AA_;
         auto AA = new_matrix(AA_, 4, 4);
-        std::vector<T> BB_;
+        arena_vector<T> BB_;
         auto BB = new_matrix(BB_, 4, 4);
 
         lacpy(GENERAL, slice(A, range(j0, j3 + 1), range(j0, j3 + 1)), AA);
@@ -162,7 +162,7 @@ int geqlf(A_t& A, tau_t& tau, const GeqlfOpts& opts = {})
 
     // Allocate or get workspace
     WorkInfo workinfo = geqlf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return geqlf_work(A, tau, work, opts);
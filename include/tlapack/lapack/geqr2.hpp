@@ -146,7 +146,7 @@ int geqr2(matrix_t& A, vector_t& tau)
 
     // Allocates workspace
     WorkInfo workinfo = geqr2_worksize<T>(A, tau);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return geqr2_work(A, tau, work);
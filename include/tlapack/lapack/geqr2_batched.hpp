@@ -0,0 +1,122 @@
+/// @file geqr2_batched.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQR2_BATCHED_HH
+#define TLAPACK_GEQR2_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+#include "tlapack/lapack/larfg.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /// Entries i0:i1 of the column j of the b-th matrix of X, as a vector
+    template <class T>
+    LegacyVector<T, size_t, size_t> batch_col(const InterleavedBatch<T>& X,
+                                              size_t b,
+                                              size_t i0,
+                                              size_t i1,
+                                              size_t j)
+    {
+        return LegacyVector<T, size_t, size_t>(i1 - i0, &X(b, i0, j),
+                                               X.rstride);
+    }
+
+}  // namespace internal
+
+/** Computes the QR factorizations of a batch of small m-by-n matrices.
+ *
+ * For each matrix b of the batch, the factorization has the form
+ * \[
+ *          A_b = Q_b R_b,
+ * \]
+ * where Q_b is represented as a product of elementary reflectors as in
+ * geqr2(). The reflectors are generated by larfg() one matrix at a time, and
+ * applied to all matrices of a group at once. Each thread allocates a vector
+ * of opts.nb entries per group.
+ *
+ * @param[in,out] A Batch of m-by-n matrices.
+ *      On exit, the elements on and above the diagonal of A_b contain the
+ *      min(m,n)-by-n upper trapezoidal matrix R_b; the elements below the
+ *      diagonal, with tau_b, represent the unitary matrix Q_b.
+ *
+ * @param[out] tau Batch of vectors of length at least min(m,n).
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @return  0 if success
+ *
+ * @ingroup computational
+ */
+template <class batchA_t, class batchTau_t>
+int geqr2_batched(batchA_t& A, batchTau_t& tau, const BatchOpts& opts = {})
+{
+    const auto A_ = internal::batch_view(A);
+    const auto tau_ = internal::batch_view(tau);
+    const size_t count = internal::batch_count(A_);
+
+    // check arguments
+    tlapack_check_false(internal::batch_count(tau_) != count);
+
+    // Quick return
+    if (count == 0) return 0;
+
+    // constants
+    const size_t m = internal::batch_nrows(A_);
+    const size_t n = internal::batch_ncols(A_);
+    const size_t k = min(m, n);
+
+    // check arguments
+    tlapack_check_false(!internal::batch_is(A_, m, n));
+    tlapack_check_false(!internal::batch_fits(tau_, k));
+
+    internal::batch_for_each(
+        count, opts,
+        [&](size_t b0, size_t b1, size_t, const auto& A, const auto& tau) {
+            using T = std::decay_t<decltype(A(0, 0, 0))>;
+            arena_vector<T> w(b1 - b0);
+
+            for (size_t i = 0; i < k; ++i) {
+                // Generate the (i+1)-th elementary Householder reflection on
+                // v := A_b[i:m,i]
+                for (size_t b = b0; b < b1; ++b) {
+                    auto v = internal::batch_col(A, b, i, m, i);
+                    larfg(FORWARD, COLUMNWISE_STORAGE, v, tau(b, i, 0));
+                }
+
+                // A_b[i:m,j] := ( I - conj(tau_b[i]) v v^H ) A_b[i:m,j]
+                for (size_t j = i + 1; j < n; ++j) {
+                    // w := conj(tau_b[i]) v^H A_b[i:m,j]
+                    for (size_t b = b0; b < b1; ++b)
+                        w[b - b0] = A(b, i, j);
+                    for (size_t l = i + 1; l < m; ++l)
+                        for (size_t b = b0; b < b1; ++b)
+                            w[b - b0] += conj(A(b, l, i)) * A(b, l, j);
+                    for (size_t b = b0; b < b1; ++b)
+                        w[b - b0] *= conj(tau(b, i, 0));
+
+                    for (size_t b = b0; b < b1; ++b)
+                        A(b, i, j) -= w[b - b0];
+                    for (size_t l = i + 1; l < m; ++l)
+                        for (size_t b = b0; b < b1; ++b)
+                            A(b, l, j) -= A(b, l, i) * w[b - b0];
+                }
+            }
+        },
+        A_, tau_);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQR2_BATCHED_HH
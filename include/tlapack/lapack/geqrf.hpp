@@ -12,6 +12,7 @@
 #ifndef TLAPACK_GEQRF_HH
 #define TLAPACK_GEQRF_HH
 
+#include "tlapack/base/ThreadPool.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/geqr2.hpp"
 #include "tlapack/lapack/larfb.hpp"
@@ -23,6 +24,14 @@ namespace tlapack {
  */
 struct GeqrfOpts {
     size_t nb = 32;  ///< Block size
+
+    // Options for the TSQR variant, see geqrf_tsqr()
+    size_t tsqr_mb = 4096;       ///< Minimum number of rows in each block of
+                                 ///< the reduction tree
+    size_t num_threads = 0;      ///< Number of threads. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
 };
 
 /** Worspace query of geqrf()
@@ -91,6 +100,10 @@ int geqrf_work(A_t& A, tau_t& tau, work_t& work, const GeqrfOpts& opts = {})
     // check arguments
     tlapack_check((idx_t)size(tau) >= k);
 
+    tlapack_trace("geqrf",
+                  internal::trace_flops<type_t<A_t>>(internal::flops_geqrf(m, n)),
+                  2. * sizeof(type_t<A_t>) * m * n);
+
     // Matrix TT
     auto [TT, work2] = (n > nb) ? reshape(work, nb, nb) : reshape(work, 0, 0);
 
@@ -163,7 +176,7 @@ int geqrf(A_t& A, tau_t& tau, const GeqrfOpts& opts = {})
 
     // Allocate or get workspace
     WorkInfo workinfo = geqrf_worksize<T>(A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return geqrf_work(A, tau, work, opts);
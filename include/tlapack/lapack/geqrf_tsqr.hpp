@@ -0,0 +1,270 @@
+/// @file geqrf_tsqr.hpp Communication-avoiding QR factorization of a tall and
+/// skinny matrix.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @note Householder reconstruction adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/blob/master/SRC/dorhr_col.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GEQRF_TSQR_HH
+#define TLAPACK_GEQRF_TSQR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/ungqr.hpp"
+#include "tlapack/lapack/unmqr.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /// Number of rows in each block of the reduction tree, or 0 if the m-by-n
+    /// matrix should not be split
+    template <class idx_t>
+    idx_t tsqr_block_rows(idx_t m, idx_t n, const GeqrfOpts& opts)
+    {
+        // The stacked R factors must have at most half of the rows of the
+        // matrix, so that the reduction tree has logarithmic depth
+        const idx_t mb = max<idx_t>(opts.tsqr_mb, 2 * n);
+        return (n > 0 && m >= 2 * mb) ? mb : idx_t(0);
+    }
+
+    /**
+     * Computes the QR factorization A = Q R of an m-by-n matrix, m >= n, using
+     * a reduction tree, and forms Q explicitly.
+     *
+     * The rows of A are split in blocks that are factored in parallel. The R
+     * factors of the blocks are stacked and factored recursively.
+     *
+     * @param[in,out] A m-by-n matrix.
+     *      On exit, the upper triangle of A(0:n,0:n) contains R. The other
+     *      entries are destroyed.
+     * @param[out] Q m-by-n matrix with orthonormal columns.
+     * @param[in] opts Options.
+     * @param[in] pool Thread pool.
+     * @param[in] nthreads Number of threads.
+     */
+    template <TLAPACK_SMATRIX A_t, TLAPACK_SMATRIX Q_t>
+    void tsqr_explicit_q(A_t& A,
+                         Q_t& Q,
+                         const GeqrfOpts& opts,
+                         ThreadPool& pool,
+                         size_t nthreads)
+    {
+        using idx_t = size_type<A_t>;
+        using work_t = matrix_type<A_t, Q_t>;
+        using T = type_t<work_t>;
+        using range = pair<idx_t, idx_t>;
+
+        Create<work_t> new_matrix;
+        Create<vector_type<work_t>> new_vector;
+
+        // constants
+        const T zero(0);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t mb = tsqr_block_rows(m, n, opts);
+
+        // Leaf of the tree
+        if (mb == 0) {
+            arena_vector<T> tau_;
+            auto tau = new_vector(tau_, n);
+            geqrf(A, tau, opts);
+            lacpy(GENERAL, A, Q);
+            ungqr(Q, tau, UngqrOpts{opts.nb});
+            return;
+        }
+
+        const idx_t p = m / mb;
+        auto block = [m, p](idx_t i) { return range(i * m / p, (i + 1) * m / p); };
+
+        // Factor the blocks and stack their R factors
+        arena_vector<T> tau_;
+        auto tau = new_vector(tau_, p * n);
+        arena_vector<T> R_;
+        auto R = new_matrix(R_, p * n, n);
+        pool.parallel_for(p, nthreads, [&](size_t i) {
+            auto Ai = rows(A, block(i));
+            auto taui = slice(tau, range(i * n, (i + 1) * n));
+            auto Ri = rows(R, range(i * n, (i + 1) * n));
+            geqrf(Ai, taui, opts);
+            laset(LOWER_TRIANGLE, zero, zero, Ri);
+            lacpy(UPPER_TRIANGLE, rows(Ai, range(0, n)), Ri);
+        });
+
+        // Factor the stacked R factors
+        arena_vector<T> QR_;
+        auto QR = new_matrix(QR_, p * n, n);
+        tsqr_explicit_q(R, QR, opts, pool, nthreads);
+
+        // Q = diag(Q_0, ..., Q_{p-1}) QR
+        pool.parallel_for(p, nthreads, [&](size_t i) {
+            const auto Ai = rows(A, block(i));
+            const auto taui = slice(tau, range(i * n, (i + 1) * n));
+            auto Qi = rows(Q, block(i));
+            laset(GENERAL, zero, zero, Qi);
+            lacpy(GENERAL, rows(QR, range(i * n, (i + 1) * n)), Qi);
+            unmqr(LEFT_SIDE, NO_TRANS, Ai, taui, Qi, UnmqrOpts{opts.nb});
+        });
+
+        lacpy(UPPER_TRIANGLE, rows(R, range(0, n)), A);
+    }
+
+}  // namespace internal
+
+/** Computes a QR factorization of a tall and skinny m-by-n matrix A using
+ *  a communication-avoiding algorithm (TSQR).
+ *
+ * The rows of A are split in blocks of at least opts.tsqr_mb rows. The blocks
+ * are factored in parallel by geqrf() and their R factors are combined up a
+ * reduction tree. The orthogonal factor of the tree is then converted to the
+ * same representation computed by geqrf() using Householder reconstruction:
+ * the explicit Q is formed block by block, and the modified LU factorization
+ * \[
+ *      Q - S = V U,
+ * \]
+ * where S is a diagonal matrix of signs, yields the Householder vectors V.
+ * The output can be used by unmqr() and ungqr().
+ *
+ * The blocks are processed independently, so that each one is read from
+ * memory a small number of times. The algorithm performs about twice as many
+ * flops as geqrf(), but it is more efficient if m is much larger than n.
+ * If m < 2 max(opts.tsqr_mb, 2n), geqrf() is used.
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the elements on and above the diagonal of the array
+ *      contain the min(m,n)-by-n upper trapezoidal matrix R
+ *      (R is upper triangular if m >= n); the elements below the diagonal,
+ *      with the array tau, represent the unitary matrix Q as a
+ *      product of elementary reflectors.
+ *
+ * @param[out] tau Real vector of length min(m,n).
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: block size used by geqrf() and unmqr() in each block.
+ *      - @c opts.tsqr_mb: minimum number of rows in each block.
+ *      - @c opts.num_threads, @c opts.pool: threads that process the blocks.
+ *
+ * @see geqrf()
+ *
+ * @ingroup alloc_workspace
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t>
+int geqrf_tsqr(A_t& A, tau_t& tau, const GeqrfOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using work_t = matrix_type<A_t, tau_t>;
+    using T = type_t<work_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    Create<work_t> new_matrix;
+
+    // constants
+    const T zero(0);
+    const real_t one(1);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t mb = internal::tsqr_block_rows(m, n, opts);
+
+    // check arguments
+    tlapack_check((idx_t)size(tau) >= min(m, n));
+
+    // Small or wide matrices
+    if (mb == 0) return geqrf(A, tau, opts);
+
+    // Thread pool
+    ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+    const size_t nthreads =
+        (opts.num_threads == 0) ? pool.size() + 1 : opts.num_threads;
+
+    const idx_t p = m / mb;
+    auto block = [m, p](idx_t i) { return range(i * m / p, (i + 1) * m / p); };
+
+    // Factor the blocks and stack their R factors
+    arena_vector<T> tauB_;
+    auto tauB = new_matrix(tauB_, n, p);
+    arena_vector<T> R_;
+    auto R = new_matrix(R_, p * n, n);
+    pool.parallel_for(p, nthreads, [&](size_t i) {
+        auto Ai = rows(A, block(i));
+        auto taui = col(tauB, i);
+        auto Ri = rows(R, range(i * n, (i + 1) * n));
+        geqrf(Ai, taui, opts);
+        laset(LOWER_TRIANGLE, zero, zero, Ri);
+        lacpy(UPPER_TRIANGLE, rows(Ai, range(0, n)), Ri);
+    });
+
+    // Factor the stacked R factors
+    arena_vector<T> QR_;
+    auto QR = new_matrix(QR_, p * n, n);
+    internal::tsqr_explicit_q(R, QR, opts, pool, nthreads);
+
+    // Computes the rows of the explicit Q that correspond to block i
+    auto form_q = [&](idx_t i, work_t& Qi) {
+        const auto Ai = rows(A, block(i));
+        const auto taui = col(tauB, i);
+        laset(GENERAL, zero, zero, Qi);
+        lacpy(GENERAL, rows(QR, range(i * n, (i + 1) * n)), Qi);
+        unmqr(LEFT_SIDE, NO_TRANS, Ai, taui, Qi, UnmqrOpts{opts.nb});
+    };
+
+    // Modified LU factorization Q(0:n,0:n) - S = L U without pivoting
+    arena_vector<T> Q0_;
+    auto Q0 = new_matrix(Q0_, block(0).second, n);
+    form_q(0, Q0);
+    arena_vector<real_t> s(n);
+    for (idx_t j = 0; j < n; ++j) {
+        s[j] = (real(Q0(j, j)) >= real_t(0)) ? -one : one;
+        Q0(j, j) -= s[j];
+        for (idx_t i = j + 1; i < n; ++i)
+            Q0(i, j) /= Q0(j, j);
+        for (idx_t l = j + 1; l < n; ++l)
+            for (idx_t i = j + 1; i < n; ++i)
+                Q0(i, l) -= Q0(i, j) * Q0(j, l);
+    }
+    const auto U = slice(Q0, range(0, n), range(0, n));
+
+    // The remaining rows of V are Q U^{-1}. Q is formed and overwritten block
+    // by block
+    pool.parallel_for(p, nthreads, [&](size_t i) {
+        auto Ai = rows(A, block(i));
+        if (i == 0) {
+            auto Q1 = rows(Q0, range(n, nrows(Q0)));
+            trsm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, U,
+                 Q1);
+            lacpy(GENERAL, Q0, Ai);
+        }
+        else {
+            arena_vector<T> Qi_;
+            auto Qi = new_matrix(Qi_, nrows(Ai), n);
+            form_q(i, Qi);
+            trsm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, U,
+                 Qi);
+            lacpy(GENERAL, Qi, Ai);
+        }
+    });
+
+    // Q = (Q S) (S R): tau = -diag(U) S and the rows of R change sign
+    for (idx_t j = 0; j < n; ++j) {
+        tau[j] = -U(j, j) * s[j];
+        for (idx_t l = j; l < n; ++l)
+            A(j, l) = s[j] * R(j, l);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GEQRF_TSQR_HH
@@ -0,0 +1,64 @@
+/// @file gesv.hpp Solves a general system of linear equations.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GESV_HH
+#define TLAPACK_GESV_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/getrs.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * where A is an n-by-n matrix, using the LU factorization $A = P L U$.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the matrix A.
+ *      On exit, the factors L and U from the factorization $A = P L U$.
+ *
+ * @param[out] piv Vector of size n.
+ *      The pivot indices from getrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On successful exit, the solution X.
+ *
+ * @param[in] opts Options for getrf().
+ *
+ * @return = 0: successful exit.
+ * @return i+1 if getrf() failed on iteration i because U is singular. The
+ *      solution could not be computed.
+ *
+ * @ingroup variant_interface
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t>
+int gesv(matrixA_t& A,
+         piv_t& piv,
+         matrixB_t& B,
+         const GetrfOpts& opts = {})
+{
+    // Check arguments
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(B) != nrows(A));
+
+    int info = getrf(A, piv, opts);
+    if (info == 0) getrs(NO_TRANS, A, piv, B);
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GESV_HH
@@ -0,0 +1,194 @@
+/// @file gesv_ir.hpp Solves a general system of linear equations with a
+/// low-precision LU factorization and iterative refinement.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GESV_IR_HH
+#define TLAPACK_GESV_IR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/gesv.hpp"
+#include "tlapack/lapack/iterative_refinement.hpp"
+#include "tlapack/lapack/lange.hpp"
+#include "tlapack/lapack/laswp.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * where A is an n-by-n matrix, using an LU factorization computed in a lower
+ * precision and iterative refinement in the precision of A.
+ *
+ * The matrix A is scaled and converted to the precision of TF, and factored
+ * with getrf(). The solution is then refined in the precision of A, with
+ * residuals computed in the precision of TR. Each refinement step uses the
+ * low-precision factors to solve for the correction. If the classical
+ * refinement stagnates, e.g., if A is ill-conditioned in the precision of TF,
+ * the corrections are computed by GMRES preconditioned with the low-precision
+ * factors (GMRES-IR).
+ *
+ * If the refinement does not converge, A is factored in its own precision and
+ * the system is solved with gesv(). This is the same strategy as in
+ * LAPACK's DSGESV.
+ *
+ * @tparam TF Precision of the LU factorization, e.g., float or Eigen::half.
+ *      Only the real type of TF is used.
+ * @tparam TR Precision of the residuals. If void, the precision of A.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the matrix A.
+ *      On exit, if iter >= 0, A is unchanged. If iter < 0, the factors L and
+ *      U from the factorization $A = P L U$ computed by getrf().
+ *
+ * @param[out] piv Vector of size n.
+ *      The pivot indices of the factorization in the precision of TF if
+ *      iter >= 0, or in the precision of A if iter < 0.
+ *
+ * @param[in] B n-by-nrhs matrix.
+ *
+ * @param[out] X n-by-nrhs matrix.
+ *      On successful exit, the solution X.
+ *
+ * @param[out] iter
+ *      - iter >= 0: number of refinement steps;
+ *      - iter = -2: an entry of the scaled matrix A overflows in the precision
+ *        of TF;
+ *      - iter = -3: the factorization in the precision of TF failed;
+ *      - iter = -(opts.max_iters+1): the refinement did not converge.
+ *      The system is solved with gesv() if iter < 0.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.max_iters: maximum number of refinement steps.
+ *      - @c opts.gmres: switch to GMRES-IR when the refinement stagnates.
+ *      - @c opts.stagnation, @c opts.gmres_max_iters, @c opts.gmres_tol:
+ *        parameters of GMRES-IR.
+ *
+ * @return = 0: successful exit.
+ * @return i+1 if iter < 0 and getrf() failed on iteration i because U is
+ *      singular. The solution could not be computed.
+ *
+ * @ingroup variant_interface
+ */
+template <class TF,
+          class TR = void,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int gesv_ir(matrixA_t& A,
+            piv_t& piv,
+            const matrixB_t& B,
+            matrixX_t& X,
+            int& iter,
+            const IrOpts& opts = {})
+{
+    using T = type_t<matrixA_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+    using TF_t = internal::ir_type_t<TF, T>;
+    using TR_t = internal::ir_type_t<
+        std::conditional_t<is_same_v<TR, void>, T, TR>, T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+
+    // Check arguments
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false((idx_t)nrows(B) != n);
+    tlapack_check_false((idx_t)nrows(X) != n || (idx_t)ncols(X) != nrhs);
+    tlapack_check_false((idx_t)size(piv) < n);
+
+    tlapack_trace("gesv_ir", 0, 0);
+
+    // Quick return
+    iter = 0;
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    // Tolerance of the refinement, as in LAPACK's DSGESV
+    const real_t anrm = lange(INF_NORM, A);
+    const real_t cte = anrm * uroundoff<real_t>() * sqrt(real_t(n));
+
+    // Scaling that brings the entries of A to [-1,1]
+    const real_t amax = lange(MAX_NORM, A);
+    const real_t theta = (amax > real_t(0)) ? real_t(1) / amax : real_t(1);
+
+    // Allocates workspace
+    Create<matrixA_t> new_matrix;
+    arena_vector<TF_t> Af_;
+    auto Af = new_matrix(Af_, n, n);
+    arena_vector<TF_t> Wf_;
+    auto Wf = new_matrix(Wf_, n, nrhs);
+    arena_vector<TR_t> R_;
+    auto R = new_matrix(R_, n, nrhs);
+
+    // Low-precision factorization theta A = P L U
+    if (!internal::ir_convert(GENERAL, theta, A, Af))
+        iter = -2;
+    else if (getrf(Af, piv) != 0)
+        iter = -3;
+    else {
+        // R = B - A X
+        auto residual = [&](const auto& X, auto& R) {
+            internal::ir_residual(GENERAL, A, B, X, R);
+        };
+
+        // W = A^{-1} W using getrs in low precision
+        auto solve = [&](auto& W) {
+            for (idx_t j = 0; j < nrhs; ++j) {
+                const real_t s = internal::ir_maxabs(col(W, j));
+                const real_t sinv = (s > real_t(0)) ? real_t(1) / s : real_t(1);
+                auto wj = slice(W, range(0, n), range(j, j + 1));
+                auto wfj = slice(Wf, range(0, n), range(j, j + 1));
+                internal::ir_convert(GENERAL, sinv, wj, wfj);
+                getrs(NO_TRANS, Af, piv, wfj);
+
+                const real_t alpha = theta / sinv;
+                for (idx_t i = 0; i < n; ++i)
+                    W(i, j) = alpha * static_cast<T>(Wf(i, j));
+            }
+        };
+
+        // w = A v
+        auto matvec = [&](const auto& v, auto& w) {
+            gemv(NO_TRANS, real_t(1), A, v, real_t(0), w);
+        };
+
+        // W = (theta^{-1} P L U)^{-1} W in the precision of A. The factors
+        // are converted to the precision of A on the first call
+        arena_vector<T> Ap_;
+        auto precond = [&](auto& W) {
+            const bool first = Ap_.empty();
+            auto Ap = new_matrix(Ap_, n, n);
+            if (first)
+                internal::ir_convert(GENERAL, real_type<TF_t>(1), Af, Ap);
+
+            laswp(FORWARD, W, piv, 0, n);
+            trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, theta, Ap, W);
+            trsm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, real_t(1),
+                 Ap, W);
+        };
+
+        iter = internal::iterative_refinement(residual, solve, matvec, precond,
+                                              B, X, R, cte, opts);
+        if (iter >= 0) return 0;
+    }
+
+    // Fall back to the factorization in the precision of A
+    lacpy(GENERAL, B, X);
+    return gesv(A, piv, X);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GESV_IR_HH
@@ -14,20 +14,109 @@
 
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/gelqf.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/svd_dc.hpp"
 #include "tlapack/lapack/svd_qr.hpp"
 #include "tlapack/lapack/ungbr.hpp"
+#include "tlapack/lapack/unmlq.hpp"
+#include "tlapack/lapack/unmqr.hpp"
 
 namespace tlapack {
 
+/// Algorithm used for the SVD of the bidiagonal matrix
+enum class GesvdVariant : char {
+    QRIteration = 'Q',   ///< Implicit zero-shift QR, see svd_qr()
+    DivideConquer = 'D'  ///< Divide and conquer, see svd_dc()
+};
+
 /**
  * Options struct for gesvd
  */
-struct GesvdOpts {
-    /// @todo If either max(m,n)/min(m,n) is larger than shapethresh, a QR
-    /// factorization is used before
+struct GesvdOpts : public SvdDcOpts {
+    /// If max(m,n)/min(m,n) is larger than shapethresh, a QR (m > n) or LQ
+    /// (m < n) factorization is used before the bidiagonal reduction
     float shapethresh = 1.6;
+
+    /// Algorithm used for the SVD of the bidiagonal matrix
+    GesvdVariant variant = GesvdVariant::QRIteration;
 };
 
+namespace internal {
+
+    /// Computes the SVD of A by reducing it to bidiagonal form. This is
+    /// gesvd() without the QR or LQ preconditioning
+    template <TLAPACK_SMATRIX matrixA_t,
+              TLAPACK_SVECTOR r_vector_t,
+              TLAPACK_SMATRIX matrixU_t,
+              TLAPACK_SMATRIX matrixVt_t>
+    int gesvd_bidiag(bool want_u,
+                     bool want_vt,
+                     matrixA_t& A,
+                     r_vector_t& s,
+                     matrixU_t& U,
+                     matrixVt_t& Vt,
+                     const GesvdOpts& opts)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // Functors
+        Create<vector_type<matrixA_t>> new_vector;
+        Create<vector_type<r_vector_t>> new_rvector;
+
+        // constants
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t k = min(m, n);
+        const Uplo uplo = (m >= n) ? Uplo::Upper : Uplo::Lower;
+
+        // Allocate vectors
+        arena_vector<type_t<matrixA_t>> tauv_, tauw_;
+        auto tauv = new_vector(tauv_, k);
+        auto tauw = new_vector(tauw_, k);
+        arena_vector<type_t<r_vector_t>> e_;
+        auto e = new_rvector(e_, k);
+
+        // Reduce A to bidiagonal form
+        gebrd(A, tauv, tauw);
+
+        if (m >= n) {
+            // copy upper bidiagonal matrix
+            for (idx_t i = 0; i < k; ++i) {
+                s[i] = real(A(i, i));
+                if (i + 1 < n) e[i] = real(A(i, i + 1));
+            }
+        }
+        else {
+            // copy lower bidiagonal matrix
+            for (idx_t i = 0; i < k; ++i) {
+                s[i] = real(A(i, i));
+                if (i + 1 < m) e[i] = real(A(i + 1, i));
+            }
+        }
+
+        if (want_u) {
+            auto Ui = slice(U, range{0, m}, range{0, k});
+            lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, k}), Ui);
+            ungbr_q(n, U, tauv);
+        }
+
+        if (want_vt) {
+            auto Vti = slice(Vt, range{0, k}, range{0, n});
+            lacpy(Uplo::Upper, slice(A, range{0, k}, range{0, n}), Vti);
+            ungbr_p(m, Vt, tauw);
+        }
+
+        if (opts.variant == GesvdVariant::DivideConquer)
+            return svd_dc(uplo, want_u, want_vt, s, e, U, Vt, opts);
+        else
+            return svd_qr(uplo, want_u, want_vt, s, e, U, Vt);
+    }
+
+}  // namespace internal
+
 /**
  * Computes the singular values and, optionally, the right and/or
  * left singular vectors from the singular value decomposition (SVD) of
@@ -57,8 +146,15 @@ struct GesvdOpts {
  * @param[in,out] Vt n-by-n matrix.
  *
  * @param[in] opts Options.
- *      - @c opts.work is used if whenever it has sufficient size.
- *        The sufficient size can be obtained through a workspace query.
+ *      - @c opts.shapethresh: if max(m,n)/min(m,n) > shapethresh, A is
+ *        first reduced to a min(m,n)-by-min(m,n) triangular matrix by a QR or
+ *        LQ factorization. The SVD of the triangular factor is computed and
+ *        the orthogonal factor is applied to U or Vt.
+ *      - @c opts.variant: algorithm used for the SVD of the bidiagonal
+ *        matrix. GesvdVariant::DivideConquer uses level-3 operations to
+ *        update the singular vectors and is faster for large matrices.
+ *      - @c opts.nx: size of the subproblems solved by svd_qr() if
+ *        opts.variant = GesvdVariant::DivideConquer.
  *
  * @ingroup computational
  */
@@ -72,56 +168,77 @@ int gesvd(bool want_u,
           const GesvdOpts& opts = {})
 {
     using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
     using range = pair<idx_t, idx_t>;
 
     // Functors
+    Create<matrix_t> new_matrix;
     Create<vector_type<matrix_t>> new_vector;
-    Create<vector_type<r_vector_t>> new_rvector;
 
     // constants
+    const T zero(0);
+    const T one(1);
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
     const idx_t k = min(m, n);
-    const Uplo uplo = (m >= n) ? Uplo::Upper : Uplo::Lower;
-
-    // Allocate vectors
-    std::vector<type_t<matrix_t>> tauv_, tauw_;
-    auto tauv = new_vector(tauv_, k);
-    auto tauw = new_vector(tauw_, k);
-    std::vector<type_t<r_vector_t>> e_;
-    auto e = new_rvector(e_, k);
-
-    // Reduce A to bidiagonal form
-    gebrd(A, tauv, tauw);
-
-    if (m >= n) {
-        // copy upper bidiagonal matrix
-        for (idx_t i = 0; i < k; ++i) {
-            s[i] = real(A(i, i));
-            if (i + 1 < n) e[i] = real(A(i, i + 1));
+
+    tlapack_trace("gesvd", 0, 2. * sizeof(T) * m * n);
+
+    // Matrices with one dimension much larger than the other are reduced to a
+    // k-by-k triangular matrix first
+    if (k <= 0 || float(max(m, n)) <= opts.shapethresh * float(k))
+        return internal::gesvd_bidiag(want_u, want_vt, A, s, U, Vt, opts);
+
+    arena_vector<T> tau_;
+    auto tau = new_vector(tau_, k);
+    arena_vector<T> B_;
+    auto B = new_matrix(B_, k, k);
+    int info;
+
+    if (m > n) {
+        // A = Q R
+        geqrf(A, tau);
+        laset(Uplo::Lower, zero, zero, B);
+        lacpy(Uplo::Upper, slice(A, range{0, n}, range{0, n}), B);
+
+        if (want_u) {
+            // R = U_R S Vt
+            arena_vector<T> UR_;
+            auto UR = new_matrix(UR_, n, n);
+            info = internal::gesvd_bidiag(want_u, want_vt, B, s, UR, Vt, opts);
+
+            // U = Q [ U_R 0; 0 I ]
+            laset(Uplo::General, zero, one, U);
+            auto U0 = slice(U, range{0, n}, range{0, n});
+            lacpy(Uplo::General, UR, U0);
+            unmqr(LEFT_SIDE, NO_TRANS, A, tau, U);
         }
+        else
+            info = internal::gesvd_bidiag(want_u, want_vt, B, s, U, Vt, opts);
     }
     else {
-        // copy lower bidiagonal matrix
-        for (idx_t i = 0; i < k; ++i) {
-            s[i] = real(A(i, i));
-            if (i + 1 < m) e[i] = real(A(i + 1, i));
-        }
-    }
+        // A = L Q
+        gelqf(A, tau);
+        laset(Uplo::Upper, zero, zero, B);
+        lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, m}), B);
 
-    if (want_u) {
-        auto Ui = slice(U, range{0, m}, range{0, k});
-        lacpy(Uplo::Lower, slice(A, range{0, m}, range{0, k}), Ui);
-        ungbr_q(n, U, tauv);
-    }
+        if (want_vt) {
+            // L = U S Vt_L
+            arena_vector<T> VtL_;
+            auto VtL = new_matrix(VtL_, m, m);
+            info = internal::gesvd_bidiag(want_u, want_vt, B, s, U, VtL, opts);
 
-    if (want_vt) {
-        auto Vti = slice(Vt, range{0, k}, range{0, n});
-        lacpy(Uplo::Upper, slice(A, range{0, k}, range{0, n}), Vti);
-        ungbr_p(m, Vt, tauw);
+            // Vt = [ Vt_L 0; 0 I ] Q
+            laset(Uplo::General, zero, one, Vt);
+            auto Vt0 = slice(Vt, range{0, m}, range{0, m});
+            lacpy(Uplo::General, VtL, Vt0);
+            unmlq(RIGHT_SIDE, NO_TRANS, A, tau, Vt);
+        }
+        else
+            info = internal::gesvd_bidiag(want_u, want_vt, B, s, U, Vt, opts);
     }
 
-    return svd_qr(uplo, want_u, want_vt, s, e, U, Vt);
+    return info;
 }
 
 }  // namespace tlapack
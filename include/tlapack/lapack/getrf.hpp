@@ -12,17 +12,26 @@
 #define TLAPACK_GETRF_HH
 
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/getrf_blocked.hpp"
 #include "tlapack/lapack/getrf_level0.hpp"
 #include "tlapack/lapack/getrf_recursive.hpp"
+#include "tlapack/lapack/getrf_static.hpp"
 
 namespace tlapack {
 
 /// @brief Variants of the algorithm to compute the LU factorization.
-enum class GetrfVariant : char { Level0 = '0', Recursive = 'R' };
+enum class GetrfVariant : char {
+    Level0 = '0',
+    Recursive = 'R',
+    Blocked = 'B'
+};
 
 /// @brief Options struct for getrf()
-struct GetrfOpts {
-    GetrfVariant variant = GetrfVariant::Recursive;
+struct GetrfOpts : public BlockedLUOpts {
+    constexpr GetrfOpts(GetrfVariant variant = GetrfVariant::Recursive)
+        : variant(variant){};
+
+    GetrfVariant variant;
 };
 
 /** getrf computes an LU factorization of a general m-by-n matrix A.
@@ -49,7 +58,11 @@ struct GetrfOpts {
  * @param[in] opts Options.
  *      - variant:
  *          - Recursive = 'R',
- *          - Level0 = '0'
+ *          - Level0 = '0',
+ *          - Blocked = 'B'
+ *      - nb, lookahead, num_threads and pool for getrf_blocked.
+ *      If the sizes of A are known at compile time and are at most
+ *      internal::max_static_size, getrf_static() is used instead.
  *
  * @note To construct L and U, one proceeds as in the following steps
  *      1. Set matrices L m-by-k, and U k-by-n be to matrices with all zeros,
@@ -63,11 +76,24 @@ struct GetrfOpts {
 template <TLAPACK_MATRIX matrix_t, TLAPACK_VECTOR piv_t>
 int getrf(matrix_t& A, piv_t& piv, const GetrfOpts& opts = {})
 {
-    // Call variant
-    if (opts.variant == GetrfVariant::Recursive)
-        return getrf_recursive(A, piv);
-    else
-        return getrf_level0(A, piv);
+    tlapack_trace("getrf",
+                  internal::trace_flops<type_t<matrix_t>>(
+                      internal::flops_getrf(nrows(A), ncols(A))),
+                  2. * sizeof(type_t<matrix_t>) * nrows(A) * ncols(A));
+
+    // Small matrices of fixed size go through unrolled kernels
+    if constexpr (internal::use_static_kernels<matrix_t>)
+        return getrf_static<static_nrows<matrix_t>, static_ncols<matrix_t>>(
+            A, piv);
+    else {
+        // Call variant
+        if (opts.variant == GetrfVariant::Recursive)
+            return getrf_recursive(A, piv);
+        else if (opts.variant == GetrfVariant::Blocked)
+            return getrf_blocked(A, piv, opts);
+        else
+            return getrf_level0(A, piv);
+    }
 }
 
 }  // namespace tlapack
@@ -0,0 +1,124 @@
+/// @file getrf_batched.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_BATCHED_HH
+#define TLAPACK_GETRF_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+
+namespace tlapack {
+
+/** Computes the LU factorizations of a batch of small m-by-n matrices.
+ *
+ * For each matrix b of the batch, the factorization has the form
+ * \[
+ *   P_b A_b = L_b U_b
+ * \]
+ * as in getrf(). The factorizations use partial pivoting and are unblocked,
+ * which suits matrices that fit in cache.
+ *
+ * @param[in,out] A Batch of m-by-n matrices.
+ *      On exit, the factors L_b and U_b; the unit diagonal elements of L_b
+ *      are not stored.
+ *
+ * @param[out] piv Batch of integer vectors of length at least k=min(m,n).
+ *      piv_b[i]=j means that, in the i-th iteration of the algorithm, the
+ *      j-th row of A_b was swapped with the i-th row.
+ *
+ * @param[out] info Integer vector with one entry per matrix.
+ *      info[b] = 0 if the factorization of A_b succeeded, or i+1 if U_b(i,i)
+ *      is the first exactly zero pivot. Unlike getrf(), the factorization of
+ *      A_b is completed in that case.
+ *
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @return The number of matrices with info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <class batchA_t, class batchPiv_t, TLAPACK_VECTOR info_t>
+int getrf_batched(batchA_t& A,
+                  batchPiv_t& piv,
+                  info_t& info,
+                  const BatchOpts& opts = {})
+{
+    const auto A_ = internal::batch_view(A);
+    const auto piv_ = internal::batch_view(piv);
+    const size_t count = internal::batch_count(A_);
+
+    // check arguments
+    tlapack_check_false(internal::batch_count(piv_) != count);
+    tlapack_check_false((size_t)size(info) < count);
+
+    // Quick return
+    if (count == 0) return 0;
+
+    // constants
+    const size_t m = internal::batch_nrows(A_);
+    const size_t n = internal::batch_ncols(A_);
+    const size_t k = min(m, n);
+
+    // check arguments
+    tlapack_check_false(!internal::batch_is(A_, m, n));
+    tlapack_check_false(!internal::batch_fits(piv_, k));
+
+    for (size_t b = 0; b < count; ++b)
+        info[b] = 0;
+
+    internal::batch_for_each(
+        count, opts,
+        [&](size_t b0, size_t b1, size_t first, const auto& A,
+            const auto& piv) {
+            using T = std::decay_t<decltype(A(0, 0, 0))>;
+            const T zero(0);
+            const T one(1);
+
+            for (size_t j = 0; j < k; ++j) {
+                // Pivoting, one matrix at a time
+                for (size_t b = b0; b < b1; ++b) {
+                    size_t p = j;
+                    auto amax = abs(A(b, j, j));
+                    for (size_t i = j + 1; i < m; ++i) {
+                        if (abs(A(b, i, j)) > amax) {
+                            p = i;
+                            amax = abs(A(b, i, j));
+                        }
+                    }
+                    piv(b, j, 0) = p;
+                    if (A(b, p, j) == zero && info[first + b - b0] == 0)
+                        info[first + b - b0] = j + 1;
+                    if (p != j)
+                        for (size_t l = 0; l < n; ++l)
+                            std::swap(A(b, j, l), A(b, p, l));
+                }
+
+                // Scale the column below the pivot. If the pivot is zero, so
+                // is the column
+                for (size_t i = j + 1; i < m; ++i)
+                    for (size_t b = b0; b < b1; ++b)
+                        A(b, i, j) /= (A(b, j, j) == zero) ? one : A(b, j, j);
+
+                // Update the trailing matrix
+                for (size_t l = j + 1; l < n; ++l)
+                    for (size_t i = j + 1; i < m; ++i)
+                        for (size_t b = b0; b < b1; ++b)
+                            A(b, i, l) -= A(b, i, j) * A(b, j, l);
+            }
+        },
+        A_, piv_);
+
+    int nfailed = 0;
+    for (size_t b = 0; b < count; ++b)
+        if (info[b] != 0) ++nfailed;
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_BATCHED_HH
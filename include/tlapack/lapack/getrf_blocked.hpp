@@ -0,0 +1,190 @@
+/// @file getrf_blocked.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_BLOCKED_HH
+#define TLAPACK_GETRF_BLOCKED_HH
+
+#include <atomic>
+
+#include "tlapack/base/TaskGraph.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/getrf_recursive.hpp"
+#include "tlapack/lapack/laswp.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for getrf_blocked()
+struct BlockedLUOpts {
+    size_t nb = 64;              ///< Block size
+    size_t lookahead = 1;        ///< Number of panels that can be factored
+                                 ///< before the update of the trailing matrix
+                                 ///< by a previous panel is complete
+    size_t num_threads = 0;      ///< Number of threads. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
+};
+
+/** getrf_blocked computes an LU factorization of a general m-by-n matrix A
+ *  using partial pivoting with row interchanges.
+ *
+ *  The factorization has the form
+ * \[
+ *   P A = L U
+ * \]
+ *  where P is a permutation matrix constructed from our piv vector, L is lower
+ * triangular with unit diagonal elements (lower trapezoidal if m > n), and U is
+ * upper triangular (upper trapezoidal if m < n).
+ *
+ *  This is the right-looking blocked version of the algorithm. The panels of
+ * nb columns are factored by getrf_recursive(). Each block column of the
+ * trailing matrix is updated by a separate task, which applies the row
+ * interchanges of the panel, solves the triangular system and performs the
+ * gemm update. The tasks run on a TaskGraph, so that the factorization of the
+ * next panels overlaps with the update of the trailing matrix. The number of
+ * panels that can run ahead of the trailing update is limited by
+ * opts.lookahead. The row interchanges to the left of each panel are applied
+ * at the end, once per block column, by laswp().
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the factors L and U from the factorization A=PLU;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[in,out] piv is a k-by-1 integer vector where k=min(m,n)
+ * and piv[i]=j where i<=j<=k-1, which means in the i-th iteration of the
+ * algorithm, the j-th row needs to be swapped with i
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: block size.
+ *      - @c opts.lookahead: lookahead depth. If 0, each panel waits for the
+ *        complete update of the trailing matrix.
+ *      - @c opts.num_threads, @c opts.pool: threads that execute the tasks.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t, TLAPACK_SVECTOR piv_t>
+int getrf_blocked(matrix_t& A, piv_t& piv, const BlockedLUOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = min(m, n);
+    const idx_t nb = max<idx_t>(opts.nb, 1);
+    const idx_t npanels = (k + nb - 1) / nb;
+    const idx_t nblocks = (n + nb - 1) / nb;
+
+    // check arguments
+    tlapack_check((idx_t)size(piv) >= k);
+
+    // quick return
+    if (m <= 0 || n <= 0) return 0;
+
+    // Thread pool
+    ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+    const size_t nthreads =
+        (opts.num_threads == 0) ? pool.size() + 1 : opts.num_threads;
+
+    // Number of columns in panel p
+    auto panel_size = [&](idx_t p) { return min(nb, k - p * nb); };
+
+    // Applies the row interchanges of panel p to the columns j0:j1 and updates
+    // them
+    auto update = [&](idx_t p, idx_t j0, idx_t j1) {
+        const idx_t i0 = p * nb;
+        const idx_t i1 = i0 + panel_size(p);
+        auto Aj = cols(A, range(j0, j1));
+        laswp(FORWARD, Aj, piv, i0, i1);
+
+        const auto A11 = slice(A, range(i0, i1), range(i0, i1));
+        const auto A21 = slice(A, range(i1, m), range(i0, i1));
+        auto A12 = slice(A, range(i0, i1), range(j0, j1));
+        auto A22 = slice(A, range(i1, m), range(j0, j1));
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, A11, A12);
+        gemm(NO_TRANS, NO_TRANS, -one, A21, A12, one, A22);
+    };
+
+    // First singular panel. Once it is found, the remaining tasks do nothing
+    std::atomic<int> info(0);
+
+    // Data handles: the block columns 0:nblocks and, for each panel p, a token
+    // nblocks+p read by all updates with panel p
+    TaskGraph graph;
+    for (idx_t p = 0; p < npanels; ++p) {
+        const idx_t i0 = p * nb;
+        const idx_t jb = panel_size(p);
+        const idx_t j1 = min(i0 + nb, n);
+        const double fm = double(m - i0);
+        const double fjb = double(jb);
+
+        // Factor the panel and update the rest of its block column
+        auto panel = [&, p, i0, jb, j1]() {
+            if (info != 0) return;
+            auto Ap = slice(A, range(i0, m), range(i0, i0 + jb));
+            auto pivp = slice(piv, range(i0, i0 + jb));
+            int infoP = getrf_recursive(Ap, pivp);
+            if (infoP != 0) {
+                info = int(i0) + infoP;
+                return;
+            }
+            for (idx_t i = 0; i < jb; ++i)
+                pivp[i] += i0;
+            if (i0 + jb < j1) update(p, i0 + jb, j1);
+        };
+        const double cost = fm * fjb * fjb;
+        if (size_t(p) > opts.lookahead)
+            graph.insert_task(
+                panel, cost,
+                {TaskGraph::write(size_t(p)),
+                 TaskGraph::write(size_t(nblocks + p - 1 - opts.lookahead))});
+        else
+            graph.insert_task(panel, cost, {TaskGraph::write(size_t(p))});
+
+        // Update the block columns to the right
+        for (idx_t b = p + 1; b < nblocks; ++b) {
+            const idx_t j0 = b * nb;
+            const idx_t bj1 = min(j0 + nb, n);
+            graph.insert_task(
+                [&, p, j0, bj1]() {
+                    if (info != 0) return;
+                    update(p, j0, bj1);
+                },
+                2 * fm * fjb * double(bj1 - j0),
+                {TaskGraph::read(size_t(p)), TaskGraph::write(size_t(b)),
+                 TaskGraph::read(size_t(nblocks + p))});
+        }
+    }
+
+    graph.run(pool, nthreads);
+    if (info != 0) return info;
+
+    // Apply the row interchanges of the following panels to each block column
+    // to the left of them
+    pool.parallel_for(npanels - 1, nthreads, [&](size_t b) {
+        const idx_t j0 = idx_t(b) * nb;
+        auto Aj = cols(A, range(j0, j0 + nb));
+        laswp(FORWARD, Aj, piv, j0 + nb, k);
+    });
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_BLOCKED_HH
@@ -94,9 +94,18 @@ int getrf_level0(matrix_t& A, piv_t& piv)
         }
 
         // update the submatrix A(j+1:m-1,j+1:n-1)
-        for (idx_t row = j + 1; row < m; row++) {
+        if constexpr (layout<matrix_t> == Layout::RowMajor) {
+            for (idx_t row = j + 1; row < m; row++) {
+                for (idx_t col = j + 1; col < n; col++) {
+                    A(row, col) -= A(row, j) * A(j, col);
+                }
+            }
+        }
+        else {
             for (idx_t col = j + 1; col < n; col++) {
-                A(row, col) -= A(row, j) * A(j, col);
+                for (idx_t row = j + 1; row < m; row++) {
+                    A(row, col) -= A(row, j) * A(j, col);
+                }
             }
         }
     }
@@ -15,6 +15,7 @@
 #include "tlapack/blas/iamax.hpp"
 #include "tlapack/blas/swap.hpp"
 #include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/laswp.hpp"
 #include "tlapack/lapack/rscl.hpp"
 
 namespace tlapack {
@@ -122,13 +123,7 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
         if (info != 0) return info;
 
         // swap the rows of A1 according to piv
-        for (idx_t j = 0; j < k; j++) {
-            if ((idx_t)piv[j] != j) {
-                auto vect1 = tlapack::row(A1, j);
-                auto vect2 = tlapack::row(A1, piv[j]);
-                tlapack::swap(vect1, vect2);
-            }
-        }
+        laswp(FORWARD, A1, piv, idx_t(0), k);
 
         // Solve triangular system A0 X = A1 and update A1
         trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, T(1), A0, A1);
@@ -151,13 +146,7 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
         if (info != 0) return info;
 
         // swap the rows of A1
-        for (idx_t j = 0; j < k0; j++) {
-            if ((idx_t)piv0[j] != j) {
-                auto vect1 = tlapack::row(A1, j);
-                auto vect2 = tlapack::row(A1, piv0[j]);
-                tlapack::swap(vect1, vect2);
-            }
-        }
+        laswp(FORWARD, A1, piv0, idx_t(0), k0);
 
         // partition A into the following four blocks:
         auto A00 = tlapack::slice(A, range(0, k0), range(0, k0));
@@ -180,13 +169,7 @@ int getrf_recursive(matrix_t& A, piv_t& piv)
 
         // swap the rows of A10 according to the swapped rows of A11 by refering
         // to piv1
-        for (idx_t j = 0; j < k - k0; j++) {
-            if ((idx_t)piv1[j] != j) {
-                auto vect1 = tlapack::row(A10, j);
-                auto vect2 = tlapack::row(A10, piv1[j]);
-                tlapack::swap(vect1, vect2);
-            }
-        }
+        laswp(FORWARD, A10, piv1, idx_t(0), k - k0);
 
         // Shift piv1, so piv will have the accurate representation of overall
         // pivots
@@ -0,0 +1,109 @@
+/// @file getrf_static.hpp LU factorization of a matrix of fixed size.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRF_STATIC_HH
+#define TLAPACK_GETRF_STATIC_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** getrf_static computes an LU factorization of a m-by-n matrix A whose sizes
+ *  are known at compile time, using partial pivoting with row interchanges.
+ *
+ *  The factorization has the form
+ * \[
+ *   P A = L U
+ * \]
+ *  where P is a permutation matrix, L is lower triangular with unit diagonal
+ *  elements (lower trapezoidal if m > n), and U is upper triangular (upper
+ *  trapezoidal if m < n). The algorithm is the one of getrf_level0(), with the
+ *  loops unrolled at compile time. getrf() calls this routine when the sizes
+ *  of A are known at compile time and are at most internal::max_static_size.
+ *
+ * @tparam m Number of rows of A.
+ * @tparam n Number of columns of A.
+ *
+ * @return  0 if success
+ * @return  i+1 if failed to compute the LU on iteration i
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the factors L and U from the factorization P A = L U;
+ *      the unit diagonal elements of L are not stored.
+ *
+ * @param[out] piv Vector of size at least min(m,n).
+ *      On exit, piv is such that the i-th row of A was swapped with the
+ *      piv[i]-th row, in the i-th iteration of the algorithm.
+ *
+ * @ingroup computational
+ */
+template <int m, int n, TLAPACK_MATRIX matrix_t, TLAPACK_VECTOR piv_t>
+int getrf_static(matrix_t& A, piv_t& piv)
+{
+    static_assert(m >= 0 && n >= 0);
+
+    using idx_t = size_type<matrix_t>;
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+
+    // constants
+    constexpr int k = (m < n) ? m : n;
+
+    // check arguments
+    tlapack_check((idx_t)nrows(A) == m);
+    tlapack_check((idx_t)ncols(A) == n);
+    tlapack_check((idx_t)size(piv) >= k);
+
+    int info = 0;
+    internal::static_for<0, k>([&](auto j_) {
+        constexpr int j = j_;
+        if (info != 0) return;
+
+        // find pivot
+        idx_t p = j;
+        internal::static_for<j + 1, m>([&](auto i_) {
+            constexpr int i = i_;
+            if (abs1(A(i, j)) > abs1(A(p, j))) p = i;
+        });
+        piv[j] = p;
+
+        // if nonzero pivot does not exist, return
+        if (A(p, j) == real_t(0)) {
+            info = j + 1;
+            return;
+        }
+
+        // swap the j-th row and the pivot row
+        if (p != (idx_t)j) {
+            internal::static_for<0, n>([&](auto l_) {
+                constexpr int l = l_;
+                const T tmp = A(j, l);
+                A(j, l) = A(p, l);
+                A(p, l) = tmp;
+            });
+        }
+
+        // divide below diagonal part of j-th column by A(j,j), and update the
+        // submatrix A(j+1:m-1,j+1:n-1)
+        internal::static_for<j + 1, m>([&](auto i_) {
+            constexpr int i = i_;
+            A(i, j) /= A(j, j);
+            internal::static_for<j + 1, n>([&](auto l_) {
+                constexpr int l = l_;
+                A(i, l) -= A(i, j) * A(j, l);
+            });
+        });
+    });
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRF_STATIC_HH
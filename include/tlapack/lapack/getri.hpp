@@ -126,6 +126,10 @@ int getri(matrix_t& A, const piv_t& piv, const GetriOpts& opts = {})
     // Constants
     const idx_t n = ncols(A);
 
+    tlapack_trace("getri",
+                  internal::trace_flops<type_t<matrix_t>>(4. / 3 * n * n * n),
+                  2. * sizeof(type_t<matrix_t>) * n * n);
+
     // Call variant
     int info;
     if (opts.variant == GetriVariant::UXLI)
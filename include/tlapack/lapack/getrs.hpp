@@ -0,0 +1,91 @@
+/// @file getrs.hpp Solves a linear system using the LU factorization computed
+/// by getrf.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GETRS_HH
+#define TLAPACK_GETRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/laswp.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * with the LU factorization $A = P L U$ computed by getrf().
+ *
+ * @tparam op_t Either Op or any class that implements `operator Op()`.
+ *
+ * @param[in] trans
+ *      - Op::NoTrans:   Solve $A X = B$;
+ *      - Op::Trans:     Solve $A^T X = B$;
+ *      - Op::ConjTrans: Solve $A^H X = B$.
+ *
+ * @param[in] A n-by-n matrix.
+ *      The factors L and U from the factorization computed by getrf().
+ *
+ * @param[in] piv Vector of size n.
+ *      The pivot indices computed by getrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit, the solution X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t>
+int getrs(op_t trans, const matrixA_t& A, const piv_t& piv, matrixB_t& B)
+{
+    using T = type_t<matrixB_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+
+    // Check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false((idx_t)nrows(B) != n);
+    tlapack_check_false((idx_t)size(piv) < n);
+
+    tlapack_trace("getrs", internal::trace_flops<T>(2. * n * n * ncols(B)),
+                  sizeof(T) * (double(n) * n + 2. * n * ncols(B)));
+
+    // Quick return
+    if (n <= 0 || ncols(B) <= 0) return 0;
+
+    if (trans == Op::NoTrans) {
+        // Solve A*X = B where A = P*L*U.
+        laswp(FORWARD, B, piv, 0, n);
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one, A, B);
+        trsm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, A, B);
+    }
+    else {
+        // Solve op(A)*X = B where op(A) = op(U)*op(L)*P**T.
+        trsm(LEFT_SIDE, UPPER_TRIANGLE, trans, NON_UNIT_DIAG, one, A, B);
+        trsm(LEFT_SIDE, LOWER_TRIANGLE, trans, UNIT_DIAG, one, A, B);
+        laswp(BACKWARD, B, piv, 0, n);
+    }
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GETRS_HH
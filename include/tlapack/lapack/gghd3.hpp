@@ -93,18 +93,18 @@ int gghd3(bool wantq,
     if (nh <= 1) return 0;
 
     // Locally allocate workspace for now
-    std::vector<real_t> Cl_;
+    arena_vector<real_t> Cl_;
     auto Cl = new_real_matrix(Cl_, nh - 1, nb);
-    std::vector<T> Sl_;
+    arena_vector<T> Sl_;
     auto Sl = new_matrix(Sl_, nh - 1, nb);
-    std::vector<real_t> Cr_;
+    arena_vector<real_t> Cr_;
     auto Cr = new_real_matrix(Cr_, nh - 1, nb);
-    std::vector<T> Sr_;
+    arena_vector<T> Sr_;
     auto Sr = new_matrix(Sr_, nh - 1, nb);
 
-    std::vector<T> Qt_;
+    arena_vector<T> Qt_;
     auto Qt = new_matrix(Qt_, 2 * nb, 2 * nb);
-    std::vector<T> C_;
+    arena_vector<T> C_;
     auto C = new_matrix(C_, 2 * nb, n);
     auto D = new_matrix(C_, n, 2 * nb);
 
@@ -0,0 +1,182 @@
+/// @file gtsv_batched.hpp Solves a batch of general tridiagonal linear
+/// systems.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GTSV_BATCHED_HH
+#define TLAPACK_GTSV_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+
+namespace tlapack {
+
+/** Solves a batch of linear systems
+ * \[
+ *      A_b X_b = B_b,
+ * \]
+ * where each A_b is an n-by-n tridiagonal matrix.
+ *
+ * Each system is solved by Gaussian elimination with partial pivoting, as in
+ * LAPACK's DGTSV, with the elimination applied to B_b as it proceeds. The
+ * eliminations of the systems of a group advance together, one row at a
+ * time, so that the innermost loops run over independent systems. The choice
+ * of pivot of each system is a select rather than a branch. This removes the
+ * overhead of one call per system when solving many small systems.
+ *
+ * @param[in,out] DL Batch of vectors of size at least n-1.
+ *      On entry, the subdiagonals of A_b.
+ *      On exit, the first n-2 entries hold the second superdiagonals of the
+ *      upper triangular factors U_b.
+ *
+ * @param[in,out] D Batch of vectors of size n.
+ *      On entry, the diagonals of A_b.
+ *      On exit, the diagonals of U_b.
+ *
+ * @param[in,out] DU Batch of vectors of size at least n-1.
+ *      On entry, the superdiagonals of A_b.
+ *      On exit, the first superdiagonals of U_b.
+ *
+ * @param[in,out] B Batch of n-by-nrhs matrices.
+ *      On entry, the matrices B_b.
+ *      On exit, the solutions X_b if info[b] = 0.
+ *
+ * @param[out] info Integer vector with one entry per system.
+ *      info[b] = 0 if the system b was solved, or i+1 if U_b(i,i) is the first
+ *      exactly zero pivot, in which case A_b is singular.
+ *
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @return The number of systems with info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <class batchDL_t,
+          class batchD_t,
+          class batchDU_t,
+          class batchB_t,
+          TLAPACK_VECTOR info_t>
+int gtsv_batched(batchDL_t& DL,
+                 batchD_t& D,
+                 batchDU_t& DU,
+                 batchB_t& B,
+                 info_t& info,
+                 const BatchOpts& opts = {})
+{
+    const auto DL_ = internal::batch_view(DL);
+    const auto D_ = internal::batch_view(D);
+    const auto DU_ = internal::batch_view(DU);
+    const auto B_ = internal::batch_view(B);
+    const size_t count = internal::batch_count(B_);
+
+    // check arguments
+    tlapack_check_false(internal::batch_count(DL_) != count);
+    tlapack_check_false(internal::batch_count(D_) != count);
+    tlapack_check_false(internal::batch_count(DU_) != count);
+    tlapack_check_false((size_t)size(info) < count);
+
+    // Quick return
+    if (count == 0) return 0;
+
+    // constants
+    const size_t n = internal::batch_nrows(B_);
+    const size_t nrhs = internal::batch_ncols(B_);
+
+    // check arguments
+    tlapack_check_false(!internal::batch_is(B_, n, nrhs));
+    tlapack_check_false(!internal::batch_fits(D_, n));
+    tlapack_check_false(n > 0 && !internal::batch_fits(DL_, n - 1));
+    tlapack_check_false(n > 0 && !internal::batch_fits(DU_, n - 1));
+
+    for (size_t b = 0; b < count; ++b)
+        info[b] = 0;
+
+    // Quick return
+    if (n == 0) return 0;
+
+    internal::batch_for_each(
+        count, opts,
+        [&](size_t b0, size_t b1, size_t first, const auto& DL, const auto& D,
+            const auto& DU, const auto& B) {
+            using T = std::decay_t<decltype(D(0, 0, 0))>;
+            const T zero(0);
+
+            // Multipliers and row interchanges of the current step
+            arena_vector<T> fact(b1 - b0);
+            arena_vector<char> swapped(b1 - b0);
+
+            for (size_t i = 0; i + 1 < n; ++i) {
+                // Eliminate DL_b[i], interchanging rows i and i+1 if
+                // |DL_b[i]| > |D_b[i]|
+                for (size_t b = b0; b < b1; ++b) {
+                    const T d = D(b, i, 0);
+                    const T dl = DL(b, i, 0);
+                    const T du = DU(b, i, 0);
+                    const T dn = D(b, i + 1, 0);
+                    const T du1 = (i + 2 < n) ? DU(b, i + 1, 0) : zero;
+                    const bool s = abs1(d) < abs1(dl);
+
+                    const T p = s ? dl : d;
+                    const T f = (p != zero) ? (s ? d : dl) / p : zero;
+
+                    D(b, i, 0) = p;
+                    DU(b, i, 0) = s ? dn : du;
+                    DL(b, i, 0) = s ? du1 : zero;
+                    D(b, i + 1, 0) = s ? du - f * dn : dn - f * du;
+                    if (i + 2 < n) DU(b, i + 1, 0) = s ? -f * du1 : du1;
+
+                    fact[b - b0] = f;
+                    swapped[b - b0] = s;
+                }
+
+                for (size_t k = 0; k < nrhs; ++k)
+                    for (size_t b = b0; b < b1; ++b) {
+                        const T bi = B(b, i, k);
+                        const T bn = B(b, i + 1, k);
+                        const bool s = swapped[b - b0];
+                        B(b, i, k) = s ? bn : bi;
+                        B(b, i + 1, k) =
+                            s ? bi - fact[b - b0] * bn : bn - fact[b - b0] * bi;
+                    }
+            }
+
+            // Check for zero pivots
+            for (size_t b = b0; b < b1; ++b)
+                for (size_t i = 0; i < n; ++i)
+                    if (D(b, i, 0) == zero) {
+                        info[first + b - b0] = i + 1;
+                        break;
+                    }
+
+            // Solve U_b*X_b = B_b
+            for (size_t k = 0; k < nrhs; ++k) {
+                for (size_t b = b0; b < b1; ++b)
+                    B(b, n - 1, k) /= D(b, n - 1, 0);
+                if (n <= 1) continue;
+                for (size_t b = b0; b < b1; ++b)
+                    B(b, n - 2, k) =
+                        (B(b, n - 2, k) - DU(b, n - 2, 0) * B(b, n - 1, k)) /
+                        D(b, n - 2, 0);
+                for (size_t i = n - 2; i-- > 0;)
+                    for (size_t b = b0; b < b1; ++b)
+                        B(b, i, k) =
+                            (B(b, i, k) - DU(b, i, 0) * B(b, i + 1, k) -
+                             DL(b, i, 0) * B(b, i + 2, k)) /
+                            D(b, i, 0);
+            }
+        },
+        DL_, D_, DU_, B_);
+
+    int nfailed = 0;
+    for (size_t b = 0; b < count; ++b)
+        if (info[b] != 0) ++nfailed;
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GTSV_BATCHED_HH
@@ -0,0 +1,121 @@
+/// @file gttrf.hpp Computes the LU factorization of a general tridiagonal
+/// matrix.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GTTRF_HH
+#define TLAPACK_GTTRF_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes an LU factorization of an n-by-n tridiagonal matrix A using
+ * partial pivoting with row interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *      A = P L U
+ * \]
+ * where P is a permutation matrix, L is unit lower bidiagonal and U is upper
+ * triangular with nonzeros in only the main diagonal and the first two
+ * superdiagonals. Each interchange swaps two consecutive rows, as in
+ * LAPACK's DGTTRF.
+ *
+ * @param[in,out] DL Vector of size n-1.
+ *      On entry, the subdiagonal of A.
+ *      On exit, the multipliers that define L.
+ *
+ * @param[in,out] D Vector of size n.
+ *      On entry, the diagonal of A.
+ *      On exit, the diagonal of U.
+ *
+ * @param[in,out] DU Vector of size n-1.
+ *      On entry, the first superdiagonal of A.
+ *      On exit, the first superdiagonal of U.
+ *
+ * @param[out] DU2 Vector of size at least n-2.
+ *      The second superdiagonal of U.
+ *
+ * @param[out] piv Vector of size n.
+ *      Row i of the matrix was interchanged with row piv[i], which is either
+ *      i or i+1.
+ *
+ * @return  0 if success
+ * @return  i+1 if U(i,i) is the first exactly zero pivot. The factorization
+ *      is completed in that case, but U is singular.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_VECTOR dl_t,
+          TLAPACK_VECTOR d_t,
+          TLAPACK_VECTOR du_t,
+          TLAPACK_VECTOR du2_t,
+          TLAPACK_VECTOR piv_t>
+int gttrf(dl_t& DL, d_t& D, du_t& DU, du2_t& DU2, piv_t& piv)
+{
+    using T = type_t<d_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<d_t>;
+
+    // Constants
+    const real_t zero(0);
+    const idx_t n = size(D);
+
+    // Check arguments
+    tlapack_check_false(n > 0 && (idx_t)size(DL) + 1 != n);
+    tlapack_check_false(n > 0 && (idx_t)size(DU) + 1 != n);
+    tlapack_check_false(n > 1 && (idx_t)size(DU2) + 2 < n);
+    tlapack_check_false((idx_t)size(piv) < n);
+
+    tlapack_trace("gttrf", internal::trace_flops<T>(4. * n),
+                  sizeof(T) * 4. * n);
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    for (idx_t i = 0; i < n; ++i)
+        piv[i] = i;
+    for (idx_t i = 0; i + 2 < n; ++i)
+        DU2[i] = T(0);
+
+    for (idx_t i = 0; i + 1 < n; ++i) {
+        if (abs1(D[i]) >= abs1(DL[i])) {
+            // No row interchange required, eliminate DL[i]
+            if (D[i] != zero) {
+                const T fact = DL[i] / D[i];
+                DL[i] = fact;
+                D[i + 1] -= fact * DU[i];
+            }
+        }
+        else {
+            // Interchange rows i and i+1, eliminate DL[i]
+            const T fact = D[i] / DL[i];
+            D[i] = DL[i];
+            DL[i] = fact;
+            const T temp = DU[i];
+            DU[i] = D[i + 1];
+            D[i + 1] = temp - fact * D[i + 1];
+            if (i + 2 < n) {
+                DU2[i] = DU[i + 1];
+                DU[i + 1] = -fact * DU[i + 1];
+            }
+            piv[i] = i + 1;
+        }
+    }
+
+    // Check for a zero on the diagonal of U
+    for (idx_t i = 0; i < n; ++i)
+        if (D[i] == zero) return i + 1;
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GTTRF_HH
@@ -0,0 +1,193 @@
+/// @file gttrs.hpp Solves a linear system using the LU factorization of a
+/// general tridiagonal matrix computed by gttrf.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_GTTRS_HH
+#define TLAPACK_GTTRS_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for gttrs()
+struct GttrsOpts {
+    size_t nb = tuned("gttrs.nb", 16);  ///< Number of right-hand sides
+                                        ///< processed together
+};
+
+/** Solves a system of linear equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * with the tridiagonal LU factorization $A = P L U$ computed by gttrf().
+ *
+ * The right-hand sides are processed in groups of opts.nb columns, and the
+ * substitutions of a group advance together, one row at a time, so that the
+ * loop over the columns of the group is independent and can be vectorized.
+ * The row interchanges are applied without branches, since piv[i] is either
+ * i or i+1.
+ *
+ * @tparam op_t Either Op or any class that implements `operator Op()`.
+ *
+ * @param[in] trans
+ *      - Op::NoTrans:   Solve $A X = B$;
+ *      - Op::Trans:     Solve $A^T X = B$;
+ *      - Op::ConjTrans: Solve $A^H X = B$.
+ *
+ * @param[in] DL Vector of size n-1.
+ *      The multipliers that define L, as computed by gttrf().
+ *
+ * @param[in] D Vector of size n.
+ *      The diagonal of U.
+ *
+ * @param[in] DU Vector of size n-1.
+ *      The first superdiagonal of U.
+ *
+ * @param[in] DU2 Vector of size at least n-2.
+ *      The second superdiagonal of U.
+ *
+ * @param[in] piv Vector of size n.
+ *      The pivot indices computed by gttrf().
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit, the solution X.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: number of right-hand sides processed together.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_OP op_t,
+          TLAPACK_VECTOR dl_t,
+          TLAPACK_VECTOR d_t,
+          TLAPACK_VECTOR du_t,
+          TLAPACK_VECTOR du2_t,
+          TLAPACK_VECTOR piv_t,
+          TLAPACK_SMATRIX matrixB_t>
+int gttrs(op_t trans,
+          const dl_t& DL,
+          const d_t& D,
+          const du_t& DU,
+          const du2_t& DU2,
+          const piv_t& piv,
+          matrixB_t& B,
+          const GttrsOpts& opts = {})
+{
+    using T = type_t<matrixB_t>;
+    using idx_t = size_type<matrixB_t>;
+
+    // Constants
+    const idx_t n = nrows(B);
+    const idx_t nrhs = ncols(B);
+    const idx_t nb = max<idx_t>(opts.nb, 1);
+
+    // Check arguments
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false((idx_t)size(D) != n);
+    tlapack_check_false(n > 0 && (idx_t)size(DL) + 1 != n);
+    tlapack_check_false(n > 0 && (idx_t)size(DU) + 1 != n);
+    tlapack_check_false(n > 1 && (idx_t)size(DU2) + 2 < n);
+    tlapack_check_false((idx_t)size(piv) < n);
+
+    tlapack_trace("gttrs", internal::trace_flops<T>(8. * n * nrhs),
+                  sizeof(T) * (5. * n + 2. * n * nrhs));
+
+    // Quick return
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    // op(x)
+    auto op = [&](const auto& x) -> T {
+        return (trans == Op::ConjTrans) ? T(conj(x)) : T(x);
+    };
+
+    for (idx_t k0 = 0; k0 < nrhs; k0 += nb) {
+        const idx_t k1 = min(k0 + nb, nrhs);
+
+        if (trans == Op::NoTrans) {
+            // Solve L*X = B, applying the interchanges as they were computed
+            for (idx_t i = 0; i + 1 < n; ++i) {
+                const idx_t ip = piv[i];
+                const idx_t io = 2 * i + 1 - ip;
+                const T dli = DL[i];
+                for (idx_t k = k0; k < k1; ++k) {
+                    const T temp = B(io, k) - dli * B(ip, k);
+                    B(i, k) = B(ip, k);
+                    B(i + 1, k) = temp;
+                }
+            }
+
+            // Solve U*X = B
+            {
+                const T d = D[n - 1];
+                for (idx_t k = k0; k < k1; ++k)
+                    B(n - 1, k) /= d;
+            }
+            if (n > 1) {
+                const T dn = D[n - 2];
+                const T dun = DU[n - 2];
+                for (idx_t k = k0; k < k1; ++k)
+                    B(n - 2, k) = (B(n - 2, k) - dun * B(n - 1, k)) / dn;
+
+                for (idx_t i = n - 2; i-- > 0;) {
+                    const T d = D[i];
+                    const T du = DU[i];
+                    const T du2 = DU2[i];
+                    for (idx_t k = k0; k < k1; ++k)
+                        B(i, k) =
+                            (B(i, k) - du * B(i + 1, k) - du2 * B(i + 2, k)) /
+                            d;
+                }
+            }
+        }
+        else {
+            // Solve op(U)*X = B
+            {
+                const T d = op(D[0]);
+                for (idx_t k = k0; k < k1; ++k)
+                    B(0, k) /= d;
+            }
+            if (n > 1) {
+                const T d = op(D[1]);
+                const T du = op(DU[0]);
+                for (idx_t k = k0; k < k1; ++k)
+                    B(1, k) = (B(1, k) - du * B(0, k)) / d;
+            }
+            for (idx_t i = 2; i < n; ++i) {
+                const T d = op(D[i]);
+                const T du = op(DU[i - 1]);
+                const T du2 = op(DU2[i - 2]);
+                for (idx_t k = k0; k < k1; ++k)
+                    B(i, k) = (B(i, k) - du * B(i - 1, k) - du2 * B(i - 2, k)) /
+                              d;
+            }
+
+            // Solve op(L)*X = B, applying the interchanges in reverse order
+            for (idx_t i = n - 1; i-- > 0;) {
+                const idx_t ip = piv[i];
+                const T dli = op(DL[i]);
+                for (idx_t k = k0; k < k1; ++k) {
+                    const T temp = B(i, k) - dli * B(i + 1, k);
+                    B(i, k) = B(ip, k);
+                    B(ip, k) = temp;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_GTTRS_HH
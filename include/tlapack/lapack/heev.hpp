@@ -0,0 +1,133 @@
+/// @file heev.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zheevd.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HEEV_HH
+#define TLAPACK_HEEV_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/hetrd.hpp"
+#include "tlapack/lapack/stedc.hpp"
+#include "tlapack/lapack/steqr.hpp"
+#include "tlapack/lapack/ungtr.hpp"
+
+namespace tlapack {
+
+/// Algorithm used for the eigendecomposition of the tridiagonal matrix
+enum class HeevVariant : char {
+    QRIteration = 'Q',   ///< Implicit QL or QR, see steqr()
+    DivideConquer = 'D'  ///< Divide and conquer, see stedc()
+};
+
+/**
+ * Options struct for heev()
+ */
+struct HeevOpts : public HetrdOpts, public StedcOpts {
+    /// Algorithm used for the eigendecomposition of the tridiagonal matrix
+    HeevVariant variant = HeevVariant::QRIteration;
+};
+
+/**
+ * Computes all eigenvalues and, optionally, eigenvectors of a hermitian
+ * matrix A.
+ *
+ * A is reduced to real symmetric tridiagonal form T = Q**H * A * Q by hetrd().
+ * The eigenvalues and eigenvectors of T are computed by steqr() or stedc(),
+ * and the eigenvectors of A are Q times the eigenvectors of T.
+ *
+ * @return  0 if success
+ * @return  i > 0 if the tridiagonal eigensolver failed to converge.
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] want_z bool
+ *      If true, the eigenvectors are computed.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n hermitian matrix.
+ *      On exit, if want_z, A contains the orthonormal eigenvectors of A.
+ *      Otherwise, the triangle of A referenced by uplo, including the
+ *      diagonal, is destroyed.
+ *
+ * @param[out] w Real vector of length n.
+ *      The eigenvalues of A in increasing order.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: block size used by hetrd().
+ *      - @c opts.variant: algorithm used for the tridiagonal matrix.
+ *        HeevVariant::DivideConquer uses level-3 operations to update the
+ *        eigenvectors and is faster for large matrices.
+ *      - @c opts.nx: size of the subproblems solved by steqr() if
+ *        opts.variant = HeevVariant::DivideConquer.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR w_t, class uplo_t>
+int heev(bool want_z,
+         uplo_t uplo,
+         A_t& A,
+         w_t& w,
+         const HeevOpts& opts = {})
+{
+    using T = type_t<A_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<A_t>;
+
+    // Functors
+    Create<vector_type<A_t>> new_vector;
+    Create<vector_type<w_t>> new_rvector;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check((idx_t)size(w) >= n);
+
+    tlapack_trace("heev", 0, 2. * sizeof(T) * n * n);
+
+    // quick return
+    if (n <= 0) return 0;
+    if (n == 1) {
+        w[0] = real(A(0, 0));
+        if (want_z) A(0, 0) = one;
+        return 0;
+    }
+
+    // Reduce A to tridiagonal form
+    arena_vector<T> tau_;
+    auto tau = new_vector(tau_, n - 1);
+    hetrd(uplo, A, tau, opts);
+
+    arena_vector<real_t> e_;
+    auto e = new_rvector(e_, n - 1);
+    for (idx_t i = 0; i < n; ++i)
+        w[i] = real(A(i, i));
+    for (idx_t i = 0; i < n - 1; ++i)
+        e[i] = real((uplo == Uplo::Lower) ? A(i + 1, i) : A(i, i + 1));
+
+    if (!want_z) return steqr(false, w, e, A);
+
+    // Form Q and compute the eigenvectors of A
+    ungtr(uplo, A, tau);
+    if (opts.variant == HeevVariant::DivideConquer)
+        return stedc(true, w, e, A, opts);
+    else
+        return steqr(true, w, e, A);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HEEV_HH
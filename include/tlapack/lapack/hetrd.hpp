@@ -0,0 +1,239 @@
+/// @file hetrd.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrd.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_HETRD_HH
+#define TLAPACK_HETRD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/her2k.hpp"
+#include "tlapack/lapack/hetd2.hpp"
+#include "tlapack/lapack/latrd.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for hetrd()
+ */
+struct HetrdOpts {
+    size_t nb = 32;  ///< Block size used in the blocked reduction. The last
+                     ///< nb rows and columns are reduced by hetd2()
+};
+
+/** Worspace query of hetrd()
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in] A n-by-n hermitian matrix.
+ *
+ * @param[in] tau Vector of length n-1.
+ *
+ * @param[in] opts Options.
+ *
+ * @return WorkInfo The amount workspace required.
+ *
+ * @ingroup workspace_query
+ */
+template <class T, TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t, class uplo_t>
+constexpr WorkInfo hetrd_worksize(uplo_t uplo,
+                                  const A_t& A,
+                                  const tau_t& tau,
+                                  const HetrdOpts& opts = {})
+{
+    using idx_t = size_type<A_t>;
+    using work_t = matrix_type<A_t, tau_t>;
+
+    const idx_t n = nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, n);
+
+    if constexpr (is_same_v<T, type_t<work_t>>)
+        return (nb > 1 && n > nb) ? WorkInfo(n, nb + 1) : WorkInfo(0);
+    else
+        return WorkInfo(0);
+}
+
+/** @copybrief hetrd()
+ * Workspace is provided as an argument.
+ * @copydetails hetrd()
+ *
+ * @param work Workspace. Use the workspace query to determine the size needed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_SVECTOR tau_t,
+          TLAPACK_WORKSPACE work_t,
+          class uplo_t>
+int hetrd_work(uplo_t uplo,
+               A_t& A,
+               tau_t& tau,
+               work_t& work,
+               const HetrdOpts& opts = {})
+{
+    using T = type_t<A_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+    const idx_t nb = min((idx_t)opts.nb, n);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check((idx_t)size(tau) >= n - 1);
+
+    tlapack_trace("hetrd", internal::trace_flops<T>(4. / 3 * n * n * n),
+                  sizeof(T) * double(n) * n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    // Use unblocked code
+    if (nb <= 1 || n <= nb) return hetd2(uplo, A, tau);
+
+    // Matrix W and the off-diagonal elements of each panel
+    auto [W, work2] = reshape(work, n, nb);
+    auto [e, work3] = reshape(work2, n);
+
+    if (uplo == Uplo::Upper) {
+        // The last columns are reduced in blocks of nb columns. The first kk
+        // columns are reduced by hetd2
+        const idx_t kk = n - ((n - nb + nb - 1) / nb) * nb;
+        for (idx_t i = n - nb; i != kk - nb; i -= nb) {
+            // Reduce columns i:i+nb and form the matrix W needed to update
+            // the unreduced part of the matrix
+            auto A1 = slice(A, range{0, i + nb}, range{0, i + nb});
+            auto W1 = slice(W, range{0, i + nb}, range{0, nb});
+            latrd(uplo, A1, e, tau, W1);
+
+            // Update the unreduced submatrix A(0:i,0:i), using an update of
+            // the form A := A - V*W**H - W*V**H
+            auto A11 = slice(A, range{0, i}, range{0, i});
+            auto V = slice(A, range{0, i}, range{i, i + nb});
+            auto W11 = slice(W, range{0, i}, range{0, nb});
+            her2k(UPPER_TRIANGLE, NO_TRANS, -one, V, W11, one, A11);
+
+            // Copy the off-diagonal elements back into A
+            for (idx_t j = i; j < i + nb; ++j)
+                A(j - 1, j) = e[j - 1];
+        }
+
+        auto A0 = slice(A, range{0, kk}, range{0, kk});
+        auto tau0 = slice(tau, range{0, kk - 1});
+        hetd2(uplo, A0, tau0);
+    }
+    else {
+        // The first columns are reduced in blocks of nb columns. The last
+        // columns are reduced by hetd2
+        idx_t i = 0;
+        for (; i + nb < n; i += nb) {
+            // Reduce columns i:i+nb and form the matrix W needed to update
+            // the unreduced part of the matrix
+            auto A1 = slice(A, range{i, n}, range{i, n});
+            auto e1 = slice(e, range{0, n - i - 1});
+            auto tau1 = slice(tau, range{i, n - 1});
+            auto W1 = slice(W, range{0, n - i}, range{0, nb});
+            latrd(uplo, A1, e1, tau1, W1);
+
+            // Update the unreduced submatrix A(i+nb:n,i+nb:n), using an
+            // update of the form A := A - V*W**H - W*V**H
+            auto A22 = slice(A, range{i + nb, n}, range{i + nb, n});
+            auto V = slice(A, range{i + nb, n}, range{i, i + nb});
+            auto W22 = slice(W, range{nb, n - i}, range{0, nb});
+            her2k(LOWER_TRIANGLE, NO_TRANS, -one, V, W22, one, A22);
+
+            // Copy the off-diagonal elements back into A
+            for (idx_t j = i; j < i + nb; ++j)
+                A(j + 1, j) = e1[j - i];
+        }
+
+        auto A2 = slice(A, range{i, n}, range{i, n});
+        auto tau2 = slice(tau, range{i, n - 1});
+        hetd2(uplo, A2, tau2);
+    }
+
+    return 0;
+}
+
+/** Reduces a hermitian matrix A to real symmetric tridiagonal form T by a
+ * unitary similarity transformation:
+ * \[
+ *          Q**H * A * Q = T.
+ * \]
+ *
+ * This is the blocked version of hetd2(). Each panel of nb columns is reduced
+ * by latrd(), which also returns the matrix W needed to update the rest of the
+ * matrix by the rank-2k update A := A - V*W**H - W*V**H performed by her2k().
+ * Most of the flops are thus done by level-3 operations.
+ *
+ * If uplo = Upper, the matrix Q is represented as a product of elementary
+ * reflectors
+ * \[
+ *          Q = H(n-2) . . . H(1) H(0).
+ * \]
+ * Each H(i) has the form H(i) = I - tau * v * v**H, where v(i+1:n) = 0 and
+ * v(i) = 1; v(0:i) is stored on exit in A(0:i,i+1), and tau in tau[i].
+ *
+ * If uplo = Lower, the matrix Q is represented as a product of elementary
+ * reflectors
+ * \[
+ *          Q = H(0) H(1) . . . H(n-2).
+ * \]
+ * Each H(i) has the form H(i) = I - tau * v * v**H, where v(0:i+1) = 0 and
+ * v(i+1) = 1; v(i+2:n) is stored on exit in A(i+2:n,i), and tau in tau[i].
+ *
+ * @return  0 if success
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n hermitian matrix.
+ *      On exit, the main diagonal and offdiagonal contain the elements of the
+ *      symmetric tridiagonal matrix T. The other positions are used to store
+ *      elementary Householder reflectors.
+ *
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: block size.
+ *
+ * @see ungtr() to form Q explicitly.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX A_t, TLAPACK_SVECTOR tau_t, class uplo_t>
+int hetrd(uplo_t uplo, A_t& A, tau_t& tau, const HetrdOpts& opts = {})
+{
+    using work_t = matrix_type<A_t, tau_t>;
+    using T = type_t<work_t>;
+
+    // Functor
+    Create<work_t> new_matrix;
+
+    // Allocates workspace
+    WorkInfo workinfo = hetrd_worksize<T>(uplo, A, tau, opts);
+    arena_vector<T> work_;
+    auto work = new_matrix(work_, workinfo.m, workinfo.n);
+
+    return hetrd_work(uplo, A, tau, work, opts);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_HETRD_HH
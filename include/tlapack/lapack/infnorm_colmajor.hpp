@@ -104,7 +104,7 @@ auto infnorm_colmajor(const matrix_t& A)
 
     // Allocates workspace
     WorkInfo workinfo = infnorm_colmajor_worksize<T>(A);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return infnorm_colmajor_work(A, work);
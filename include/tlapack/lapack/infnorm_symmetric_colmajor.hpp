@@ -142,7 +142,7 @@ auto infnorm_symmetric_colmajor(uplo_t uplo, const matrix_t& A)
 
     // Allocates workspace
     WorkInfo workinfo = infnorm_symmetric_colmajor_worksize<T>(uplo, A);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return infnorm_symmetric_colmajor_work(uplo, A, work);
@@ -178,7 +178,7 @@ auto infnorm_triangular_colmajor(uplo_t uplo, diag_t diag, const matrix_t& A)
 
     // Allocates workspace
     WorkInfo workinfo = infnorm_triangular_colmajor_worksize<T>(uplo, A);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return infnorm_triangular_colmajor_work(uplo, A, work);
@@ -0,0 +1,388 @@
+/// @file iterative_refinement.hpp Mixed-precision iterative refinement for
+/// linear systems.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_ITERATIVE_REFINEMENT_HH
+#define TLAPACK_ITERATIVE_REFINEMENT_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/hemm.hpp"
+#include "tlapack/blas/nrm2.hpp"
+#include "tlapack/blas/rotg.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for gesv_ir() and posv_ir()
+struct IrOpts {
+    size_t max_iters = 30;        ///< Maximum number of refinement steps
+    bool gmres = true;            ///< Switch to GMRES-IR when the classical
+                                  ///< refinement stagnates or diverges
+    double stagnation = 0.5;      ///< Switch to GMRES-IR if the residual is
+                                  ///< not reduced by at least this factor
+    size_t gmres_max_iters = 50;  ///< Maximum number of GMRES iterations in
+                                  ///< each refinement step
+    double gmres_tol = 0;  ///< Relative tolerance of GMRES. If 0, use the
+                           ///< square root of the working precision
+};
+
+namespace internal {
+
+    /// Entries of type real_type<TF> with the real or complex nature of T
+    template <class TF, class T>
+    using ir_type_t = std::conditional_t<is_complex<T>,
+                                         complex_type<real_type<TF>>,
+                                         real_type<TF>>;
+
+    /**
+     * @brief Copies alpha*A to B, converting the entries to the type of B.
+     *
+     * @param[in] uplo
+     *      - Uplo::General: All entries of A are copied;
+     *      - Uplo::Upper or Uplo::Lower: Only the upper or lower triangle of A
+     *      is copied.
+     *
+     * @return false if an entry of alpha*A overflows in the type of B. B is
+     * incomplete in this case.
+     */
+    template <TLAPACK_UPLO uplo_t,
+              TLAPACK_MATRIX matrixA_t,
+              TLAPACK_MATRIX matrixB_t>
+    bool ir_convert(uplo_t uplo,
+                    const real_type<type_t<matrixA_t>>& alpha,
+                    const matrixA_t& A,
+                    matrixB_t& B)
+    {
+        using TA = type_t<matrixA_t>;
+        using TB = type_t<matrixB_t>;
+        using realA_t = real_type<TA>;
+        using realB_t = real_type<TB>;
+        using idx_t = size_type<matrixA_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const realA_t rmax = static_cast<realA_t>(safe_max<realB_t>());
+
+        for (idx_t j = 0; j < n; ++j) {
+            const idx_t i0 = (uplo == Uplo::Lower) ? j : 0;
+            const idx_t i1 = (uplo == Uplo::Upper) ? min(j + 1, m) : m;
+            for (idx_t i = i0; i < i1; ++i) {
+                const TA aij = alpha * A(i, j);
+                if (abs(real(aij)) > rmax || abs(imag(aij)) > rmax)
+                    return false;
+                B(i, j) = static_cast<TB>(aij);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Computes the residual R = B - A X.
+     *
+     * The entries of R may have a precision higher than the one of A, B and
+     * X. In this case, the products are accumulated in the precision of R.
+     *
+     * @param[in] uplo
+     *      - Uplo::General: A is a general matrix;
+     *      - Uplo::Upper or Uplo::Lower: A is Hermitian and only the upper or
+     *      lower triangle of A is referenced.
+     */
+    template <TLAPACK_UPLO uplo_t,
+              TLAPACK_MATRIX matrixA_t,
+              TLAPACK_MATRIX matrixB_t,
+              TLAPACK_MATRIX matrixX_t,
+              TLAPACK_MATRIX matrixR_t>
+    void ir_residual(uplo_t uplo,
+                     const matrixA_t& A,
+                     const matrixB_t& B,
+                     const matrixX_t& X,
+                     matrixR_t& R)
+    {
+        using T = type_t<matrixX_t>;
+        using TR = type_t<matrixR_t>;
+        using real_t = real_type<T>;
+        using realR_t = real_type<TR>;
+        using idx_t = size_type<matrixA_t>;
+
+        const idx_t n = nrows(A);
+        const idx_t nrhs = ncols(X);
+
+        ir_convert(GENERAL, real_t(1), B, R);
+
+        if constexpr (is_same_v<TR, T>) {
+            if (uplo == Uplo::General)
+                gemm(NO_TRANS, NO_TRANS, realR_t(-1), A, X, realR_t(1), R);
+            else
+                hemm(LEFT_SIDE, uplo, realR_t(-1), A, X, realR_t(1), R);
+        }
+        else {
+            // Entry (i,l) of A
+            auto a = [&](idx_t i, idx_t l) -> TR {
+                if (uplo == Uplo::General ||
+                    (uplo == Uplo::Upper ? i < l : i > l))
+                    return static_cast<TR>(A(i, l));
+                else if (i == l)
+                    return static_cast<TR>(real(A(i, l)));
+                else
+                    return static_cast<TR>(conj(A(l, i)));
+            };
+            for (idx_t j = 0; j < nrhs; ++j)
+                for (idx_t l = 0; l < n; ++l) {
+                    const TR xlj = static_cast<TR>(X(l, j));
+                    for (idx_t i = 0; i < n; ++i)
+                        R(i, j) -= a(i, l) * xlj;
+                }
+        }
+    }
+
+    /// Largest value of |Re(x[i])| + |Im(x[i])|, as in LAPACK's ZCGESV
+    template <TLAPACK_VECTOR vector_t>
+    real_type<type_t<vector_t>> ir_maxabs(const vector_t& x)
+    {
+        using real_t = real_type<type_t<vector_t>>;
+        using idx_t = size_type<vector_t>;
+
+        real_t r(0);
+        for (idx_t i = 0; i < size(x); ++i)
+            r = max(r, abs1(x[i]));
+        return r;
+    }
+
+    /**
+     * @brief Solves A d = r with GMRES left-preconditioned by an approximate
+     * factorization M of A.
+     *
+     * @param[in] matvec  matvec(v, w) sets w = A v.
+     * @param[in] precond precond(W) overwrites the n-by-k matrix W with
+     *      M^{-1} W.
+     * @param[out] V    n-by-(m+1) matrix, with m the maximum number of
+     *      iterations.
+     * @param[in,out] d n-by-1 matrix. On entry, r. On exit, d.
+     * @param[in] tol   Relative tolerance on the preconditioned residual.
+     *
+     * @return Number of GMRES iterations.
+     */
+    template <class matvec_t,
+              class precond_t,
+              TLAPACK_SMATRIX matrixV_t,
+              TLAPACK_SMATRIX matrixD_t,
+              TLAPACK_REAL real_t>
+    size_type<matrixV_t> ir_gmres(matvec_t& matvec,
+                                  precond_t& precond,
+                                  matrixV_t& V,
+                                  matrixD_t& d,
+                                  const real_t& tol)
+    {
+        using T = type_t<matrixV_t>;
+        using idx_t = size_type<matrixV_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = nrows(V);
+        const idx_t m = ncols(V) - 1;
+
+        // Hessenberg matrix, rotations and right-hand side of the least
+        // squares problem
+        Create<matrixV_t> new_matrix;
+        arena_vector<T> H_;
+        auto H = new_matrix(H_, m + 1, m);
+        arena_vector<real_t> c(m);
+        arena_vector<T> s(m);
+        arena_vector<T> g(m + 1, T(0));
+
+        // z0 = M^{-1} r
+        auto d0 = col(d, 0);
+        precond(d);
+        const real_t beta = nrm2(d0);
+        if (!(beta > real_t(0))) {
+            for (idx_t i = 0; i < n; ++i)
+                d0[i] = T(0);
+            return 0;
+        }
+        auto v0 = col(V, 0);
+        for (idx_t i = 0; i < n; ++i)
+            v0[i] = d0[i] / beta;
+        g[0] = beta;
+
+        idx_t k = 0;
+        while (k < m) {
+            // w = M^{-1} A v_k
+            auto vk = col(V, k);
+            auto W = slice(V, range(0, n), range(k + 1, k + 2));
+            auto w = col(V, k + 1);
+            matvec(vk, w);
+            precond(W);
+
+            // Modified Gram-Schmidt
+            for (idx_t i = 0; i <= k; ++i) {
+                auto vi = col(V, i);
+                H(i, k) = dot(vi, w);
+                axpy(-H(i, k), vi, w);
+            }
+            const real_t hk = nrm2(w);
+            H(k + 1, k) = hk;
+            if (hk > real_t(0)) scal(real_t(1) / hk, w);
+
+            // Apply the previous rotations to the new column of H
+            for (idx_t i = 0; i < k; ++i) {
+                const T aux = c[i] * H(i, k) + s[i] * H(i + 1, k);
+                H(i + 1, k) = c[i] * H(i + 1, k) - conj(s[i]) * H(i, k);
+                H(i, k) = aux;
+            }
+
+            // Annihilate H(k+1,k)
+            T a = H(k, k);
+            T b = H(k + 1, k);
+            rotg(a, b, c[k], s[k]);
+            H(k, k) = a;
+            H(k + 1, k) = T(0);
+            g[k + 1] = -conj(s[k]) * g[k];
+            g[k] = c[k] * g[k];
+
+            ++k;
+            if (!(hk > real_t(0)) || abs(g[k]) <= tol * beta) break;
+        }
+
+        // Solve the triangular least squares problem H y = g
+        arena_vector<T>& y = g;
+        for (idx_t i = k; i-- > 0;) {
+            for (idx_t j = i + 1; j < k; ++j)
+                y[i] -= H(i, j) * y[j];
+            y[i] /= H(i, i);
+        }
+
+        // d = V y
+        for (idx_t i = 0; i < n; ++i)
+            d0[i] = T(0);
+        for (idx_t j = 0; j < k; ++j)
+            axpy(y[j], col(V, j), d0);
+
+        return k;
+    }
+
+    /**
+     * @brief Iterative refinement for A X = B.
+     *
+     * The first approximation X = M^{-1} B uses the low-precision solver.
+     * Each step computes the residual R = B - A X, possibly in higher
+     * precision, and corrects X with an approximate solution of A D = R. The
+     * correction comes from the low-precision solver (classical refinement)
+     * or, once the classical refinement stagnates, from GMRES preconditioned
+     * by the low-precision factors (GMRES-IR).
+     *
+     * @param[in] residual residual(X, R) sets R = B - A X.
+     * @param[in] solve    solve(W) overwrites W with an approximation of
+     *      A^{-1} W computed in low precision.
+     * @param[in] matvec   matvec(v, w) sets w = A v.
+     * @param[in] precond  precond(W) overwrites W with M^{-1} W in working
+     *      precision, where M is the low-precision factorization.
+     * @param[in] B n-by-nrhs matrix.
+     * @param[out] X n-by-nrhs matrix.
+     * @param[out] R n-by-nrhs matrix.
+     * @param[in] cte Tolerance. Column j has converged if
+     *      max |R(:,j)| <= max |X(:,j)| * cte.
+     * @param[in] opts Options.
+     *
+     * @return iter >= 0 if the refinement converged in iter steps.
+     * @return -(opts.max_iters+1) if the refinement did not converge.
+     */
+    template <class residual_t,
+              class solve_t,
+              class matvec_t,
+              class precond_t,
+              TLAPACK_MATRIX matrixB_t,
+              TLAPACK_SMATRIX matrixX_t,
+              TLAPACK_MATRIX matrixR_t,
+              TLAPACK_REAL real_t>
+    int iterative_refinement(residual_t& residual,
+                             solve_t& solve,
+                             matvec_t& matvec,
+                             precond_t& precond,
+                             const matrixB_t& B,
+                             matrixX_t& X,
+                             matrixR_t& R,
+                             const real_t& cte,
+                             const IrOpts& opts)
+    {
+        using T = type_t<matrixX_t>;
+        using idx_t = size_type<matrixX_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = nrows(X);
+        const idx_t nrhs = ncols(X);
+        const int max_iters = (int)opts.max_iters;
+        const idx_t m = min<idx_t>(n, max<idx_t>(opts.gmres_max_iters, 1));
+        const real_t gmres_tol = (opts.gmres_tol > 0)
+                                     ? real_t(opts.gmres_tol)
+                                     : sqrt(ulp<real_t>());
+
+        // Allocates workspace
+        Create<matrixX_t> new_matrix;
+        arena_vector<T> D_;
+        auto D = new_matrix(D_, n, nrhs);
+        arena_vector<T> V_;
+
+        // X = M^{-1} B
+        lacpy(GENERAL, B, X);
+        solve(X);
+
+        bool use_gmres = false;
+        real_t prev_ratio(-1);
+        for (int iter = 0; iter <= max_iters; ++iter) {
+            residual(X, R);
+
+            // Check convergence
+            bool converged = true;
+            real_t ratio(0);
+            for (idx_t j = 0; j < nrhs; ++j) {
+                const real_t rnrm = static_cast<real_t>(ir_maxabs(col(R, j)));
+                const real_t xnrm = ir_maxabs(col(X, j));
+                if (!(rnrm <= xnrm * cte)) converged = false;
+                ratio = max(ratio, (xnrm > real_t(0)) ? rnrm / xnrm : rnrm);
+            }
+            if (converged) return iter;
+            if (iter == max_iters || isnan(ratio) || isinf(ratio)) break;
+
+            // Switch to GMRES-IR if the classical refinement stagnates
+            if (!use_gmres && opts.gmres && prev_ratio >= real_t(0) &&
+                ratio > real_t(opts.stagnation) * prev_ratio) {
+                use_gmres = true;
+                V_.clear();
+            }
+            prev_ratio = ratio;
+
+            // Correction D
+            ir_convert(GENERAL, real_type<type_t<matrixR_t>>(1), R, D);
+            if (!use_gmres)
+                solve(D);
+            else {
+                auto V = new_matrix(V_, n, m + 1);
+                for (idx_t j = 0; j < nrhs; ++j) {
+                    auto dj = slice(D, range(0, n), range(j, j + 1));
+                    ir_gmres(matvec, precond, V, dj, gmres_tol);
+                }
+            }
+
+            // X = X + D
+            for (idx_t j = 0; j < nrhs; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    X(i, j) += D(i, j);
+        }
+
+        return -(max_iters + 1);
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_ITERATIVE_REFINEMENT_HH
@@ -105,6 +105,8 @@ int lahqr(bool want_t,
         tlapack_check_false((n != ncols(Z)) or (n != nrows(Z)));
     }
 
+    tlapack_trace("lahqr", 0, 2. * sizeof(TA) * nh * nh);
+
     // quick return
     if (nh <= 0) return 0;
     if (nh == 1) w[ilo] = A(ilo, ilo);
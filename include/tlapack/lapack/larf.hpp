@@ -101,9 +101,16 @@ void larf_work(side_t side,
             gemv(TRANSPOSE, one, C1, x, one, w);
 
             // C1 := C1 - tau*conj(x)*w^t
-            for (idx_t j = 0; j < n; ++j)
+            if constexpr (layout<matrixC1_t> == Layout::RowMajor) {
                 for (idx_t i = 0; i < m; ++i)
-                    C1(i, j) -= tau * conj(x[i]) * w[j];
+                    for (idx_t j = 0; j < n; ++j)
+                        C1(i, j) -= tau * conj(x[i]) * w[j];
+            }
+            else {
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        C1(i, j) -= tau * conj(x[i]) * w[j];
+            }
 
             // C0 := C0 - tau*w^t
             for (idx_t i = 0; i < k; ++i)
@@ -128,9 +135,16 @@ void larf_work(side_t side,
             // w := C0 + C1*conj(x)
             for (idx_t i = 0; i < k; ++i)
                 w[i] = C0[i];
-            for (idx_t j = 0; j < n; ++j)
+            if constexpr (layout<matrixC1_t> == Layout::RowMajor) {
                 for (idx_t i = 0; i < m; ++i)
-                    w[i] += C1(i, j) * conj(x[j]);
+                    for (idx_t j = 0; j < n; ++j)
+                        w[i] += C1(i, j) * conj(x[j]);
+            }
+            else {
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        w[i] += C1(i, j) * conj(x[j]);
+            }
 
             // C1 := C1 - tau*w*x^t
             geru(-tau, w, x, C1);
@@ -293,7 +307,7 @@ void larf(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = larf_worksize<T>(side, storeMode, x, tau, C0, C1);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return larf_work(side, storeMode, x, tau, C0, C1, work);
@@ -525,7 +539,7 @@ void larf(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = larf_worksize<T>(side, direction, storeMode, v, tau, C);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return larf_work(side, direction, storeMode, v, tau, C, work);
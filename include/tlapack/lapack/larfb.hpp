@@ -12,6 +12,7 @@
 #ifndef TLAPACK_LARFB_HH
 #define TLAPACK_LARFB_HH
 
+#include "tlapack/base/ThreadPool.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/trmm.hpp"
@@ -146,6 +147,9 @@ int larfb_work(side_t side,
                                                        : (ncols(V) == n)));
     tlapack_check(nrows(Tmatrix) == ncols(Tmatrix));
 
+    tlapack_trace("larfb", internal::trace_flops<T>(4. * m * n * k),
+                  sizeof(T) * (2. * m * n + double(m + n) * k));
+
     // Quick return
     if (m <= 0 || n <= 0 || k <= 0) return 0;
 
@@ -538,12 +542,138 @@ int larfb(side_t side,
     // Allocates workspace
     WorkInfo workinfo =
         larfb_worksize<T>(side, trans, direction, storeMode, V, Tmatrix, C);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return larfb_work(side, trans, direction, storeMode, V, Tmatrix, C, work);
 }
 
+namespace internal {
+
+    /** Number of parts of C to which larfb_parallel() applies a block
+     * reflector of order k concurrently.
+     *
+     * C is split by columns if side = Side::Left, and by rows otherwise. Each
+     * part has at least 2k columns (rows), so that the products in larfb()
+     * keep their shapes.
+     *
+     * @param[in] num_threads Number of threads. If 0, use all threads of the
+     *      pool.
+     * @param[in] pool Thread pool. If nullptr, use ThreadPool::global().
+     */
+    template <class idx_t>
+    idx_t larfb_parallel_ntasks(Side side,
+                                idx_t m,
+                                idx_t n,
+                                idx_t k,
+                                size_t num_threads,
+                                const ThreadPool* pool)
+    {
+        if (num_threads == 1) return 1;
+
+        const ThreadPool& p = pool ? *pool : ThreadPool::global();
+        const idx_t nthreads =
+            (num_threads == 0) ? (idx_t)(p.size() + 1) : (idx_t)num_threads;
+        const idx_t nC = (side == Side::Left) ? n : m;
+
+        return max<idx_t>(1, min<idx_t>(nthreads, nC / max<idx_t>(2 * k, 1)));
+    }
+
+    /// Worspace query of larfb_parallel(). ntasks is the number of parts of C
+    /// given by larfb_parallel_ntasks()
+    template <class T,
+              TLAPACK_SMATRIX matrixV_t,
+              TLAPACK_MATRIX matrixT_t,
+              TLAPACK_SMATRIX matrixC_t>
+    constexpr WorkInfo larfb_parallel_worksize(Side side,
+                                               Op trans,
+                                               Direction direction,
+                                               StoreV storeMode,
+                                               const matrixV_t& V,
+                                               const matrixT_t& Tmatrix,
+                                               const matrixC_t& C,
+                                               size_type<matrixC_t> ntasks)
+    {
+        using idx_t = size_type<matrixC_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(C);
+        const idx_t n = ncols(C);
+
+        if (ntasks <= 1)
+            return larfb_worksize<T>(side, trans, direction, storeMode, V,
+                                     Tmatrix, C);
+
+        // Each part uses a column of a workspace with ntasks columns
+        const idx_t nC = (side == Side::Left) ? n : m;
+        const idx_t p = (nC + ntasks - 1) / ntasks;
+        const auto Cp = (side == Side::Left) ? slice(C, range{0, m}, range{0, p})
+                                             : slice(C, range{0, p}, range{0, n});
+        const WorkInfo workinfo = larfb_worksize<T>(side, trans, direction,
+                                                    storeMode, V, Tmatrix, Cp);
+
+        return (workinfo.size() > 0) ? WorkInfo(workinfo.size(), ntasks)
+                                     : WorkInfo(0);
+    }
+
+    /** Applies a block reflector to C with larfb_work(), splitting C in ntasks
+     * parts that are updated concurrently.
+     *
+     * @see larfb() for the description of the arguments.
+     *
+     * @param work Workspace. See larfb_parallel_worksize().
+     * @param[in] ntasks Number of parts of C, see larfb_parallel_ntasks().
+     * @param[in] pool Thread pool. If nullptr, use ThreadPool::global().
+     */
+    template <TLAPACK_SMATRIX matrixV_t,
+              TLAPACK_MATRIX matrixT_t,
+              TLAPACK_SMATRIX matrixC_t,
+              TLAPACK_WORKSPACE work_t>
+    int larfb_parallel(Side side,
+                       Op trans,
+                       Direction direction,
+                       StoreV storeMode,
+                       const matrixV_t& V,
+                       const matrixT_t& Tmatrix,
+                       matrixC_t& C,
+                       work_t& work,
+                       size_type<matrixC_t> ntasks,
+                       ThreadPool* pool)
+    {
+        using idx_t = size_type<matrixC_t>;
+        using T = type_t<work_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(C);
+        const idx_t n = ncols(C);
+
+        if (ntasks <= 1)
+            return larfb_work(side, trans, direction, storeMode, V, Tmatrix, C,
+                              work);
+
+        const idx_t nC = (side == Side::Left) ? n : m;
+        const idx_t p = (nC + ntasks - 1) / ntasks;
+        const WorkInfo workinfo = larfb_parallel_worksize<T>(
+            side, trans, direction, storeMode, V, Tmatrix, C, ntasks);
+        auto [W, work1] = reshape(work, workinfo.m, workinfo.n);
+
+        ThreadPool& tp = pool ? *pool : ThreadPool::global();
+        tp.parallel_for(ntasks, ntasks, [&](size_t t) {
+            const idx_t j0 = min<idx_t>(idx_t(t) * p, nC);
+            const idx_t j1 = min<idx_t>(j0 + p, nC);
+            if (j0 >= j1) return;
+
+            auto Ct = (side == Side::Left) ? slice(C, range{0, m}, range{j0, j1})
+                                           : slice(C, range{j0, j1}, range{0, n});
+            auto Wt = slice(W, range{0, workinfo.m}, t);
+            larfb_work(side, trans, direction, storeMode, V, Tmatrix, Ct, Wt);
+        });
+
+        return 0;
+    }
+
+}  // namespace internal
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_LARFB_HH
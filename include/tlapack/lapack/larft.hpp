@@ -15,6 +15,7 @@
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/trmm.hpp"
 #include "tlapack/blas/trmv.hpp"
 
 namespace tlapack {
@@ -119,6 +120,9 @@ int larft(direction_t direction,
         k > ((storeMode == StoreV::Columnwise) ? ncols(V) : nrows(V)));
     tlapack_check_false(nrows(T) < k || ncols(T) < k);
 
+    tlapack_trace("larft", internal::trace_flops<scalar_t>(double(n) * k * k),
+                  sizeof(scalar_t) * (double(n) * k + double(k) * k));
+
     // Quick return
     if (n == 0 || k == 0) return 0;
 
@@ -228,6 +232,105 @@ int larft(direction_t direction,
     return 0;
 }
 
+namespace internal {
+
+    /** Forms the triangular factor T of a block reflector from the factors of
+     * blocks of at most nb reflectors.
+     *
+     * If direction = Direction::Forward, the reflectors are split in two groups
+     * and
+     * \[
+     *      T = \begin{bmatrix} T_{11} & T_{12} \\ 0 & T_{22} \end{bmatrix},
+     *      \quad T_{12} = -T_{11} V_1^H V_2 T_{22},
+     * \]
+     * where $T_{11}$ and $T_{22}$ are formed recursively, and $T_{12}$ with
+     * trmm() and gemm(). Only the factors of nb reflectors use the level 2
+     * algorithm of larft(). If direction = Direction::Backward, T is formed by
+     * larft().
+     *
+     * @see larft() for the description of the arguments.
+     *
+     * @param[in] nb Number of reflectors in the blocks formed by larft().
+     */
+    template <TLAPACK_DIRECTION direction_t,
+              TLAPACK_STOREV storage_t,
+              TLAPACK_SMATRIX matrixV_t,
+              TLAPACK_VECTOR vector_t,
+              TLAPACK_SMATRIX matrixT_t>
+    int larft_recursive(direction_t direction,
+                        storage_t storeMode,
+                        const matrixV_t& V,
+                        const vector_t& tau,
+                        matrixT_t& T,
+                        size_type<matrixV_t> nb)
+    {
+        using scalar_t = type_t<matrixT_t>;
+        using real_t = real_type<scalar_t>;
+        using idx_t = size_type<matrixV_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const real_t one(1);
+        const idx_t n = (storeMode == StoreV::Columnwise) ? nrows(V) : ncols(V);
+        const idx_t k = size(tau);
+
+        if (direction == Direction::Backward || k <= nb || n < k)
+            return larft(direction, storeMode, V, tau, T);
+
+        // Split the reflectors at a multiple of nb
+        const idx_t k1 = ((k / 2 + nb - 1) / nb) * nb;
+
+        auto T11 = slice(T, range{0, k1}, range{0, k1});
+        auto T12 = slice(T, range{0, k1}, range{k1, k});
+        auto T22 = slice(T, range{k1, k}, range{k1, k});
+        const auto tau1 = slice(tau, range{0, k1});
+        const auto tau2 = slice(tau, range{k1, k});
+
+        if (storeMode == StoreV::Columnwise) {
+            larft_recursive(direction, storeMode,
+                            slice(V, range{0, n}, range{0, k1}), tau1, T11, nb);
+            larft_recursive(direction, storeMode,
+                            slice(V, range{k1, n}, range{k1, k}), tau2, T22,
+                            nb);
+
+            // T12 := V(k1:n,0:k1)^H V(k1:n,k1:k), where V(k1:k,k1:k) is unit
+            // lower triangular
+            for (idx_t j = 0; j < k - k1; ++j)
+                for (idx_t i = 0; i < k1; ++i)
+                    T12(i, j) = conj(V(k1 + j, i));
+            trmm(RIGHT_SIDE, LOWER_TRIANGLE, NO_TRANS, UNIT_DIAG, one,
+                 slice(V, range{k1, k}, range{k1, k}), T12);
+            gemm(CONJ_TRANS, NO_TRANS, one, slice(V, range{k, n}, range{0, k1}),
+                 slice(V, range{k, n}, range{k1, k}), one, T12);
+        }
+        else {
+            larft_recursive(direction, storeMode,
+                            slice(V, range{0, k1}, range{0, n}), tau1, T11, nb);
+            larft_recursive(direction, storeMode,
+                            slice(V, range{k1, k}, range{k1, n}), tau2, T22,
+                            nb);
+
+            // T12 := V(0:k1,k1:n) V(k1:k,k1:n)^H, where V(k1:k,k1:k) is unit
+            // upper triangular
+            for (idx_t j = 0; j < k - k1; ++j)
+                for (idx_t i = 0; i < k1; ++i)
+                    T12(i, j) = V(i, k1 + j);
+            trmm(RIGHT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, UNIT_DIAG, one,
+                 slice(V, range{k1, k}, range{k1, k}), T12);
+            gemm(NO_TRANS, CONJ_TRANS, one, slice(V, range{0, k1}, range{k, n}),
+                 slice(V, range{k1, k}, range{k, n}), one, T12);
+        }
+
+        // T12 := - T11 T12 T22
+        trmm(LEFT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, -one, T11,
+             T12);
+        trmm(RIGHT_SIDE, UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, one, T22,
+             T12);
+
+        return 0;
+    }
+
+}  // namespace internal
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_LARFT_HH
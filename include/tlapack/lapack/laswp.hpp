@@ -0,0 +1,117 @@
+/// @file laswp.hpp Applies a sequence of row interchanges to a matrix.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LASWP_HH
+#define TLAPACK_LASWP_HH
+
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for laswp()
+struct LaswpOpts {
+    size_t nb = 32;              ///< Number of columns swapped at a time
+    size_t num_threads = 1;      ///< Number of threads. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
+};
+
+/** Applies a sequence of row interchanges to a matrix A.
+ *
+ * For each i in [k0,k1), rows i and piv[i] of A are interchanged. The
+ * interchanges are applied in increasing order of i if direction is Forward,
+ * and in decreasing order of i if direction is Backward.
+ *
+ * The columns of A are processed in blocks of opts.nb columns. All
+ * interchanges are applied to a block before moving to the next one, so that
+ * each block is loaded in cache only once. The blocks are distributed among
+ * opts.num_threads threads.
+ *
+ * @param[in] direction
+ *      - Direction::Forward: apply the interchanges for i = k0, ..., k1-1;
+ *      - Direction::Backward: apply the interchanges for i = k1-1, ..., k0.
+ *
+ * @param[in,out] A m-by-n matrix.
+ *
+ * @param[in] piv Vector of size at least k1.
+ *      piv[i] is the row interchanged with row i, k0 <= i < k1.
+ *
+ * @param[in] k0 First interchange to apply.
+ * @param[in] k1 One past the last interchange to apply.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: number of columns in each block.
+ *      - @c opts.num_threads, @c opts.pool: threads used to process the
+ *        blocks.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_DIRECTION direction_t,
+          TLAPACK_SMATRIX matrix_t,
+          TLAPACK_VECTOR piv_t>
+void laswp(direction_t direction,
+           matrix_t& A,
+           const piv_t& piv,
+           size_type<matrix_t> k0,
+           size_type<matrix_t> k1,
+           const LaswpOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // constants
+    const idx_t n = ncols(A);
+    const idx_t nb = max<idx_t>(opts.nb, 1);
+    const bool forward = (direction == Direction::Forward);
+
+    // check arguments
+    tlapack_check(direction == Direction::Forward ||
+                  direction == Direction::Backward);
+    tlapack_check(k0 <= k1 && k1 <= nrows(A));
+    tlapack_check((idx_t)size(piv) >= k1);
+
+    // quick return
+    if (n <= 0 || k0 >= k1) return;
+
+    // Swaps columns j0:j1 of A
+    auto swap_block = [&](idx_t j0, idx_t j1) {
+        for (idx_t ii = k0; ii < k1; ++ii) {
+            const idx_t i = forward ? ii : k0 + k1 - 1 - ii;
+            const idx_t p = piv[i];
+            if (p != i) {
+                for (idx_t j = j0; j < j1; ++j) {
+                    const T aux = A(i, j);
+                    A(i, j) = A(p, j);
+                    A(p, j) = aux;
+                }
+            }
+        }
+    };
+
+    const size_t nblocks = (n + nb - 1) / nb;
+    if (opts.num_threads == 1 || nblocks == 1) {
+        for (idx_t j0 = 0; j0 < n; j0 += nb)
+            swap_block(j0, min(j0 + nb, n));
+    }
+    else {
+        ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+        const size_t nthreads =
+            (opts.num_threads == 0) ? pool.size() + 1 : opts.num_threads;
+        pool.parallel_for(nblocks, nthreads, [&](size_t b) {
+            const idx_t j0 = idx_t(b) * nb;
+            swap_block(j0, min(j0 + nb, n));
+        });
+    }
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LASWP_HH
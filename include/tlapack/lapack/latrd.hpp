@@ -0,0 +1,199 @@
+/// @file latrd.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlatrd.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_LATRD_HH
+#define TLAPACK_LATRD_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/axpy.hpp"
+#include "tlapack/blas/dot.hpp"
+#include "tlapack/blas/gemv.hpp"
+#include "tlapack/blas/hemv.hpp"
+#include "tlapack/blas/scal.hpp"
+#include "tlapack/lapack/conjugate.hpp"
+#include "tlapack/lapack/larfg.hpp"
+
+namespace tlapack {
+
+/** Reduces nb rows and columns of a hermitian matrix A to real symmetric
+ * tridiagonal form by a unitary similarity transformation Q**H * A * Q, and
+ * returns the matrix W which is needed to apply the transformation to the
+ * unreduced part of A.
+ *
+ * If uplo = Upper, the last nb rows and columns are reduced; if uplo = Lower,
+ * the first nb rows and columns are reduced. The unreduced part of A can be
+ * updated by a rank-2k update of the form A := A - V*W**H - W*V**H.
+ *
+ * This is an auxiliary routine called by hetrd
+ *
+ * @return  0 if success
+ *
+ * @tparam uplo_t Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper:   Upper triangle of A is referenced;
+ *      - Uplo::Lower:   Lower triangle of A is referenced;
+ *
+ * @param[in,out] A n-by-n hermitian matrix.
+ *      On exit, the reduced rows and columns contain the elementary reflectors
+ *      V. The elements of V that correspond to the off-diagonal of the
+ *      tridiagonal matrix are set to one.
+ *
+ * @param[out] e Vector of length n-1.
+ *      The off-diagonal elements of the reduced part of the tridiagonal
+ *      matrix: e[i], 0 <= i < nb, if uplo = Lower, and e[i], n-nb-1 <= i <
+ *      n-1, if uplo = Upper.
+ *
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors, in the same positions
+ *      as e.
+ *
+ * @param[out] W n-by-nb matrix.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX A_t,
+          TLAPACK_VECTOR e_t,
+          TLAPACK_VECTOR tau_t,
+          TLAPACK_SMATRIX W_t,
+          class uplo_t>
+int latrd(uplo_t uplo, A_t& A, e_t& e, tau_t& tau, W_t& W)
+{
+    using T = type_t<A_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<A_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // constants
+    const real_t one(1);
+    const real_t half(0.5);
+    const idx_t n = nrows(A);
+    const idx_t nb = ncols(W);
+
+    // check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+    tlapack_check(nrows(W) == n && nb <= n);
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if (uplo == Uplo::Upper) {
+        //
+        // Reduce last nb columns of upper triangle
+        //
+        for (idx_t i = n - 1; i != n - nb - 1; --i) {
+            const idx_t iw = i - n + nb;
+
+            // Update A(0:i+1,i)
+            if (i < n - 1) {
+                A(i, i) = real(A(i, i));
+                auto a = slice(A, range{0, i + 1}, i);
+
+                auto w = slice(W, i, range{iw + 1, nb});
+                auto A2 = slice(A, range{0, i + 1}, range{i + 1, n});
+                conjugate(w);
+                gemv(NO_TRANS, -one, A2, w, one, a);
+                conjugate(w);
+
+                auto x = slice(A, i, range{i + 1, n});
+                auto W2 = slice(W, range{0, i + 1}, range{iw + 1, nb});
+                conjugate(x);
+                gemv(NO_TRANS, -one, W2, x, one, a);
+                conjugate(x);
+            }
+            A(i, i) = real(A(i, i));
+
+            if (i > 0) {
+                // Generate elementary reflector H(i-1) to annihilate
+                // A(0:i-1,i)
+                auto v = slice(A, range{0, i}, i);
+                larfg(BACKWARD, COLUMNWISE_STORAGE, v, tau[i - 1]);
+                e[i - 1] = real(A(i - 1, i));
+                A(i - 1, i) = one;
+
+                // Compute W(0:i,iw)
+                auto w = slice(W, range{0, i}, iw);
+                hemv(UPPER_TRIANGLE, one, slice(A, range{0, i}, range{0, i}),
+                     v, w);
+                if (i < n - 1) {
+                    auto t = slice(W, range{i + 1, n}, iw);
+                    auto W2 = slice(W, range{0, i}, range{iw + 1, nb});
+                    auto A2 = slice(A, range{0, i}, range{i + 1, n});
+                    gemv(CONJ_TRANS, one, W2, v, t);
+                    gemv(NO_TRANS, -one, A2, t, one, w);
+                    gemv(CONJ_TRANS, one, A2, v, t);
+                    gemv(NO_TRANS, -one, W2, t, one, w);
+                }
+                scal(tau[i - 1], w);
+                const T alpha = -half * tau[i - 1] * dot(w, v);
+                axpy(alpha, v, w);
+            }
+        }
+    }
+    else {
+        //
+        // Reduce first nb columns of lower triangle
+        //
+        for (idx_t i = 0; i < nb; ++i) {
+            // Update A(i:n,i)
+            if (i > 0) {
+                A(i, i) = real(A(i, i));
+                auto a = slice(A, range{i, n}, i);
+
+                auto w = slice(W, i, range{0, i});
+                auto A2 = slice(A, range{i, n}, range{0, i});
+                conjugate(w);
+                gemv(NO_TRANS, -one, A2, w, one, a);
+                conjugate(w);
+
+                auto x = slice(A, i, range{0, i});
+                auto W2 = slice(W, range{i, n}, range{0, i});
+                conjugate(x);
+                gemv(NO_TRANS, -one, W2, x, one, a);
+                conjugate(x);
+            }
+            A(i, i) = real(A(i, i));
+
+            if (i < n - 1) {
+                // Generate elementary reflector H(i) to annihilate
+                // A(i+2:n,i)
+                auto v = slice(A, range{i + 1, n}, i);
+                larfg(FORWARD, COLUMNWISE_STORAGE, v, tau[i]);
+                e[i] = real(A(i + 1, i));
+                A(i + 1, i) = one;
+
+                // Compute W(i+1:n,i)
+                auto w = slice(W, range{i + 1, n}, i);
+                hemv(LOWER_TRIANGLE, one,
+                     slice(A, range{i + 1, n}, range{i + 1, n}), v, w);
+                if (i > 0) {
+                    auto t = slice(W, range{0, i}, i);
+                    auto W2 = slice(W, range{i + 1, n}, range{0, i});
+                    auto A2 = slice(A, range{i + 1, n}, range{0, i});
+                    gemv(CONJ_TRANS, one, W2, v, t);
+                    gemv(NO_TRANS, -one, A2, t, one, w);
+                    gemv(CONJ_TRANS, one, A2, v, t);
+                    gemv(NO_TRANS, -one, W2, t, one, w);
+                }
+                scal(tau[i], w);
+                const T alpha = -half * tau[i] * dot(w, v);
+                axpy(alpha, v, w);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_LATRD_HH
@@ -58,6 +58,9 @@ int lauum_recursive(const Uplo& uplo, matrix_t& C)
     tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
     tlapack_check_false(nrows(C) != ncols(C));
 
+    tlapack_trace("lauum", internal::trace_flops<T>(double(n) * n * n / 3),
+                  sizeof(T) * double(n) * n);
+
     // Quick return
     if (n <= 0) return 0;
 
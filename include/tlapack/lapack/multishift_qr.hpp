@@ -161,6 +161,8 @@ int multishift_qr_work(bool want_t,
         tlapack_check_false((n != ncols(Z)) or (n != nrows(Z)));
     }
 
+    tlapack_trace("multishift_qr", 0, 2. * sizeof(TA) * n * n);
+
     // quick return
     if (nh <= 0) return 0;
     if (nh == 1) w[ilo] = A(ilo, ilo);
@@ -353,7 +355,7 @@ int multishift_qr_work(bool want_t,
         n_sweep = n_sweep + 1;
         n_shifts_total = n_shifts_total + ns;
         multishift_QR_sweep_work(want_t, want_z, istart, istop, A, shifts, Z,
-                                 work);
+                                 work, opts);
     }
 
     opts.n_aed = n_aed;
@@ -433,6 +435,8 @@ int multishift_qr_work(bool want_t,
  *      into Z.
  *
  * @param[in,out] opts Options.
+ *      - @c opts.num_threads and @c opts.pool: threads used to update the
+ *        parts of A and Z away from the diagonal in the sweeps and in AED.
  *      - Output parameters
  *          @c opts.n_aed,
  *          @c opts.n_sweep and
@@ -479,7 +483,7 @@ int multishift_qr(bool want_t,
     // Allocates workspace
     WorkInfo workinfo =
         multishift_qr_worksize<TA>(want_t, want_z, ilo, ihi, A, w, Z, opts);
-    std::vector<TA> work_;
+    arena_vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return multishift_qr_work(want_t, want_z, ilo, ihi, A, w, Z, work, opts);
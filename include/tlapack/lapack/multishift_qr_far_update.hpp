@@ -0,0 +1,156 @@
+/// @file multishift_qr_far_update.hpp
+/// @author Thijs Steel, KU Leuven, Belgium
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_MULTISHIFT_QR_FAR_UPDATE_HH
+#define TLAPACK_MULTISHIFT_QR_FAR_UPDATE_HH
+
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/lapack/FrancisOpts.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /** Applies an orthogonal transformation of a diagonal block of A to the
+     * parts of A and Z that lie away from the diagonal.
+     *
+     * Given the k-by-k unitary matrix U acting on the rows and columns
+     * j0:j0+k, computes
+     *
+     *      A(j0:j0+k, j0+k:istop_m) := U^H * A(j0:j0+k, j0+k:istop_m),
+     *      A(istart_m:j0, j0:j0+k) := A(istart_m:j0, j0:j0+k) * U,
+     *      Z(:, j0:j0+k) := Z(:, j0:j0+k) * U, if want_z.
+     *
+     * The products are computed by blocks of columns (horizontal) or rows
+     * (vertical) with gemm() into the workspaces WH and WV, and copied back.
+     * The blocks are split among the threads, each of which uses its own
+     * part of WH and WV.
+     *
+     * @param[in] want_z bool.
+     * @param[in,out] A n-by-n matrix.
+     * @param[in,out] Z n-by-n matrix.
+     * @param[in] U k-by-k unitary matrix.
+     * @param[in] j0 First row and column of the block.
+     * @param[in] istart_m First row of A updated from the right.
+     * @param[in] istop_m Last column of A (exclusive) updated from the left.
+     * @param WH k-by-nh workspace.
+     * @param WV nv-by-k workspace.
+     * @param[in] opts Options.
+     *      - @c opts.num_threads: number of threads.
+     *      - @c opts.pool: thread pool.
+     */
+    template <TLAPACK_SMATRIX matrix_t,
+              TLAPACK_SMATRIX U_t,
+              TLAPACK_SMATRIX WH_t,
+              TLAPACK_SMATRIX WV_t>
+    void multishift_qr_far_update(bool want_z,
+                                  matrix_t& A,
+                                  matrix_t& Z,
+                                  const U_t& U,
+                                  size_type<matrix_t> j0,
+                                  size_type<matrix_t> istart_m,
+                                  size_type<matrix_t> istop_m,
+                                  WH_t& WH,
+                                  WV_t& WV,
+                                  const FrancisOpts& opts)
+    {
+        using T = type_t<matrix_t>;
+        using real_t = real_type<T>;
+        using idx_t = size_type<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const real_t one(1);
+        const idx_t n = ncols(A);
+        const idx_t k = nrows(U);
+        const idx_t j1 = j0 + k;
+
+        // Quick return
+        if (k == 0) return;
+
+        // The global pool is not used when a single thread is requested
+        ThreadPool* pool = opts.pool;
+        if (!pool && opts.num_threads != 1) pool = &ThreadPool::global();
+        idx_t nthreads = 1;
+        if (pool)
+            nthreads = (opts.num_threads == 0) ? (idx_t)(pool->size() + 1)
+                                               : (idx_t)opts.num_threads;
+        const idx_t nt = max<idx_t>(
+            1, min(nthreads, min<idx_t>(ncols(WH), nrows(WV))));
+
+        // Updates the rows or columns i0:i1 of a matrix by blocks of size nw
+        auto blocks = [](idx_t i0, idx_t i1, idx_t nw, auto&& f) {
+            for (idx_t i = i0; i < i1; i += nw)
+                f(i, min(i + nw, i1));
+        };
+
+        auto update = [&](size_t t) {
+            // Part of the range i0:i1 assigned to the task t
+            auto part = [&](idx_t i0, idx_t i1) {
+                return range{i0 + (i1 - i0) * t / nt,
+                             i0 + (i1 - i0) * (t + 1) / nt};
+            };
+            const range wh_cols = part(0, ncols(WH));
+            const range wv_rows = part(0, nrows(WV));
+            const idx_t nh = wh_cols.second - wh_cols.first;
+            const idx_t nv = wv_rows.second - wv_rows.first;
+
+            // Horizontal multiply
+            if (j1 < istop_m) {
+                const range cols = part(j1, istop_m);
+                blocks(cols.first, cols.second, nh, [&](idx_t i, idx_t i2) {
+                    auto A_slice = slice(A, range{j0, j1}, range{i, i2});
+                    auto WH_slice =
+                        slice(WH, range{0, k},
+                              range{wh_cols.first, wh_cols.first + i2 - i});
+                    gemm(CONJ_TRANS, NO_TRANS, one, U, A_slice, WH_slice);
+                    lacpy(GENERAL, WH_slice, A_slice);
+                });
+            }
+
+            // Vertical multiply
+            if (istart_m < j0) {
+                const range rows = part(istart_m, j0);
+                blocks(rows.first, rows.second, nv, [&](idx_t i, idx_t i2) {
+                    auto A_slice = slice(A, range{i, i2}, range{j0, j1});
+                    auto WV_slice =
+                        slice(WV, range{wv_rows.first, wv_rows.first + i2 - i},
+                              range{0, k});
+                    gemm(NO_TRANS, NO_TRANS, one, A_slice, U, WV_slice);
+                    lacpy(GENERAL, WV_slice, A_slice);
+                });
+            }
+
+            // Update Z (also a vertical multiplication)
+            if (want_z) {
+                const range rows = part(0, n);
+                blocks(rows.first, rows.second, nv, [&](idx_t i, idx_t i2) {
+                    auto Z_slice = slice(Z, range{i, i2}, range{j0, j1});
+                    auto WV_slice =
+                        slice(WV, range{wv_rows.first, wv_rows.first + i2 - i},
+                              range{0, k});
+                    gemm(NO_TRANS, NO_TRANS, one, Z_slice, U, WV_slice);
+                    lacpy(GENERAL, WV_slice, Z_slice);
+                });
+            }
+        };
+
+        if (pool)
+            pool->parallel_for(nt, nt, update);
+        else
+            update(0);
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_MULTISHIFT_QR_FAR_UPDATE_HH
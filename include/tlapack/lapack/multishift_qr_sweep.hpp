@@ -11,10 +11,10 @@
 #define TLAPACK_QR_SWEEP_HH
 
 #include "tlapack/base/utils.hpp"
-#include "tlapack/blas/gemm.hpp"
 #include "tlapack/lapack/lahqr_shiftcolumn.hpp"
 #include "tlapack/lapack/larfg.hpp"
 #include "tlapack/lapack/move_bulge.hpp"
+#include "tlapack/lapack/multishift_qr_far_update.hpp"
 
 namespace tlapack {
 /** Worspace query of multishift_QR_sweep()
@@ -81,7 +81,8 @@ void multishift_QR_sweep_work(bool want_t,
                               matrix_t& A,
                               const vector_t& s,
                               matrix_t& Z,
-                              work_t& work)
+                              work_t& work,
+                              const FrancisOpts& opts = {})
 {
     using TA = type_t<matrix_t>;
     using real_t = real_type<TA>;
@@ -102,6 +103,9 @@ void multishift_QR_sweep_work(bool want_t,
         tlapack_check(nrows(Z) == n);
     }
 
+    tlapack_trace("multishift_QR_sweep", 0,
+                  2. * sizeof(TA) * (ihi - ilo) * (ihi - ilo));
+
     // Matrix V
     auto [V, work1] = reshape(work, 3, size(s) / 2);
 
@@ -299,48 +303,8 @@ void multishift_QR_sweep_work(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
-        // Horizontal multiply
-        if (ilo + n_shifts + 1 < istop_m) {
-            idx_t i = ilo + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto A_slice =
-                    slice(A, range{ilo, ilo + n_block}, range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, U2, A_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Vertical multiply
-        if (istart_m < ilo) {
-            idx_t i = istart_m;
-            while (i < ilo) {
-                idx_t iblock = std::min<idx_t>(ilo - i, nrows(WV));
-                auto A_slice =
-                    slice(A, range{i, i + iblock}, range{ilo, ilo + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, A_slice, U2, WV_slice);
-                lacpy(GENERAL, WV_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Z (also a vertical multiplication)
-        if (want_z) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Z_slice =
-                    slice(Z, range{i, i + iblock}, range{ilo, ilo + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Z_slice)},
-                                      range{0, ncols(Z_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Z_slice, U2, WV_slice);
-                lacpy(GENERAL, WV_slice, Z_slice);
-                i = i + iblock;
-            }
-        }
+        internal::multishift_qr_far_update(want_z, A, Z, U2, ilo, istart_m,
+                                           istop_m, WH, WV, opts);
 
         i_pos_block = ilo + n_block - n_shifts;
     }
@@ -511,49 +475,8 @@ void multishift_QR_sweep_work(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
-        // Horizontal multiply
-        if (i_pos_block + n_block < istop_m) {
-            idx_t i = i_pos_block + n_block;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto A_slice =
-                    slice(A, range{i_pos_block, i_pos_block + n_block},
-                          range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, U2, A_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Vertical multiply
-        if (istart_m < i_pos_block) {
-            idx_t i = istart_m;
-            while (i < i_pos_block) {
-                idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
-                auto A_slice = slice(A, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, A_slice, U2, WV_slice);
-                lacpy(GENERAL, WV_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Z (also a vertical multiplication)
-        if (want_z) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Z_slice = slice(Z, range{i, i + iblock},
-                                     range{i_pos_block, i_pos_block + n_block});
-                auto WV_slice = slice(WV, range{0, nrows(Z_slice)},
-                                      range{0, ncols(Z_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Z_slice, U2, WV_slice);
-                lacpy(GENERAL, WV_slice, Z_slice);
-                i = i + iblock;
-            }
-        }
+        internal::multishift_qr_far_update(want_z, A, Z, U2, i_pos_block,
+                                           istart_m, istop_m, WH, WV, opts);
 
         i_pos_block = i_pos_block + n_pos;
     }
@@ -771,48 +694,8 @@ void multishift_QR_sweep_work(bool want_t,
             istart_m = ilo;
             istop_m = ihi;
         }
-        // Horizontal multiply
-        if (ihi < istop_m) {
-            idx_t i = ihi;
-            while (i < istop_m) {
-                idx_t iblock = std::min<idx_t>(istop_m - i, ncols(WH));
-                auto A_slice =
-                    slice(A, range{i_pos_block, ihi}, range{i, i + iblock});
-                auto WH_slice = slice(WH, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(CONJ_TRANS, NO_TRANS, one, U2, A_slice, WH_slice);
-                lacpy(GENERAL, WH_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Vertical multiply
-        if (istart_m < i_pos_block) {
-            idx_t i = istart_m;
-            while (i < i_pos_block) {
-                idx_t iblock = std::min<idx_t>(i_pos_block - i, nrows(WV));
-                auto A_slice =
-                    slice(A, range{i, i + iblock}, range{i_pos_block, ihi});
-                auto WV_slice = slice(WV, range{0, nrows(A_slice)},
-                                      range{0, ncols(A_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, A_slice, U2, WV_slice);
-                lacpy(GENERAL, WV_slice, A_slice);
-                i = i + iblock;
-            }
-        }
-        // Update Z (also a vertical multiplication)
-        if (want_z) {
-            idx_t i = 0;
-            while (i < n) {
-                idx_t iblock = std::min<idx_t>(n - i, nrows(WV));
-                auto Z_slice =
-                    slice(Z, range{i, i + iblock}, range{i_pos_block, ihi});
-                auto WV_slice = slice(WV, range{0, nrows(Z_slice)},
-                                      range{0, ncols(Z_slice)});
-                gemm(NO_TRANS, NO_TRANS, one, Z_slice, U2, WV_slice);
-                lacpy(GENERAL, WV_slice, Z_slice);
-                i = i + iblock;
-            }
-        }
+        internal::multishift_qr_far_update(want_z, A, Z, U2, i_pos_block,
+                                           istart_m, istop_m, WH, WV, opts);
     }
 }
 
@@ -841,6 +724,11 @@ void multishift_QR_sweep_work(bool want_t,
  *      On exit, the orthogonal updates applied to A accumulated
  *      into Z.
  *
+ * @param[in] opts Options.
+ *      - @c opts.num_threads and @c opts.pool: threads used to update the
+ *        parts of A and Z away from the diagonal after each chain of bulges
+ *        is moved.
+ *
  * @ingroup alloc_workspace
  */
 template <TLAPACK_SMATRIX matrix_t,
@@ -852,7 +740,8 @@ void multishift_QR_sweep(bool want_t,
                          size_type<matrix_t> ihi,
                          matrix_t& A,
                          const vector_t& s,
-                         matrix_t& Z)
+                         matrix_t& Z,
+                         const FrancisOpts& opts = {})
 {
     using TA = type_t<matrix_t>;
 
@@ -862,10 +751,10 @@ void multishift_QR_sweep(bool want_t,
     // Allocates workspace
     WorkInfo workinfo =
         multishift_QR_sweep_worksize<TA>(want_t, want_z, ilo, ihi, A, s, Z);
-    std::vector<TA> work_;
+    arena_vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
-    multishift_QR_sweep_work(want_t, want_z, ilo, ihi, A, s, Z, work);
+    multishift_QR_sweep_work(want_t, want_z, ilo, ihi, A, s, Z, work, opts);
 }
 
 }  // namespace tlapack
@@ -0,0 +1,111 @@
+/// @file pbtf2.hpp Computes the Cholesky factorization of a Hermitian
+/// positive definite band matrix using a level-2 algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PBTF2_HH
+#define TLAPACK_PBTF2_HH
+
+#include "tlapack/LegacyBandedMatrix.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorization of a Hermitian positive definite band
+ * matrix A using a level-2 algorithm.
+ *
+ * The factorization has the form
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular band matrix with kd superdiagonals and L is a
+ * lower triangular band matrix with kd subdiagonals.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is stored, with kd = A.ku;
+ *      - Uplo::Lower: Lower triangle of A is stored, with kd = A.kl.
+ *
+ * @param[in,out] A n-by-n band matrix.
+ *      On entry, the Hermitian band matrix A.
+ *      On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @return = 0: successful exit
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *     positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, typename T, class idx_t>
+int pbtf2(uplo_t uplo, LegacyBandedMatrix<T, idx_t>& A)
+{
+    using real_t = real_type<T>;
+
+    // Constants
+    const real_t zero(0);
+    const idx_t n = A.n;
+    const idx_t kd = (uplo == Uplo::Upper) ? A.ku : A.kl;
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(A.m == A.n);
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    for (idx_t j = 0; j < n; ++j) {
+        // Compute the diagonal entry and test for non-positive-definiteness
+        real_t ajj = real(A(j, j));
+        if (ajj > zero) {
+            ajj = sqrt(ajj);
+            A(j, j) = T(ajj);
+        }
+        else {
+            tlapack_error(
+                j + 1,
+                "The leading minor of order j+1 is not positive definite,"
+                " and the factorization could not be completed.");
+            return j + 1;
+        }
+
+        const idx_t kn = min(kd, n - 1 - j);
+        if (uplo == Uplo::Upper) {
+            // Compute elements j+1:j+kn of row j and update the trailing
+            // submatrix within the band
+            for (idx_t c = j + 1; c <= j + kn; ++c)
+                A(j, c) /= ajj;
+            for (idx_t c = j + 1; c <= j + kn; ++c) {
+                const T ajc = A(j, c);
+                for (idx_t i = j + 1; i <= c; ++i)
+                    A(i, c) -= conj(A(j, i)) * ajc;
+                A(c, c) = real(A(c, c));
+            }
+        }
+        else {
+            // Compute elements j+1:j+kn of column j and update the trailing
+            // submatrix within the band
+            for (idx_t i = j + 1; i <= j + kn; ++i)
+                A(i, j) /= ajj;
+            for (idx_t c = j + 1; c <= j + kn; ++c) {
+                const T acj = conj(A(c, j));
+                for (idx_t i = c; i <= j + kn; ++i)
+                    A(i, c) -= A(i, j) * acj;
+                A(c, c) = real(A(c, c));
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PBTF2_HH
@@ -0,0 +1,149 @@
+/// @file pbtrf.hpp Computes the Cholesky factorization of a Hermitian
+/// positive definite band matrix using a blocked algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PBTRF_HH
+#define TLAPACK_PBTRF_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/herk.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/pbtf2.hpp"
+#include "tlapack/lapack/potrf.hpp"
+#include "tlapack/plugins/legacyArray.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for pbtrf()
+struct PbtrfOpts : public EcOpts {
+    PbtrfOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+
+    size_t nb = tuned("pbtrf.nb", 32);  ///< Block size
+};
+
+/** Computes the Cholesky factorization of a Hermitian positive definite band
+ * matrix A using a blocked algorithm.
+ *
+ * The factorization has the form
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular band matrix with kd superdiagonals and L is a
+ * lower triangular band matrix with kd subdiagonals.
+ *
+ * The band is factored in blocks of opts.nb columns. Each block only modifies
+ * a window of at most (nb+kd)-by-(nb+kd) entries, which is copied to a dense
+ * workspace, factored with potrf(), trsm() and herk(), and copied back. The
+ * cost is $O(n \cdot kd^2)$ operations and the workspace does not depend on n.
+ * pbtf2() is used if opts.nb <= 1 or opts.nb > kd.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is stored, with kd = A.ku;
+ *      - Uplo::Lower: Lower triangle of A is stored, with kd = A.kl.
+ *
+ * @param[in,out] A n-by-n band matrix.
+ *      On entry, the Hermitian band matrix A.
+ *      On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: number of columns in each block.
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *      positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, typename T, class idx_t>
+int pbtrf(uplo_t uplo,
+          LegacyBandedMatrix<T, idx_t>& A,
+          const PbtrfOpts& opts = {})
+{
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = A.n;
+    const idx_t kd = (uplo == Uplo::Upper) ? A.ku : A.kl;
+    const idx_t nb = opts.nb;
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(A.m == A.n);
+
+    tlapack_trace("pbtrf", internal::trace_flops<T>(double(n) * kd * kd),
+                  sizeof(T) * (double(kd) + 1) * n);
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    // Unblocked code
+    if (nb <= 1 || nb > kd) return pbtf2(uplo, A);
+
+    // Workspace for the window of each block
+    Create<LegacyMatrix<T, idx_t>> new_matrix;
+    arena_vector<T> W_;
+    auto W = new_matrix(W_, nb + kd, nb + kd);
+
+    // Entry (i,c) of the window is in the stored triangle of the band
+    auto inband = [&](idx_t i, idx_t c) {
+        return (uplo == Uplo::Upper) ? (i <= c && c <= i + kd)
+                                     : (c <= i && i <= c + kd);
+    };
+
+    for (idx_t j = 0; j < n; j += nb) {
+        const idx_t jb = min(nb, n - j);
+        const idx_t nw = min(n, j + jb + kd) - j;
+
+        // Copy the window, with zeros outside the band
+        for (idx_t c = 0; c < nw; ++c)
+            for (idx_t i = 0; i < nw; ++i)
+                W(i, c) = inband(i, c) ? A(j + i, j + c) : T(0);
+
+        // Factor the diagonal block
+        auto W11 = slice(W, range(0, jb), range(0, jb));
+        int info = potrf(uplo, W11, PotrfOpts(opts));
+
+        // Update the trailing part of the window
+        if (info == 0 && jb < nw) {
+            auto W22 = slice(W, range(jb, nw), range(jb, nw));
+            if (uplo == Uplo::Upper) {
+                auto W12 = slice(W, range(0, jb), range(jb, nw));
+                trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one,
+                     W11, W12);
+                herk(UPPER_TRIANGLE, CONJ_TRANS, -one, W12, one, W22);
+            }
+            else {
+                auto W21 = slice(W, range(jb, nw), range(0, jb));
+                trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG,
+                     one, W11, W21);
+                herk(LOWER_TRIANGLE, NO_TRANS, -one, W21, one, W22);
+            }
+        }
+
+        // Copy the window back
+        for (idx_t c = 0; c < nw; ++c)
+            for (idx_t i = 0; i < nw; ++i)
+                if (inband(i, c)) A(j + i, j + c) = W(i, c);
+
+        if (info != 0) return j + info;
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PBTRF_HH
@@ -0,0 +1,80 @@
+/// @file pbtrs.hpp Solves a linear system using the band Cholesky
+/// factorization computed by pbtrf.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PBTRS_HH
+#define TLAPACK_PBTRS_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/tbtrs.hpp"
+
+namespace tlapack {
+
+/** Apply the band Cholesky factorization to solve a linear system.
+ * \[
+ *      A X = B,
+ * \]
+ * where
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * is the factorization computed by pbtrf().
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: A contains the matrix U, with kd = A.ku;
+ *      - Uplo::Lower: A contains the matrix L, with kd = A.kl.
+ *
+ * @param[in] A n-by-n band matrix.
+ *      The factor U or L from the Cholesky factorization of A.
+ *
+ * @param[in,out] B
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          typename T,
+          class idx_t,
+          TLAPACK_MATRIX matrixB_t>
+int pbtrs(uplo_t uplo, const LegacyBandedMatrix<T, idx_t>& A, matrixB_t& B)
+{
+    // Check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(A.m != A.n);
+    tlapack_check_false((idx_t)nrows(B) != A.n);
+
+    tlapack_trace("pbtrs",
+                  internal::trace_flops<T>(
+                      4. * A.n * ((uplo == Uplo::Upper) ? A.ku : A.kl) *
+                      ncols(B)),
+                  sizeof(T) * ((double(A.kl) + A.ku + 1) * A.n +
+                               2. * A.n * ncols(B)));
+
+    if (uplo == Uplo::Upper) {
+        // Solve A*X = B where A = U**H *U.
+        tbtrs(UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, A, B);
+        tbtrs(UPPER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, A, B);
+    }
+    else {
+        // Solve A*X = B where A = L*L**H.
+        tbtrs(LOWER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, A, B);
+        tbtrs(LOWER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, A, B);
+    }
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PBTRS_HH
@@ -0,0 +1,615 @@
+/// @file plan.hpp Workspace plans for repeated calls with the same shapes.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PLAN_HH
+#define TLAPACK_PLAN_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/gehrd.hpp"
+#include "tlapack/lapack/gelqf.hpp"
+#include "tlapack/lapack/geqlf.hpp"
+#include "tlapack/lapack/geqrf.hpp"
+#include "tlapack/lapack/gerqf.hpp"
+#include "tlapack/lapack/gesv.hpp"
+#include "tlapack/lapack/gesvd.hpp"
+#include "tlapack/lapack/getrf.hpp"
+#include "tlapack/lapack/heev.hpp"
+#include "tlapack/lapack/hetrd.hpp"
+#include "tlapack/lapack/multishift_qr.hpp"
+#include "tlapack/lapack/potrf.hpp"
+#include "tlapack/lapack/unghr.hpp"
+#include "tlapack/lapack/ungq.hpp"
+#include "tlapack/lapack/unmhr.hpp"
+#include "tlapack/lapack/unmq.hpp"
+
+namespace tlapack {
+
+/**
+ * @brief Routines that can be planned with plan().
+ *
+ * Each routine is a type with
+ *
+ * - a member alias template @c work_type<args_t...>, the matrix type of the
+ *   workspace for the arguments args_t...;
+ *
+ * - a static method @c worksize<T>(args...) that returns the WorkInfo of the
+ *   workspace, see the @c *_worksize routines;
+ *
+ * - a static method @c work(work,args...) that calls the routine with the
+ *   workspace work, see the @c *_work routines.
+ *
+ * The arguments are the ones of the routine without the workspace, in the
+ * same order.
+ */
+namespace routines {
+
+    /// geqrf(), see geqrf_worksize() and geqrf_work()
+    struct Geqrf {
+        template <class A_t, class tau_t, class... opts_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return geqrf_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t, class... opts_t>
+        static int work(work_t& work, A_t& A, tau_t& tau, const opts_t&... opts)
+        {
+            return geqrf_work(A, tau, work, opts...);
+        }
+    };
+
+    /// gelqf(), see gelqf_worksize() and gelqf_work()
+    struct Gelqf {
+        template <class A_t, class tau_t, class... opts_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return gelqf_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t, class... opts_t>
+        static int work(work_t& work, A_t& A, tau_t& tau, const opts_t&... opts)
+        {
+            return gelqf_work(A, tau, work, opts...);
+        }
+    };
+
+    /// geqlf(), see geqlf_worksize() and geqlf_work()
+    struct Geqlf {
+        template <class A_t, class tau_t, class... opts_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return geqlf_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t, class... opts_t>
+        static int work(work_t& work, A_t& A, tau_t& tau, const opts_t&... opts)
+        {
+            return geqlf_work(A, tau, work, opts...);
+        }
+    };
+
+    /// gerqf(), see gerqf_worksize() and gerqf_work()
+    struct Gerqf {
+        template <class A_t, class tau_t, class... opts_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return gerqf_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t, class... opts_t>
+        static int work(work_t& work, A_t& A, tau_t& tau, const opts_t&... opts)
+        {
+            return gerqf_work(A, tau, work, opts...);
+        }
+    };
+
+    /// gebrd(), see gebrd_worksize() and gebrd_work()
+    struct Gebrd {
+        template <class A_t, class tau_t, class... args_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return gebrd_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t, class... opts_t>
+        static int work(work_t& work,
+                        A_t& A,
+                        tau_t& tauv,
+                        tau_t& tauw,
+                        const opts_t&... opts)
+        {
+            return gebrd_work(A, tauv, tauw, work, opts...);
+        }
+    };
+
+    /// gehrd(), see gehrd_worksize() and gehrd_work()
+    struct Gehrd {
+        template <class idx_t, class idx2_t, class A_t, class tau_t, class...>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return gehrd_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t, class... opts_t>
+        static int work(work_t& work,
+                        size_type<A_t> ilo,
+                        size_type<A_t> ihi,
+                        A_t& A,
+                        tau_t& tau,
+                        const opts_t&... opts)
+        {
+            return gehrd_work(ilo, ihi, A, tau, work, opts...);
+        }
+    };
+
+    /// hetrd(), see hetrd_worksize() and hetrd_work()
+    struct Hetrd {
+        template <class uplo_t, class A_t, class tau_t, class... opts_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return hetrd_worksize<T>(args...);
+        }
+
+        template <class work_t,
+                  class uplo_t,
+                  class A_t,
+                  class tau_t,
+                  class... opts_t>
+        static int work(work_t& work,
+                        uplo_t uplo,
+                        A_t& A,
+                        tau_t& tau,
+                        const opts_t&... opts)
+        {
+            return hetrd_work(uplo, A, tau, work, opts...);
+        }
+    };
+
+    /// unghr(), see unghr_worksize() and unghr_work()
+    struct Unghr {
+        template <class idx_t, class idx2_t, class A_t, class tau_t>
+        using work_type = A_t;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return unghr_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t>
+        static int work(work_t& work,
+                        size_type<A_t> ilo,
+                        size_type<A_t> ihi,
+                        A_t& A,
+                        const tau_t& tau)
+        {
+            return unghr_work(ilo, ihi, A, tau, work);
+        }
+    };
+
+    /// unmhr(), see unmhr_worksize() and unmhr_work()
+    struct Unmhr {
+        template <class side_t,
+                  class trans_t,
+                  class idx_t,
+                  class idx2_t,
+                  class A_t,
+                  class tau_t,
+                  class C_t>
+        using work_type = A_t;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return unmhr_worksize<T>(args...);
+        }
+
+        template <class work_t, class A_t, class tau_t>
+        static int work(work_t& work,
+                        Side side,
+                        Op trans,
+                        size_type<A_t> ilo,
+                        size_type<A_t> ihi,
+                        const A_t& A,
+                        const tau_t& tau,
+                        A_t& C)
+        {
+            return unmhr_work(side, trans, ilo, ihi, A, tau, C, work);
+        }
+    };
+
+    /// ungq(), see ungq_worksize() and ungq_work()
+    struct Ungq {
+        template <class direction_t,
+                  class storage_t,
+                  class A_t,
+                  class tau_t,
+                  class... opts_t>
+        using work_type = matrix_type<A_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return ungq_worksize<T>(args...);
+        }
+
+        template <class work_t,
+                  class direction_t,
+                  class storage_t,
+                  class A_t,
+                  class tau_t,
+                  class... opts_t>
+        static int work(work_t& work,
+                        direction_t direction,
+                        storage_t storeMode,
+                        A_t& A,
+                        const tau_t& tau,
+                        const opts_t&... opts)
+        {
+            return ungq_work(direction, storeMode, A, tau, work, opts...);
+        }
+    };
+
+    /// unmq(), see unmq_worksize() and unmq_work()
+    struct Unmq {
+        template <class side_t,
+                  class trans_t,
+                  class direction_t,
+                  class storage_t,
+                  class V_t,
+                  class tau_t,
+                  class... args_t>
+        using work_type = matrix_type<V_t, tau_t>;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&... args)
+        {
+            return unmq_worksize<T>(args...);
+        }
+
+        template <class work_t,
+                  class side_t,
+                  class trans_t,
+                  class direction_t,
+                  class storage_t,
+                  class V_t,
+                  class tau_t,
+                  class C_t,
+                  class... opts_t>
+        static int work(work_t& work,
+                        side_t side,
+                        trans_t trans,
+                        direction_t direction,
+                        storage_t storeMode,
+                        const V_t& V,
+                        const tau_t& tau,
+                        C_t& C,
+                        const opts_t&... opts)
+        {
+            return unmq_work(side, trans, direction, storeMode, V, tau, C,
+                             work, opts...);
+        }
+    };
+
+    /// multishift_qr(), see multishift_qr_worksize() and multishift_qr_work()
+    struct MultishiftQr {
+        template <class bool_t,
+                  class bool2_t,
+                  class idx_t,
+                  class idx2_t,
+                  class A_t,
+                  class... args_t>
+        using work_type = A_t;
+
+        template <class T, class A_t, class w_t>
+        static WorkInfo worksize(bool want_t,
+                                 bool want_z,
+                                 size_type<A_t> ilo,
+                                 size_type<A_t> ihi,
+                                 const A_t& A,
+                                 const w_t& w,
+                                 const A_t& Z,
+                                 const FrancisOpts& opts = {})
+        {
+            return multishift_qr_worksize<T>(want_t, want_z, ilo, ihi, A, w, Z,
+                                             opts);
+        }
+
+        template <class work_t, class A_t, class w_t, class... opts_t>
+        static int work(work_t& work,
+                        bool want_t,
+                        bool want_z,
+                        size_type<A_t> ilo,
+                        size_type<A_t> ihi,
+                        A_t& A,
+                        w_t& w,
+                        A_t& Z,
+                        opts_t&... opts)
+        {
+            return multishift_qr_work(want_t, want_z, ilo, ihi, A, w, Z, work,
+                                      opts...);
+        }
+    };
+
+    /// Routines without a @c *_work variant. Their workspaces, if any, are
+    /// taken from the arena of the calling thread, see ArenaScope
+    struct NoWorkspace {
+        template <class... args_t>
+        using work_type = void;
+
+        template <class T, class... args_t>
+        static constexpr WorkInfo worksize(const args_t&...)
+        {
+            return WorkInfo(0);
+        }
+    };
+
+    /// getrf()
+    struct Getrf : NoWorkspace {
+        template <class work_t, class... args_t>
+        static int work(work_t&, args_t&&... args)
+        {
+            ArenaScope scope;
+            return tlapack::getrf(std::forward<args_t>(args)...);
+        }
+    };
+
+    /// potrf()
+    struct Potrf : NoWorkspace {
+        template <class work_t, class... args_t>
+        static int work(work_t&, args_t&&... args)
+        {
+            ArenaScope scope;
+            return tlapack::potrf(std::forward<args_t>(args)...);
+        }
+    };
+
+    /// gesv()
+    struct Gesv : NoWorkspace {
+        template <class work_t, class... args_t>
+        static int work(work_t&, args_t&&... args)
+        {
+            ArenaScope scope;
+            return tlapack::gesv(std::forward<args_t>(args)...);
+        }
+    };
+
+    /// gesvd()
+    struct Gesvd : NoWorkspace {
+        template <class work_t, class... args_t>
+        static int work(work_t&, args_t&&... args)
+        {
+            ArenaScope scope;
+            return tlapack::gesvd(std::forward<args_t>(args)...);
+        }
+    };
+
+    /// heev()
+    struct Heev : NoWorkspace {
+        template <class work_t, class... args_t>
+        static int work(work_t&, args_t&&... args)
+        {
+            ArenaScope scope;
+            return tlapack::heev(std::forward<args_t>(args)...);
+        }
+    };
+
+    inline constexpr Geqrf geqrf{};
+    inline constexpr Gelqf gelqf{};
+    inline constexpr Geqlf geqlf{};
+    inline constexpr Gerqf gerqf{};
+    inline constexpr Gebrd gebrd{};
+    inline constexpr Gehrd gehrd{};
+    inline constexpr Hetrd hetrd{};
+    inline constexpr Unghr unghr{};
+    inline constexpr Unmhr unmhr{};
+    inline constexpr Ungq ungq{};
+    inline constexpr Unmq unmq{};
+    inline constexpr MultishiftQr multishift_qr{};
+    inline constexpr Getrf getrf{};
+    inline constexpr Potrf potrf{};
+    inline constexpr Gesv gesv{};
+    inline constexpr Gesvd gesvd{};
+    inline constexpr Heev heev{};
+
+}  // namespace routines
+
+namespace internal {
+    /// Buffer and workspace of a Plan. The buffer is aligned if
+    /// Create<work_t> accepts a std::vector with AlignedAllocator
+    template <class work_t, class T>
+    struct plan_workspace {
+        using aligned_t = std::vector<T, AlignedAllocator<T>>;
+        using buffer_t =
+            std::conditional_t<std::is_invocable_v<const Create<work_t>&,
+                                                   aligned_t&,
+                                                   size_type<work_t>,
+                                                   size_type<work_t>>,
+                               aligned_t,
+                               std::vector<T>>;
+        using type = decltype(Create<work_t>()(std::declval<buffer_t&>(),
+                                               size_type<work_t>(0),
+                                               size_type<work_t>(0)));
+    };
+
+    /// Routines without workspace
+    template <class T>
+    struct plan_workspace<void, T> {
+        using buffer_t = std::vector<T>;
+        using type = std::nullptr_t;
+    };
+
+    /// Calls f with the sizes of a matrix or vector, or with the value of an
+    /// integral or enum argument. Other arguments, e.g., options, are skipped
+    template <class F, class arg_t>
+    void plan_shape(F&& f, const arg_t& arg)
+    {
+        if constexpr (traits::internal::is_vector<arg_t>)
+            f(size_t(size(arg)));
+        else if constexpr (traits::internal::is_matrix<arg_t>) {
+            f(size_t(nrows(arg)));
+            f(size_t(ncols(arg)));
+        }
+        else if constexpr (std::is_integral_v<arg_t> || std::is_enum_v<arg_t>)
+            f(size_t(arg));
+    }
+}  // namespace internal
+
+/**
+ * @brief Workspace of a routine for a fixed set of shapes.
+ *
+ * A plan computes the workspace of a routine once, see plan(), and keeps it
+ * for all the calls that follow. Calling the plan runs the @c *_work variant
+ * of the routine with the stored workspace, so that no workspace query and
+ * no allocation happen in the calls. The workspace is aligned to 64 bytes if
+ * the Create functor of its matrix type accepts an AlignedAllocator.
+ *
+ * The arguments of each call must have the same sizes and options as the
+ * arguments used to build the plan. The sizes of the matrices and vectors and
+ * the values of the integral and enum arguments are verified with
+ * tlapack_check(). The options are not verified.
+ *
+ * Routines without a @c *_work variant, e.g., routines::gesvd, run inside an
+ * ArenaScope. Their workspaces are kept by the arena of the calling thread
+ * after the first call.
+ *
+ * @tparam routine_t Routine, see namespace tlapack::routines.
+ * @tparam work_t Matrix type of the workspace, or void if the routine does not
+ *      take a workspace.
+ */
+template <class routine_t, class work_t>
+class Plan {
+    using T = typename std::conditional_t<std::is_void_v<work_t>,
+                                          std::common_type<char>,
+                                          traits::entry_type_trait<work_t>>::type;
+    using buffer_t = typename internal::plan_workspace<work_t, T>::buffer_t;
+    using workspace_t = typename internal::plan_workspace<work_t, T>::type;
+
+   public:
+    /// Computes and allocates the workspace of routine_t for the arguments
+    /// args
+    template <class... args_t>
+    explicit Plan(routine_t, const args_t&... args)
+        : info(routine_t::template worksize<T>(args...)),
+          work(make_workspace(buffer, info))
+    {
+        (internal::plan_shape([this](size_t x) { shape.push_back(x); }, args),
+         ...);
+    }
+
+    Plan(const Plan&) = delete;
+    Plan& operator=(const Plan&) = delete;
+    Plan(Plan&&) = default;
+    Plan& operator=(Plan&&) = default;
+
+    /// Calls the routine with the arguments args and the stored workspace
+    template <class... args_t>
+    int operator()(args_t&&... args)
+    {
+        tlapack_check(same_shape(args...));
+        return routine_t::work(work, std::forward<args_t>(args)...);
+    }
+
+    /// Workspace requirements computed when the plan was built
+    constexpr const WorkInfo& workinfo() const noexcept { return info; }
+
+    /// Number of entries of type T in the workspace
+    constexpr size_t size() const noexcept { return info.size(); }
+
+    /// True if the workspace covers the requirements workinfo
+    bool fits(const WorkInfo& workinfo) const noexcept
+    {
+        WorkInfo w = info;
+        w.minMax(workinfo);
+        return (w.m == info.m && w.n == info.n);
+    }
+
+    /// True if args have the shapes of the arguments used to build the plan
+    template <class... args_t>
+    bool same_shape(const args_t&... args) const noexcept
+    {
+        size_t i = 0;
+        bool same = true;
+        (internal::plan_shape(
+             [&](size_t x) {
+                 same = same && i < shape.size() && shape[i] == x;
+                 ++i;
+             },
+             args),
+         ...);
+        return same && i == shape.size();
+    }
+
+   private:
+    WorkInfo info;
+    std::vector<size_t> shape;
+    buffer_t buffer;
+    workspace_t work;
+
+    static workspace_t make_workspace(buffer_t& v, const WorkInfo& info)
+    {
+        if constexpr (std::is_void_v<work_t>)
+            return nullptr;
+        else
+            return Create<work_t>()(v, size_type<work_t>(info.m),
+                                    size_type<work_t>(info.n));
+    }
+};
+
+/**
+ * @brief Builds a workspace plan for repeated calls of a routine with
+ * arguments of the same shapes.
+ *
+ * Usage:
+ * @code{.cpp}
+ * auto qr = tlapack::plan(tlapack::routines::geqrf, A, tau);
+ * for (auto& A : problems) // All matrices have the same sizes
+ *     qr(A, tau);
+ * @endcode
+ *
+ * @param[in] routine Routine from namespace tlapack::routines.
+ * @param[in] args Arguments of the routine without the workspace. Only their
+ *      sizes and values of options are used.
+ *
+ * @return The plan, see Plan.
+ *
+ * @ingroup workspace_query
+ */
+template <class routine_t, class... args_t>
+auto plan(routine_t routine, const args_t&... args)
+{
+    using work_t = typename routine_t::template work_type<args_t...>;
+    return Plan<routine_t, work_t>(routine, args...);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PLAN_HH
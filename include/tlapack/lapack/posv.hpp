@@ -0,0 +1,74 @@
+/// @file posv.hpp Solves a Hermitian positive definite system of linear
+/// equations.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POSV_HH
+#define TLAPACK_POSV_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/potrf.hpp"
+#include "tlapack/lapack/potrs.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * where A is an n-by-n Hermitian positive definite matrix, using the Cholesky
+ * factorization
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On entry, the matrix A.
+ *      On successful exit, the factor U or L from the Cholesky factorization.
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On successful exit, the solution X.
+ *
+ * @param[in] opts Options for potrf().
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not positive
+ *      definite. The solution could not be computed.
+ *
+ * @ingroup variant_interface
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t>
+int posv(uplo_t uplo,
+         matrixA_t& A,
+         matrixB_t& B,
+         const PotrfOpts& opts = {})
+{
+    // Check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false(nrows(B) != nrows(A));
+
+    int info = potrf(uplo, A, opts);
+    if (info == 0) potrs(uplo, A, B);
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POSV_HH
@@ -0,0 +1,184 @@
+/// @file posv_ir.hpp Solves a Hermitian positive definite system of linear
+/// equations with a low-precision Cholesky factorization and iterative
+/// refinement.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POSV_IR_HH
+#define TLAPACK_POSV_IR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/hemv.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/iterative_refinement.hpp"
+#include "tlapack/lapack/lanhe.hpp"
+#include "tlapack/lapack/posv.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * where A is an n-by-n Hermitian positive definite matrix, using a Cholesky
+ * factorization computed in a lower precision and iterative refinement in
+ * the precision of A.
+ *
+ * This is the analogous of gesv_ir() for Hermitian positive definite
+ * matrices. The factorization in the precision of TF is computed with
+ * potrf(), and the system is solved with posv() if the refinement does not
+ * converge, as in LAPACK's DSPOSV.
+ *
+ * @tparam TF Precision of the Cholesky factorization, e.g., float or
+ *      Eigen::half. Only the real type of TF is used.
+ * @tparam TR Precision of the residuals. If void, the precision of A.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On entry, the matrix A.
+ *      On exit, if iter >= 0, A is unchanged. If iter < 0 and the return
+ *      value is 0, the factor U or L from the Cholesky factorization computed
+ *      by potrf().
+ *
+ * @param[in] B n-by-nrhs matrix.
+ *
+ * @param[out] X n-by-nrhs matrix.
+ *      On successful exit, the solution X.
+ *
+ * @param[out] iter
+ *      - iter >= 0: number of refinement steps;
+ *      - iter = -2: an entry of the scaled matrix A overflows in the precision
+ *        of TF;
+ *      - iter = -3: the factorization in the precision of TF failed;
+ *      - iter = -(opts.max_iters+1): the refinement did not converge.
+ *      The system is solved with posv() if iter < 0.
+ *
+ * @param[in] opts Options. See gesv_ir().
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if iter < 0 and the leading minor of order i is not
+ *      positive definite. The solution could not be computed.
+ *
+ * @ingroup variant_interface
+ */
+template <class TF,
+          class TR = void,
+          TLAPACK_UPLO uplo_t,
+          TLAPACK_SMATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_SMATRIX matrixX_t>
+int posv_ir(uplo_t uplo,
+            matrixA_t& A,
+            const matrixB_t& B,
+            matrixX_t& X,
+            int& iter,
+            const IrOpts& opts = {})
+{
+    using T = type_t<matrixA_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+    using TF_t = internal::ir_type_t<TF, T>;
+    using TR_t = internal::ir_type_t<
+        std::conditional_t<is_same_v<TR, void>, T, TR>, T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const idx_t n = nrows(A);
+    const idx_t nrhs = ncols(B);
+    const Op opL = (uplo == Uplo::Upper) ? Op::ConjTrans : Op::NoTrans;
+    const Op opR = (uplo == Uplo::Upper) ? Op::NoTrans : Op::ConjTrans;
+
+    // Check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(nrows(A) != ncols(A));
+    tlapack_check_false((idx_t)nrows(B) != n);
+    tlapack_check_false((idx_t)nrows(X) != n || (idx_t)ncols(X) != nrhs);
+
+    tlapack_trace("posv_ir", 0, 0);
+
+    // Quick return
+    iter = 0;
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    // Tolerance of the refinement, as in LAPACK's DSPOSV
+    const real_t anrm = lanhe(INF_NORM, uplo, A);
+    const real_t cte = anrm * uroundoff<real_t>() * sqrt(real_t(n));
+
+    // Scaling that brings the entries of A to [-1,1]
+    const real_t amax = lanhe(MAX_NORM, uplo, A);
+    const real_t theta = (amax > real_t(0)) ? real_t(1) / amax : real_t(1);
+
+    // Allocates workspace
+    Create<matrixA_t> new_matrix;
+    arena_vector<TF_t> Af_;
+    auto Af = new_matrix(Af_, n, n);
+    arena_vector<TF_t> Wf_;
+    auto Wf = new_matrix(Wf_, n, nrhs);
+    arena_vector<TR_t> R_;
+    auto R = new_matrix(R_, n, nrhs);
+
+    // Low-precision factorization of theta A
+    if (!internal::ir_convert(uplo, theta, A, Af))
+        iter = -2;
+    else if (potrf(uplo, Af, PotrfOpts(EcOpts(NO_ERROR_CHECK))) != 0)
+        iter = -3;
+    else {
+        // R = B - A X
+        auto residual = [&](const auto& X, auto& R) {
+            internal::ir_residual(uplo, A, B, X, R);
+        };
+
+        // W = A^{-1} W using potrs in low precision
+        auto solve = [&](auto& W) {
+            for (idx_t j = 0; j < nrhs; ++j) {
+                const real_t s = internal::ir_maxabs(col(W, j));
+                const real_t sinv = (s > real_t(0)) ? real_t(1) / s : real_t(1);
+                auto wj = slice(W, range(0, n), range(j, j + 1));
+                auto wfj = slice(Wf, range(0, n), range(j, j + 1));
+                internal::ir_convert(GENERAL, sinv, wj, wfj);
+                potrs(uplo, Af, wfj);
+
+                const real_t alpha = theta / sinv;
+                for (idx_t i = 0; i < n; ++i)
+                    W(i, j) = alpha * static_cast<T>(Wf(i, j));
+            }
+        };
+
+        // w = A v
+        auto matvec = [&](const auto& v, auto& w) {
+            hemv(uplo, real_t(1), A, v, real_t(0), w);
+        };
+
+        // W = (theta^{-1} C^H C)^{-1} W in the precision of A. The factor is
+        // converted to the precision of A on the first call
+        arena_vector<T> Ap_;
+        auto precond = [&](auto& W) {
+            const bool first = Ap_.empty();
+            auto Ap = new_matrix(Ap_, n, n);
+            if (first) internal::ir_convert(uplo, real_type<TF_t>(1), Af, Ap);
+
+            trsm(LEFT_SIDE, uplo, opL, NON_UNIT_DIAG, theta, Ap, W);
+            trsm(LEFT_SIDE, uplo, opR, NON_UNIT_DIAG, real_t(1), Ap, W);
+        };
+
+        iter = internal::iterative_refinement(residual, solve, matvec, precond,
+                                              B, X, R, cte, opts);
+        if (iter >= 0) return 0;
+    }
+
+    // Fall back to the factorization in the precision of A
+    lacpy(GENERAL, B, X);
+    return posv(uplo, A, X);
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POSV_IR_HH
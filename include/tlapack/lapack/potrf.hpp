@@ -16,6 +16,8 @@
 #include "tlapack/lapack/potrf2.hpp"
 #include "tlapack/lapack/potrf_blocked.hpp"
 #include "tlapack/lapack/potrf_blocked_right_looking.hpp"
+#include "tlapack/lapack/potrf_static.hpp"
+#include "tlapack/lapack/potrf_tiled.hpp"
 
 namespace tlapack {
 
@@ -24,12 +26,13 @@ enum class PotrfVariant : char {
     Blocked = 'B',
     Recursive = 'R',
     Level2 = '2',
-    RightLooking
+    RightLooking,
+    TiledParallel = 'T'
 };
 
 /// @brief Options struct for potrf()
-struct PotrfOpts : public BlockedCholeskyOpts {
-    constexpr PotrfOpts(const EcOpts& opts = {}) : BlockedCholeskyOpts(opts){};
+struct PotrfOpts : public TiledCholeskyOpts {
+    PotrfOpts(const EcOpts& opts = {}) : TiledCholeskyOpts(opts){};
 
     PotrfVariant variant = PotrfVariant::Blocked;
 };
@@ -63,10 +66,14 @@ struct PotrfOpts : public BlockedCholeskyOpts {
  *      factorization $A = U^H U$ or $A = L L^H.$
  *
  * @param[in] opts Options.
- *      Define the behavior of checks for NaNs, and nb for potrf_blocked.
+ *      Define the behavior of checks for NaNs, nb for potrf_blocked and the
+ *      tile size and threads for potrf_tiled.
  *      - variant:
  *          - Recursive = 'R',
- *          - Blocked = 'B'
+ *          - Blocked = 'B',
+ *          - TiledParallel = 'T'
+ *      If the size of A is known at compile time and is at most
+ *      internal::max_static_size, potrf_static() is used instead.
  *
  * @return 0: successful exit.
  * @return i, 0 < i <= n, if the leading minor of order i is not
@@ -83,17 +90,30 @@ int potrf(uplo_t uplo, matrix_t& A, const PotrfOpts& opts = {})
     tlapack_check(opts.variant == PotrfVariant::Blocked ||
                   opts.variant == PotrfVariant::Recursive ||
                   opts.variant == PotrfVariant::Level2 ||
-                  opts.variant == PotrfVariant::RightLooking);
+                  opts.variant == PotrfVariant::RightLooking ||
+                  opts.variant == PotrfVariant::TiledParallel);
 
-    // Call variant
-    if (opts.variant == PotrfVariant::Blocked)
-        return potrf_blocked(uplo, A, opts);
-    else if (opts.variant == PotrfVariant::Recursive)
-        return potrf2(uplo, A, opts);
-    else if (opts.variant == PotrfVariant::Level2)
-        return potf2(uplo, A);
-    else
-        return potrf_rl(uplo, A, opts);
+    tlapack_trace("potrf",
+                  internal::trace_flops<type_t<matrix_t>>(
+                      double(nrows(A)) * nrows(A) * nrows(A) / 3),
+                  sizeof(type_t<matrix_t>) * double(nrows(A)) * nrows(A));
+
+    // Small matrices of fixed size go through unrolled kernels
+    if constexpr (internal::use_static_kernels<matrix_t>)
+        return potrf_static<static_nrows<matrix_t>>(uplo, A);
+    else {
+        // Call variant
+        if (opts.variant == PotrfVariant::Blocked)
+            return potrf_blocked(uplo, A, opts);
+        else if (opts.variant == PotrfVariant::Recursive)
+            return potrf2(uplo, A, opts);
+        else if (opts.variant == PotrfVariant::Level2)
+            return potf2(uplo, A);
+        else if (opts.variant == PotrfVariant::TiledParallel)
+            return potrf_tiled(uplo, A, opts);
+        else
+            return potrf_rl(uplo, A, opts);
+    }
 }
 
 }  // namespace tlapack
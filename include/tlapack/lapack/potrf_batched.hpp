@@ -0,0 +1,118 @@
+/// @file potrf_batched.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_BATCHED_HH
+#define TLAPACK_POTRF_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorizations of a batch of small Hermitian
+ * positive definite n-by-n matrices.
+ *
+ * For each matrix b of the batch, the factorization has the form
+ *      $A_b = U_b^H U_b,$ if uplo = Upper, or
+ *      $A_b = L_b L_b^H,$ if uplo = Lower,
+ * as in potrf(). The factorizations are unblocked, which suits matrices that
+ * fit in cache.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangles of the matrices A_b are stored;
+ *      - Uplo::Lower: Lower triangles of the matrices A_b are stored.
+ *
+ * @param[in,out] A Batch of n-by-n matrices.
+ *      On exit, the factors U_b or L_b in the triangles given by uplo.
+ *
+ * @param[out] info Integer vector with one entry per matrix.
+ *      info[b] = 0 if the factorization of A_b succeeded, or i if the leading
+ *      minor of order i of A_b is not positive definite. In that case, the
+ *      columns (or rows) i-1 to n-1 of the factor of A_b are not meaningful.
+ *
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @return The number of matrices with info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, class batchA_t, TLAPACK_VECTOR info_t>
+int potrf_batched(uplo_t uplo,
+                  batchA_t& A,
+                  info_t& info,
+                  const BatchOpts& opts = {})
+{
+    const auto A_ = internal::batch_view(A);
+    const size_t count = internal::batch_count(A_);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check_false((size_t)size(info) < count);
+
+    // Quick return
+    if (count == 0) return 0;
+
+    // constants
+    const size_t n = internal::batch_nrows(A_);
+
+    // check arguments
+    tlapack_check_false(!internal::batch_is(A_, n, n));
+
+    for (size_t b = 0; b < count; ++b)
+        info[b] = 0;
+
+    internal::batch_for_each(
+        count, opts,
+        [&](size_t b0, size_t b1, size_t first, const auto& A) {
+            using T = std::decay_t<decltype(A(0, 0, 0))>;
+            using real_t = real_type<T>;
+            const real_t zero(0);
+
+            // Factorization of the lower triangle L(b,:,:) of A_b. If
+            // uplo = Upper, the transpose of A_b, i.e., the conjugate of A_b,
+            // is factorized, which gives U_b in its upper triangle
+            auto factorize = [&](auto&& L) {
+                for (size_t j = 0; j < n; ++j) {
+                    for (size_t b = b0; b < b1; ++b) {
+                        const real_t ajj = real(L(b, j, j));
+                        if (!(ajj > zero) && info[first + b - b0] == 0)
+                            info[first + b - b0] = j + 1;
+                        L(b, j, j) = sqrt(ajj);
+                    }
+
+                    for (size_t i = j + 1; i < n; ++i)
+                        for (size_t b = b0; b < b1; ++b)
+                            L(b, i, j) /= real(L(b, j, j));
+
+                    for (size_t l = j + 1; l < n; ++l)
+                        for (size_t i = l; i < n; ++i)
+                            for (size_t b = b0; b < b1; ++b)
+                                L(b, i, l) -= L(b, i, j) * conj(L(b, l, j));
+                }
+            };
+
+            if (uplo == Uplo::Lower)
+                factorize([&](size_t b, size_t i, size_t j) -> T& {
+                    return A(b, i, j);
+                });
+            else
+                factorize([&](size_t b, size_t i, size_t j) -> T& {
+                    return A(b, j, i);
+                });
+        },
+        A_);
+
+    int nfailed = 0;
+    for (size_t b = 0; b < count; ++b)
+        if (info[b] != 0) ++nfailed;
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_BATCHED_HH
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_POTRF_BLOCKED_HH
 #define TLAPACK_POTRF_BLOCKED_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/gemm.hpp"
 #include "tlapack/blas/herk.hpp"
@@ -20,9 +21,9 @@
 namespace tlapack {
 
 struct BlockedCholeskyOpts : public EcOpts {
-    constexpr BlockedCholeskyOpts(const EcOpts& opts = {}) : EcOpts(opts){};
+    BlockedCholeskyOpts(const EcOpts& opts = {}) : EcOpts(opts){};
 
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("potrf.nb", 32);  ///< Block size
 };
 
 /** Computes the Cholesky factorization of a Hermitian
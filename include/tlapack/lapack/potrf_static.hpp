@@ -0,0 +1,115 @@
+/// @file potrf_static.hpp Cholesky factorization of a matrix of fixed size.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_STATIC_HH
+#define TLAPACK_POTRF_STATIC_HH
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorization of a Hermitian positive definite
+ * n-by-n matrix A whose size is known at compile time.
+ *
+ * The factorization has the form
+ *     $A = U^H U,$ if uplo = Upper, or
+ *     $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular matrix and L is lower triangular. The
+ * algorithm is the one of potf2(), with the loops unrolled at compile time.
+ * potrf() calls this routine when the size of A is known at compile time and
+ * is at most internal::max_static_size.
+ *
+ * @tparam n Number of rows and columns of A.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the Hermitian matrix A.
+ *      On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @return = 0: successful exit
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *     positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <int n, TLAPACK_UPLO uplo_t, TLAPACK_MATRIX matrix_t>
+int potrf_static(uplo_t uplo, matrix_t& A)
+{
+    static_assert(n >= 0);
+
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Constants
+    const real_t zero(0);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check((int)nrows(A) == n);
+    tlapack_check((int)ncols(A) == n);
+
+    int info = 0;
+    auto factorize = [&](auto upper_) {
+        // The factorization reads A(i,j) from the triangle given by uplo
+        constexpr bool upper = decltype(upper_)::value;
+        auto a = [&](int i, int j) -> T& {
+            return upper ? A(j, i) : A(i, j);
+        };
+
+        internal::static_for<0, n>([&](auto j_) {
+            constexpr int j = j_;
+            if (info != 0) return;
+
+            // Compute L(j,j) and test for non-positive-definiteness
+            real_t ajj = real(A(j, j));
+            internal::static_for<0, j>([&](auto l_) {
+                constexpr int l = l_;
+                ajj -= real(a(j, l) * conj(a(j, l)));
+            });
+            if (!(ajj > zero)) {
+                tlapack_error(
+                    j + 1,
+                    "The leading minor of order j+1 is not positive definite,"
+                    " and the factorization could not be completed.");
+                info = j + 1;
+                return;
+            }
+            ajj = sqrt(ajj);
+            A(j, j) = T(ajj);
+
+            // Compute elements j+1:n of column j. In the upper case, a(i,l)
+            // is conj(L(i,l)) for L = U^H
+            internal::static_for<j + 1, n>([&](auto i_) {
+                constexpr int i = i_;
+                T aij = upper ? conj(a(i, j)) : a(i, j);
+                internal::static_for<0, j>([&](auto l_) {
+                    constexpr int l = l_;
+                    aij -= upper ? conj(a(i, l)) * a(j, l)
+                                 : a(i, l) * conj(a(j, l));
+                });
+                a(i, j) = (upper ? conj(aij) : aij) / ajj;
+            });
+        });
+    };
+
+    if (uplo == Uplo::Upper)
+        factorize(std::true_type{});
+    else
+        factorize(std::false_type{});
+
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_STATIC_HH
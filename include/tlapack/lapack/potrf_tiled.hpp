@@ -0,0 +1,224 @@
+/// @file potrf_tiled.hpp Computes the Cholesky factorization of a Hermitian
+/// positive definite matrix A using a task-parallel tiled algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRF_TILED_HH
+#define TLAPACK_POTRF_TILED_HH
+
+#include <atomic>
+
+#include "tlapack/base/TaskGraph.hpp"
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/herk.hpp"
+#include "tlapack/blas/trsm.hpp"
+#include "tlapack/lapack/potrf_blocked_right_looking.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for potrf_tiled()
+struct TiledCholeskyOpts : public BlockedCholeskyOpts {
+    TiledCholeskyOpts(const EcOpts& opts = {})
+        : BlockedCholeskyOpts(opts){};
+
+    size_t num_threads = 0;      ///< Number of threads. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
+};
+
+/** Computes the Cholesky factorization of a Hermitian
+ * positive definite matrix A using a task-parallel tiled algorithm.
+ *
+ * The factorization has the form
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular matrix and L is lower triangular.
+ *
+ * The matrix is split in tiles of size nb-by-nb. The right-looking algorithm
+ * is expressed as a graph of tile tasks (potrf on the diagonal tiles, trsm on
+ * the tiles of the panel, herk and gemm on the tiles of the trailing matrix)
+ * whose dependencies are inferred from the tiles each task reads and writes.
+ * The graph is executed by a TaskGraph, which runs the tasks in the critical
+ * path first. The factorization of the next panel thus starts as soon as its
+ * tiles are updated, overlapping with the rest of the trailing update.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the Hermitian matrix A of size n-by-n.
+ *
+ *      - If uplo = Uplo::Upper, the strictly lower
+ *      triangular part of A is not referenced.
+ *
+ *      - If uplo = Uplo::Lower, the strictly upper
+ *      triangular part of A is not referenced.
+ *
+ *      - On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: tile size.
+ *      - @c opts.num_threads, @c opts.pool: threads that execute the tasks.
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *      positive definite, and the factorization could not be completed.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, TLAPACK_SMATRIX matrix_t>
+int potrf_tiled(uplo_t uplo, matrix_t& A, const TiledCholeskyOpts& opts = {})
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+
+    // Constants
+    const real_t one(1);
+    const idx_t n = nrows(A);
+    const idx_t nb = max<idx_t>(opts.nb, 1);
+    const idx_t nt = (n + nb - 1) / nb;  // number of tiles in each direction
+    const double fnb = double(nb);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+    tlapack_check(nrows(A) == ncols(A));
+
+    // Quick return
+    if (n <= 0) return 0;
+
+    // Thread pool
+    ThreadPool& pool = opts.pool ? *opts.pool : ThreadPool::global();
+    const size_t nthreads =
+        (opts.num_threads == 0) ? pool.size() + 1 : opts.num_threads;
+
+    // Tile (i,j) and its handle in the task graph
+    auto tile = [&](idx_t i, idx_t j) {
+        return slice(A, range{i * nb, min((i + 1) * nb, n)},
+                     range{j * nb, min((j + 1) * nb, n)});
+    };
+    auto handle = [nt](idx_t i, idx_t j) { return size_t(i + j * nt); };
+
+    // Index of the first leading minor that is not positive definite. Once a
+    // diagonal tile fails, the remaining tasks do nothing
+    std::atomic<int> info(0);
+
+    TaskGraph graph;
+    for (idx_t k = 0; k < nt; ++k) {
+        // Factor the diagonal tile
+        graph.insert_task(
+            [&, k]() {
+                if (info != 0) return;
+                auto Akk = tile(k, k);
+                int infoK = potrf_rl(uplo, Akk);
+                if (infoK != 0) info = int(k * nb) + infoK;
+            },
+            fnb * fnb * fnb / 3, {TaskGraph::write(handle(k, k))});
+
+        // Panel
+        for (idx_t i = k + 1; i < nt; ++i) {
+            if (uplo == Uplo::Lower)
+                graph.insert_task(
+                    [&, i, k]() {
+                        if (info != 0) return;
+                        auto Aik = tile(i, k);
+                        trsm(RIGHT_SIDE, LOWER_TRIANGLE, CONJ_TRANS,
+                             NON_UNIT_DIAG, one, tile(k, k), Aik);
+                    },
+                    fnb * fnb * fnb,
+                    {TaskGraph::read(handle(k, k)),
+                     TaskGraph::write(handle(i, k))});
+            else
+                graph.insert_task(
+                    [&, i, k]() {
+                        if (info != 0) return;
+                        auto Aki = tile(k, i);
+                        trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS,
+                             NON_UNIT_DIAG, one, tile(k, k), Aki);
+                    },
+                    fnb * fnb * fnb,
+                    {TaskGraph::read(handle(k, k)),
+                     TaskGraph::write(handle(k, i))});
+        }
+
+        // Trailing matrix
+        for (idx_t j = k + 1; j < nt; ++j) {
+            if (uplo == Uplo::Lower) {
+                graph.insert_task(
+                    [&, j, k]() {
+                        if (info != 0) return;
+                        auto Ajj = tile(j, j);
+                        herk(LOWER_TRIANGLE, NO_TRANS, -one, tile(j, k), one,
+                             Ajj);
+                    },
+                    fnb * fnb * fnb,
+                    {TaskGraph::read(handle(j, k)),
+                     TaskGraph::write(handle(j, j))});
+                for (idx_t i = j + 1; i < nt; ++i)
+                    graph.insert_task(
+                        [&, i, j, k]() {
+                            if (info != 0) return;
+                            auto Aij = tile(i, j);
+                            gemm(NO_TRANS, CONJ_TRANS, -one, tile(i, k),
+                                 tile(j, k), one, Aij);
+                        },
+                        2 * fnb * fnb * fnb,
+                        {TaskGraph::read(handle(i, k)),
+                         TaskGraph::read(handle(j, k)),
+                         TaskGraph::write(handle(i, j))});
+            }
+            else {
+                graph.insert_task(
+                    [&, j, k]() {
+                        if (info != 0) return;
+                        auto Ajj = tile(j, j);
+                        herk(UPPER_TRIANGLE, CONJ_TRANS, -one, tile(k, j), one,
+                             Ajj);
+                    },
+                    fnb * fnb * fnb,
+                    {TaskGraph::read(handle(k, j)),
+                     TaskGraph::write(handle(j, j))});
+                for (idx_t i = j + 1; i < nt; ++i)
+                    graph.insert_task(
+                        [&, i, j, k]() {
+                            if (info != 0) return;
+                            auto Aji = tile(j, i);
+                            gemm(CONJ_TRANS, NO_TRANS, -one, tile(k, j),
+                                 tile(k, i), one, Aji);
+                        },
+                        2 * fnb * fnb * fnb,
+                        {TaskGraph::read(handle(k, j)),
+                         TaskGraph::read(handle(k, i)),
+                         TaskGraph::write(handle(j, i))});
+            }
+        }
+    }
+
+    graph.run(pool, nthreads);
+
+    if (info != 0) {
+        tlapack_error(info,
+                      "The leading minor of the reported order is not "
+                      "positive definite,"
+                      " and the factorization could not be completed.");
+    }
+    return info;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRF_TILED_HH
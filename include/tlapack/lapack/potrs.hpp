@@ -66,6 +66,10 @@ int potrs(uplo_t uplo, const matrixA_t& A, matrixB_t& B)
     tlapack_check_false(nrows(A) != ncols(A));
     tlapack_check_false(nrows(B) != ncols(A));
 
+    tlapack_trace(
+        "potrs", internal::trace_flops<T>(2. * nrows(B) * nrows(B) * ncols(B)),
+        sizeof(T) * (double(nrows(A)) * nrows(A) / 2 + 2. * nrows(B) * ncols(B)));
+
     if (uplo == Uplo::Upper) {
         // Solve A*X = B where A = U**H *U.
         trsm(LEFT_SIDE, UPPER_TRIANGLE, CONJ_TRANS, NON_UNIT_DIAG, one, A, B);
@@ -0,0 +1,104 @@
+/// @file potrs_batched.hpp Apply the Cholesky factorizations of a batch of
+/// matrices to solve linear systems.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_POTRS_BATCHED_HH
+#define TLAPACK_POTRS_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+#include "tlapack/blas/trsm_batched.hpp"
+
+namespace tlapack {
+
+/** Apply the Cholesky factorizations of a batch of matrices to solve the
+ * linear systems
+ * \[
+ *      A_b X_b = B_b,
+ * \]
+ * where
+ *      $A_b = U_b^H U_b,$ if uplo = Upper, or
+ *      $A_b = L_b L_b^H,$ if uplo = Lower,
+ * as computed by potrf_batched(). See potrs().
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangles of A_b contain the matrices U_b;
+ *      - Uplo::Lower: Lower triangles of A_b contain the matrices L_b.
+ *      The other triangular parts are not referenced.
+ *
+ * @param[in] A Batch of n-by-n factors U_b or L_b.
+ *
+ * @param[in,out] B Batch of n-by-nrhs matrices.
+ *      On entry, the matrices B_b.
+ *      On exit,  the matrices X_b.
+ *
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t, class batchA_t, class batchB_t>
+int potrs_batched(uplo_t uplo,
+                  const batchA_t& A,
+                  batchB_t& B,
+                  const BatchOpts& opts = {})
+{
+    const auto A_ = internal::batch_view(A);
+    const auto B_ = internal::batch_view(B);
+    const size_t count = internal::batch_count(B_);
+
+    // Check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(internal::batch_count(A_) != count);
+
+    // Quick return
+    if (count == 0) return 0;
+
+    // Constants
+    const size_t n = internal::batch_nrows(B_);
+    const size_t nrhs = internal::batch_ncols(B_);
+
+    // Check arguments
+    tlapack_check_false(!internal::batch_is(A_, n, n));
+    tlapack_check_false(!internal::batch_is(B_, n, nrhs));
+
+    internal::batch_for_each(
+        count, opts,
+        [&](size_t b0, size_t b1, size_t, const auto& A, const auto& B) {
+            using T = std::decay_t<decltype(B(0, 0, 0))>;
+            using real_t = real_type<T>;
+            const real_t one(1);
+
+            if (uplo == Uplo::Upper) {
+                // Solve A*X = B where A = U**H *U.
+                internal::trsm_batched_kernel<Op::ConjTrans>(
+                    Side::Left, Uplo::Upper, Diag::NonUnit, one, A, B, n, nrhs,
+                    b0, b1);
+                internal::trsm_batched_kernel<Op::NoTrans>(
+                    Side::Left, Uplo::Upper, Diag::NonUnit, one, A, B, n, nrhs,
+                    b0, b1);
+            }
+            else {
+                // Solve A*X = B where A = L*L**H.
+                internal::trsm_batched_kernel<Op::NoTrans>(
+                    Side::Left, Uplo::Lower, Diag::NonUnit, one, A, B, n, nrhs,
+                    b0, b1);
+                internal::trsm_batched_kernel<Op::ConjTrans>(
+                    Side::Left, Uplo::Lower, Diag::NonUnit, one, A, B, n, nrhs,
+                    b0, b1);
+            }
+        },
+        A_, B_);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_POTRS_BATCHED_HH
@@ -0,0 +1,140 @@
+/// @file ptsv_batched.hpp Solves a batch of Hermitian positive definite
+/// tridiagonal linear systems.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PTSV_BATCHED_HH
+#define TLAPACK_PTSV_BATCHED_HH
+
+#include "tlapack/base/batch.hpp"
+
+namespace tlapack {
+
+/** Solves a batch of linear systems
+ * \[
+ *      A_b X_b = B_b,
+ * \]
+ * where each A_b is an n-by-n Hermitian positive definite tridiagonal matrix.
+ *
+ * Each A_b is factored as $A_b = L_b D_b L_b^H$, as in pttrf(), and the
+ * factorization is used to solve the system, as in pttrs(). The recurrences
+ * of the systems of a group advance together, one row at a time, so that the
+ * innermost loops run over independent systems. This removes the overhead of
+ * one call per system when solving many small systems.
+ *
+ * @param[in,out] D Batch of vectors of size n.
+ *      On entry, the diagonals of A_b.
+ *      On exit, the diagonals of the factors D_b.
+ *
+ * @param[in,out] E Batch of vectors of size at least n-1.
+ *      On entry, the subdiagonals of A_b.
+ *      On exit, the subdiagonals of the unit lower bidiagonal factors L_b.
+ *
+ * @param[in,out] B Batch of n-by-nrhs matrices.
+ *      On entry, the matrices B_b.
+ *      On exit, the solutions X_b if info[b] = 0.
+ *
+ * @param[out] info Integer vector with one entry per system.
+ *      info[b] = 0 if the system b was solved, or i+1 if the leading minor of
+ *      order i+1 of A_b is not positive definite.
+ *
+ * @param[in] opts Options. See BatchOpts.
+ *
+ * @return The number of systems with info[b] != 0.
+ *
+ * @ingroup computational
+ */
+template <class batchD_t,
+          class batchE_t,
+          class batchB_t,
+          TLAPACK_VECTOR info_t>
+int ptsv_batched(batchD_t& D,
+                 batchE_t& E,
+                 batchB_t& B,
+                 info_t& info,
+                 const BatchOpts& opts = {})
+{
+    const auto D_ = internal::batch_view(D);
+    const auto E_ = internal::batch_view(E);
+    const auto B_ = internal::batch_view(B);
+    const size_t count = internal::batch_count(B_);
+
+    // check arguments
+    tlapack_check_false(internal::batch_count(D_) != count);
+    tlapack_check_false(internal::batch_count(E_) != count);
+    tlapack_check_false((size_t)size(info) < count);
+
+    // Quick return
+    if (count == 0) return 0;
+
+    // constants
+    const size_t n = internal::batch_nrows(B_);
+    const size_t nrhs = internal::batch_ncols(B_);
+
+    // check arguments
+    tlapack_check_false(!internal::batch_is(B_, n, nrhs));
+    tlapack_check_false(!internal::batch_fits(D_, n));
+    tlapack_check_false(n > 0 && !internal::batch_fits(E_, n - 1));
+
+    for (size_t b = 0; b < count; ++b)
+        info[b] = 0;
+
+    // Quick return
+    if (n == 0) return 0;
+
+    internal::batch_for_each(
+        count, opts,
+        [&](size_t b0, size_t b1, size_t first, const auto& D, const auto& E,
+            const auto& B) {
+            using real_t = real_type<std::decay_t<decltype(D(0, 0, 0))>>;
+            const real_t zero(0);
+            const real_t one(1);
+
+            // Factor A_b = L_b D_b L_b^H
+            for (size_t i = 0; i + 1 < n; ++i) {
+                for (size_t b = b0; b < b1; ++b) {
+                    const auto ei = E(b, i, 0);
+                    E(b, i, 0) = ei / real(D(b, i, 0));
+                    D(b, i + 1, 0) -= real(E(b, i, 0) * conj(ei));
+                }
+            }
+
+            // Check for non-positive pivots
+            for (size_t b = b0; b < b1; ++b)
+                for (size_t i = 0; i < n; ++i)
+                    if (!(real(D(b, i, 0)) > zero)) {
+                        info[first + b - b0] = i + 1;
+                        break;
+                    }
+
+            for (size_t k = 0; k < nrhs; ++k) {
+                // Solve L_b*Y_b = B_b
+                for (size_t i = 1; i < n; ++i)
+                    for (size_t b = b0; b < b1; ++b)
+                        B(b, i, k) -= E(b, i - 1, 0) * B(b, i - 1, k);
+
+                // Solve D_b*L_b**H*X_b = Y_b
+                for (size_t b = b0; b < b1; ++b)
+                    B(b, n - 1, k) *= one / real(D(b, n - 1, 0));
+                for (size_t i = n - 1; i-- > 0;)
+                    for (size_t b = b0; b < b1; ++b)
+                        B(b, i, k) = B(b, i, k) * (one / real(D(b, i, 0))) -
+                                     conj(E(b, i, 0)) * B(b, i + 1, k);
+            }
+        },
+        D_, E_, B_);
+
+    int nfailed = 0;
+    for (size_t b = 0; b < count; ++b)
+        if (info[b] != 0) ++nfailed;
+    return nfailed;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PTSV_BATCHED_HH
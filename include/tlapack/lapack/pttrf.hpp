@@ -49,7 +49,7 @@ template <class d_t,
                       int> = 0>
 int pttrf(d_t& D, e_t& E, const EcOpts& opts = {})
 {
-    using T = type_t<d_t>;
+    using T = type_t<e_t>;
     using real_t = real_type<T>;
     using idx_t = size_type<d_t>;
     // Constants
@@ -0,0 +1,109 @@
+/// @file pttrs.hpp Solves a linear system using the factorization of a
+/// Hermitian positive definite tridiagonal matrix computed by pttrf.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_PTTRS_HH
+#define TLAPACK_PTTRS_HH
+
+#include "tlapack/base/tuning.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for pttrs()
+struct PttrsOpts {
+    size_t nb = tuned("pttrs.nb", 16);  ///< Number of right-hand sides
+                                        ///< processed together
+};
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * with the factorization $A = L D L^H$ of a Hermitian positive definite
+ * tridiagonal matrix computed by pttrf().
+ *
+ * Each substitution is a recurrence along the rows of B. The right-hand sides
+ * are processed in groups of opts.nb columns, and the recurrences of a group
+ * advance together, one row at a time, so that the loop over the columns of
+ * the group is independent and can be vectorized.
+ *
+ * @param[in] D Vector of size n.
+ *      The diagonal of the factor D.
+ *
+ * @param[in] E Vector of size n-1.
+ *      The subdiagonal of the unit lower bidiagonal factor L.
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit, the solution X.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: number of right-hand sides processed together.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_VECTOR d_t,
+          TLAPACK_VECTOR e_t,
+          TLAPACK_SMATRIX matrixB_t>
+int pttrs(const d_t& D,
+          const e_t& E,
+          matrixB_t& B,
+          const PttrsOpts& opts = {})
+{
+    using T = type_t<matrixB_t>;
+    using idx_t = size_type<matrixB_t>;
+
+    // Constants
+    const idx_t n = nrows(B);
+    const idx_t nrhs = ncols(B);
+    const idx_t nb = max<idx_t>(opts.nb, 1);
+
+    // Check arguments
+    tlapack_check_false((idx_t)size(D) != n);
+    tlapack_check_false(n > 0 && (idx_t)size(E) + 1 != n);
+
+    tlapack_trace("pttrs", internal::trace_flops<T>(5. * n * nrhs),
+                  sizeof(T) * (2. * n + 2. * n * nrhs));
+
+    // Quick return
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    for (idx_t k0 = 0; k0 < nrhs; k0 += nb) {
+        const idx_t k1 = min(k0 + nb, nrhs);
+
+        // Solve L*Y = B
+        for (idx_t i = 1; i < n; ++i) {
+            const auto ei = E[i - 1];
+            for (idx_t k = k0; k < k1; ++k)
+                B(i, k) -= ei * B(i - 1, k);
+        }
+
+        // Solve D*L**H*X = Y
+        {
+            const auto dinv = real_type<T>(1) / real(D[n - 1]);
+            for (idx_t k = k0; k < k1; ++k)
+                B(n - 1, k) *= dinv;
+        }
+        for (idx_t i = n - 1; i-- > 0;) {
+            const auto dinv = real_type<T>(1) / real(D[i]);
+            const auto ei = conj(E[i]);
+            for (idx_t k = k0; k < k1; ++k)
+                B(i, k) = B(i, k) * dinv - ei * B(i + 1, k);
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_PTTRS_HH
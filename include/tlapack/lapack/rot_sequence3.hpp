@@ -12,6 +12,7 @@
 
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/rot.hpp"
+#include "tlapack/lapack/rot_sequence.hpp"
 
 namespace tlapack {
 
@@ -129,11 +130,13 @@ void rot_sequence3(
         if (side == Side::Left) {
             if (direction == Direction::Forward) {
                 // Left side, forward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < n; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, n);
                     // Startup phase
-                    for (idx_t i1 = 0; i1 < n; ++i1) {
+                    for (idx_t i1 = ib; i1 < ib2; ++i1) {
                         for (idx_t j = 0; j < l - 1; ++j) {
                             for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                                 idx_t g = m - 2 - g2;
@@ -229,7 +232,9 @@ void rot_sequence3(
             }
             else {
                 // Left side, backward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < n; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, n);
                     // Startup phase
@@ -329,7 +334,9 @@ void rot_sequence3(
         else {
             if (direction == Direction::Forward) {
                 // Right side, forward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < m; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, m);
                     // Startup phase
@@ -430,7 +437,9 @@ void rot_sequence3(
             }
             else {
                 // Right side, backward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < m; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, m);
                     // Startup phase
@@ -529,14 +538,16 @@ void rot_sequence3(
         if (side == Side::Left) {
             if (direction == Direction::Forward) {
                 // Left side, forward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < n; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, n);
                     // Startup phase
                     for (idx_t j = 0; j < l - 1; ++j) {
                         for (idx_t i = 0, g2 = j; i < j + 1; ++i, --g2) {
                             idx_t g = m - 2 - g2;
-                            for (idx_t i1 = 0; i1 < n; ++i1) {
+                            for (idx_t i1 = ib; i1 < ib2; ++i1) {
                                 T temp =
                                     C(g, i) * A(g, i1) + S(g, i) * A(g + 1, i1);
                                 A(g + 1, i1) = -conj(S(g, i)) * A(g, i1) +
@@ -630,7 +641,9 @@ void rot_sequence3(
             }
             else {
                 // Left side, backward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < n; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, n);
                     // Startup phase
@@ -731,7 +744,9 @@ void rot_sequence3(
         else {
             if (direction == Direction::Forward) {
                 // Right side, forward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < m; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, m);
                     // Startup phase
@@ -832,7 +847,9 @@ void rot_sequence3(
             }
             else {
                 // Right side, backward direction
-#pragma omp parallel for
+#ifdef _OPENMP
+    #pragma omp parallel for
+#endif
                 for (idx_t ib = 0; ib < m; ib += nb) {
                     idx_t ib2 = std::min(ib + nb, m);
                     // Startup phase
@@ -0,0 +1,275 @@
+/// @file secular_equation.hpp Roots of the secular equations of the
+/// divide-and-conquer algorithms.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_SECULAR_EQUATION_HH
+#define TLAPACK_SECULAR_EQUATION_HH
+
+#include <algorithm>
+
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /**
+     * Scales the poles p and the weights z of a secular equation so that the
+     * largest entry of the underlying matrix is one.
+     *
+     * If rank_one is true, the matrix is diag(p) + z z^T. The scaling factor
+     * is max(|p_i|, ||z||^2), the poles are divided by it and the weights by
+     * its square root. Otherwise, the matrix is the broken arrow matrix with
+     * diagonal p and first row z. The scaling factor is max(|p_i|, |z_i|),
+     * and both the poles and the weights are divided by it.
+     *
+     * @return The scaling factor, or zero if p and z are zero. In that case,
+     *      p and z are not modified.
+     */
+    template <class real_t>
+    real_t secular_scale(arena_vector<real_t>& p,
+                         arena_vector<real_t>& z,
+                         bool rank_one)
+    {
+        const size_t N = p.size();
+
+        real_t orgnrm(0), znrm2(0);
+        for (size_t i = 0; i < N; ++i) {
+            orgnrm = max(orgnrm, abs(p[i]));
+            if (rank_one)
+                znrm2 += z[i] * z[i];
+            else
+                orgnrm = max(orgnrm, abs(z[i]));
+        }
+        if (rank_one) orgnrm = max(orgnrm, znrm2);
+        if (orgnrm == real_t(0)) return orgnrm;
+
+        const real_t zscal = rank_one ? sqrt(orgnrm) : orgnrm;
+        for (size_t i = 0; i < N; ++i) {
+            p[i] /= orgnrm;
+            z[i] /= zscal;
+        }
+        return orgnrm;
+    }
+
+    /**
+     * Deflates the secular equation with poles p and weights z.
+     *
+     * The poles p[first:N] are sorted in increasing order. Ties are broken by
+     * the index, which gives the order of a stable sort. Poles with weight
+     * |z_i| <= ztol are deflated. Then, for each pair prev < i of consecutive
+     * poles that are not deflated, the rotation [c s; -s c] with c = z_i / r,
+     * s = z_prev / r and r = sqrt(z_i^2 + z_prev^2) is offered to rotate(i,
+     * prev, c, s). If rotate() applies the rotation to the vectors of the
+     * poles and returns true, z_i becomes r and the pole prev is deflated.
+     *
+     * @param[in,out] p Poles.
+     * @param[in,out] z Weights.
+     * @param[in] first The poles 0:first are not sorted nor deflated.
+     * @param[in] ztol Tolerance for the weights.
+     * @param[in] rotate Functor with signature bool(idx_t, idx_t, real_t,
+     *      real_t).
+     * @param[out] deflated deflated[i] is true if the pole i is deflated.
+     * @param[out] active The poles 0:first, followed by the poles that are not
+     *      deflated in increasing order.
+     * @param[out] pr Poles of the deflated secular equation, p[active].
+     * @param[out] zr Weights of the deflated secular equation, z[active].
+     */
+    template <class real_t, class idx_t, class rotate_t>
+    void secular_deflate(arena_vector<real_t>& p,
+                         arena_vector<real_t>& z,
+                         idx_t first,
+                         real_t ztol,
+                         rotate_t&& rotate,
+                         arena_vector<bool>& deflated,
+                         arena_vector<idx_t>& active,
+                         arena_vector<real_t>& pr,
+                         arena_vector<real_t>& zr)
+    {
+        const idx_t N = p.size();
+
+        arena_vector<idx_t> order(N - first);
+        for (idx_t i = first; i < N; ++i)
+            order[i - first] = i;
+        std::sort(order.begin(), order.end(), [&p](idx_t a, idx_t b) {
+            return (p[a] < p[b]) || (p[a] == p[b] && a < b);
+        });
+
+        deflated.assign(N, false);
+        for (idx_t i : order)
+            if (abs(z[i]) <= ztol) deflated[i] = true;
+
+        idx_t prev = N;
+        for (idx_t i : order) {
+            if (deflated[i]) continue;
+            if (prev != N) {
+                const real_t r = sqrt(z[i] * z[i] + z[prev] * z[prev]);
+                if (rotate(i, prev, z[i] / r, z[prev] / r)) {
+                    z[i] = r;
+                    z[prev] = real_t(0);
+                    deflated[prev] = true;
+                }
+            }
+            prev = i;
+        }
+
+        active.clear();
+        active.reserve(N);
+        for (idx_t i = 0; i < first; ++i)
+            active.push_back(i);
+        for (idx_t i : order)
+            if (!deflated[i]) active.push_back(i);
+
+        const idx_t Nr = active.size();
+        pr.resize(Nr);
+        zr.resize(Nr);
+        for (idx_t r = 0; r < Nr; ++r) {
+            pr[r] = p[active[r]];
+            zr[r] = z[active[r]];
+        }
+    }
+
+    /**
+     * Solves the secular equation
+     * \[
+     *      f(x) = 1 + \sum_i z_i^2 / (\delta_i - x) = 0
+     * \]
+     * for its j-th root, \delta_j < x_j < \delta_{j+1}.
+     *
+     * The poles are given relative to each other by delta(i,l) =
+     * \delta_i - \delta_l, so that the same solver is used for the
+     * eigenvalues of a rank-one update (delta(i,l) = d_i - d_l) and for the
+     * singular values of a broken arrow matrix (delta(i,l) = p_i^2 - p_l^2).
+     * The root is represented as x_j = \delta_K + mu, where K is the pole
+     * closest to the root, so that the differences \delta_i - x_j are computed
+     * accurately. Each iteration interpolates the sums of the poles on each
+     * side of the root by a rational function with one pole, and falls back
+     * to bisection if the step leaves the current bracket.
+     *
+     * @return true if the iteration converged.
+     *
+     * @param[in] z Weights, z[i] != 0.
+     * @param[in] delta Functor such that delta(i,l) = \delta_i - \delta_l. The
+     *      poles must be strictly increasing.
+     * @param[in] j Index of the root.
+     * @param[out] K Index of the origin.
+     * @param[out] mu x_j - \delta_K.
+     */
+    template <class real_t, class delta_t>
+    bool secular_root(const arena_vector<real_t>& z,
+                      const delta_t& delta,
+                      size_t j,
+                      size_t& K,
+                      real_t& mu)
+    {
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const real_t half(0.5);
+        const real_t eps = ulp<real_t>();
+        const size_t N = z.size();
+        const bool has_right_pole = (j + 1 < N);
+
+        // Bracket of mu
+        real_t lo, hi;
+        if (has_right_pole) {
+            const real_t gap = delta(j + 1, j);
+            real_t f = one;
+            for (size_t i = 0; i < N; ++i)
+                f += z[i] * z[i] / (delta(i, j) - half * gap);
+            if (f >= zero) {
+                K = j;
+                lo = zero;
+                hi = half * gap;
+            }
+            else {
+                K = j + 1;
+                lo = -half * gap;
+                hi = zero;
+            }
+        }
+        else {
+            K = j;
+            lo = zero;
+            hi = zero;
+            for (size_t i = 0; i < N; ++i)
+                hi += z[i] * z[i];
+        }
+
+        // Poles that bound the root
+        const real_t a = delta(j, K);
+        const real_t b = has_right_pole ? delta(j + 1, K) : zero;
+
+        mu = half * (lo + hi);
+        for (int iter = 0; iter < 100; ++iter) {
+            // psi has the poles to the left of the root and phi the others
+            real_t psi(0), dpsi(0), phi(0), dphi(0);
+            for (size_t i = 0; i <= j; ++i) {
+                const real_t t = z[i] / (delta(i, K) - mu);
+                psi += z[i] * t;
+                dpsi += t * t;
+            }
+            for (size_t i = j + 1; i < N; ++i) {
+                const real_t t = z[i] / (delta(i, K) - mu);
+                phi += z[i] * t;
+                dphi += t * t;
+            }
+            const real_t f = one + psi + phi;
+
+            // Convergence test
+            if (abs(f) <= real_t(8 * N) * eps * (one + abs(psi) + abs(phi)))
+                return true;
+            if (f > zero)
+                hi = mu;
+            else
+                lo = mu;
+            if (hi - lo <= real_t(2) * eps * max(abs(lo), abs(hi))) return true;
+
+            // Rational interpolation: psi(x) ~ Pa + Qa / (a - x) and
+            // phi(x) ~ Pb + Qb / (b - x)
+            real_t eta = half * (lo + hi);
+            const real_t Qa = dpsi * (a - mu) * (a - mu);
+            real_t C = one + psi - dpsi * (a - mu);
+            if (has_right_pole) {
+                const real_t Qb = dphi * (b - mu) * (b - mu);
+                C += phi - dphi * (b - mu);
+
+                // C (a - x) (b - x) + Qa (b - x) + Qb (a - x) = 0
+                const real_t A1 = -(C * (a + b) + Qa + Qb);
+                const real_t A0 = C * a * b + Qa * b + Qb * a;
+                const real_t disc = A1 * A1 - real_t(4) * C * A0;
+                if (disc >= zero) {
+                    const real_t q =
+                        -half * (A1 + ((A1 >= zero) ? sqrt(disc) : -sqrt(disc)));
+                    if (q != zero) {
+                        const real_t r2 = A0 / q;
+                        if (lo < r2 && r2 < hi)
+                            eta = r2;
+                        else if (C != zero) {
+                            const real_t r1 = q / C;
+                            if (lo < r1 && r1 < hi) eta = r1;
+                        }
+                    }
+                }
+            }
+            else if (C > zero) {
+                const real_t r = a + Qa / C;
+                if (lo < r && r < hi) eta = r;
+            }
+            mu = eta;
+        }
+
+        return false;
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_SECULAR_EQUATION_HH
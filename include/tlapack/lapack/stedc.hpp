@@ -0,0 +1,347 @@
+/// @file stedc.hpp Eigendecomposition of a symmetric tridiagonal matrix using
+/// a divide-and-conquer algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @note Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dstedc.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEDC_HH
+#define TLAPACK_STEDC_HH
+
+#include <algorithm>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/secular_equation.hpp"
+#include "tlapack/lapack/steqr.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for stedc()
+struct StedcOpts {
+    size_t nx = 25;  ///< Subproblems of size at most nx are solved by steqr()
+};
+
+namespace internal {
+
+    /**
+     * Merges the eigendecompositions of two tridiagonal subproblems.
+     *
+     * The nn-by-nn matrix has the form
+     * \[
+     *      T = diag(T1, T2) + rho v v^T,
+     * \]
+     * where T1 is k-by-k and v = e_{k-1} + sign(rho) e_k. On entry, the
+     * eigenvalues of T1 and T2 are in d(0:k) and d(k:nn), and the diagonal
+     * blocks of Q contain their eigenvectors. The off-diagonal blocks of Q
+     * are zero. On exit, d and Q contain the eigendecomposition of T.
+     *
+     * The eigenvalues are the roots of a secular equation. The eigenvectors
+     * are computed from them and are multiplied to Q using gemm().
+     *
+     * @return 0 if success, 1 if the secular equation did not converge.
+     */
+    template <class d_t, class Q_t>
+    int stedc_merge(size_type<Q_t> k, type_t<d_t> rho, d_t& d, Q_t& Q)
+    {
+        using idx_t = size_type<Q_t>;
+        using work_t = matrix_type<Q_t>;
+        using real_t = type_t<work_t>;
+
+        Create<work_t> new_matrix;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t N = nrows(Q);
+
+        // Poles and weights. The weights include the factor sqrt(|rho|)
+        const real_t srho = sqrt(abs(rho));
+        arena_vector<real_t> p(N), z(N);
+        for (idx_t j = 0; j < k; ++j) {
+            p[j] = d[j];
+            z[j] = srho * Q(k - 1, j);
+        }
+        for (idx_t j = k; j < N; ++j) {
+            p[j] = d[j];
+            z[j] = (rho >= zero) ? srho * Q(k, j) : -srho * Q(k, j);
+        }
+
+        // Scale the problem so that its largest entry is one
+        const real_t orgnrm = secular_scale(p, z, true);
+        if (orgnrm == zero) return 0;
+        real_t znrm(0);
+        for (idx_t j = 0; j < N; ++j)
+            znrm += z[j] * z[j];
+        znrm = sqrt(znrm);
+
+        // Columns of Q
+        arena_vector<real_t> Qc_;
+        auto Qc = new_matrix(Qc_, N, N);
+        lacpy(GENERAL, Q, Qc);
+
+        // Deflation. The poles are rotated together with their eigenvectors
+        const real_t tol = real_t(8) * ulp<real_t>();
+        const real_t ztol = (znrm > zero) ? tol / znrm : one;
+        arena_vector<bool> deflated;
+        arena_vector<idx_t> active;
+        arena_vector<real_t> pr, zr;
+        secular_deflate(
+            p, z, idx_t(0), ztol,
+            [&](idx_t i, idx_t prev, real_t c, real_t s) {
+                if (abs((p[i] - p[prev]) * c * s) > tol) return false;
+                auto qi = col(Qc, i);
+                auto qp = col(Qc, prev);
+                rot(qi, qp, c, s);
+                const real_t pi = c * c * p[i] + s * s * p[prev];
+                p[prev] = s * s * p[i] + c * c * p[prev];
+                p[i] = pi;
+                return true;
+            },
+            deflated, active, pr, zr);
+        const idx_t Nr = active.size();
+
+        // d_i - d_l
+        auto delta = [&pr](size_t i, size_t l) { return pr[i] - pr[l]; };
+
+        // Eigenvalues
+        int info = 0;
+        arena_vector<size_t> K(Nr);
+        arena_vector<real_t> mu(Nr);
+        for (idx_t r = 0; r < Nr; ++r)
+            if (!secular_root(zr, delta, r, K[r], mu[r])) info = 1;
+
+        // d_i - lambda_r
+        auto diff = [&](idx_t i, idx_t r) { return delta(i, K[r]) - mu[r]; };
+
+        // Recompute the weights so that the computed eigenvalues are exact for
+        // them (Lowner's formula). This makes the eigenvectors orthogonal
+        for (idx_t i = 0; i < Nr; ++i) {
+            real_t prod = -diff(i, Nr - 1);
+            for (idx_t r = 0; r < i; ++r)
+                prod *= diff(i, r) / delta(i, r);
+            for (idx_t r = i; r + 1 < Nr; ++r)
+                prod *= diff(i, r) / delta(i, r + 1);
+            const real_t zi = sqrt(abs(prod));
+            zr[i] = (zr[i] >= zero) ? zi : -zi;
+        }
+
+        // Eigenvectors of the deflated problem
+        arena_vector<real_t> VM_;
+        auto VM = new_matrix(VM_, Nr, Nr);
+        for (idx_t r = 0; r < Nr; ++r) {
+            real_t vnrm(0);
+            for (idx_t i = 0; i < Nr; ++i) {
+                VM(i, r) = zr[i] / diff(i, r);
+                vnrm += VM(i, r) * VM(i, r);
+            }
+            vnrm = sqrt(vnrm);
+            for (idx_t i = 0; i < Nr; ++i)
+                VM(i, r) /= vnrm;
+        }
+
+        // Multiply the eigenvectors to the columns of Q
+        arena_vector<real_t> Qa_;
+        auto Qa = new_matrix(Qa_, N, Nr);
+        for (idx_t r = 0; r < Nr; ++r)
+            for (idx_t i = 0; i < N; ++i)
+                Qa(i, r) = Qc(i, active[r]);
+        arena_vector<real_t> Qr_;
+        auto Qr = new_matrix(Qr_, N, Nr);
+        gemm(NO_TRANS, NO_TRANS, one, Qa, VM, zero, Qr);
+
+        // Sort the eigenvalues in increasing order. Entries with source < Nr
+        // are eigenvalues of the deflated problem, the others are deflated
+        // poles
+        arena_vector<std::pair<real_t, idx_t>> values;
+        values.reserve(N);
+        for (idx_t r = 0; r < Nr; ++r)
+            values.emplace_back(pr[K[r]] + mu[r], r);
+        for (idx_t i = 0; i < N; ++i)
+            if (deflated[i]) values.emplace_back(p[i], Nr + i);
+        std::sort(values.begin(), values.end(),
+                  [](const auto& a, const auto& b) {
+                      return (a.first < b.first) ||
+                             (a.first == b.first && a.second < b.second);
+                  });
+
+        for (idx_t j = 0; j < N; ++j) {
+            const idx_t src = values[j].second;
+            d[j] = values[j].first * orgnrm;
+            if (src < Nr) {
+                for (idx_t i = 0; i < N; ++i)
+                    Q(i, j) = Qr(i, src);
+            }
+            else {
+                for (idx_t i = 0; i < N; ++i)
+                    Q(i, j) = Qc(i, src - Nr);
+            }
+        }
+
+        return info;
+    }
+
+    /**
+     * Computes the eigendecomposition T = Q diag(d) Q^T of the symmetric
+     * tridiagonal matrix T with diagonal d and off-diagonal e.
+     *
+     * The matrix is split in two halves by a rank-one modification, the
+     * halves are solved recursively, and their eigendecompositions are
+     * merged by stedc_merge(). Subproblems of size at most nx are solved by
+     * steqr().
+     *
+     * @param[in,out] d Vector of length nn. On exit, the eigenvalues in
+     *      increasing order.
+     * @param[in,out] e Vector of length nn-1. Destroyed on exit.
+     * @param[out] Q nn-by-nn matrix of eigenvectors.
+     * @param[in] nx Size of the subproblems solved by steqr().
+     */
+    template <class d_t, class e_t, class Q_t>
+    int stedc_rec(d_t& d, e_t& e, Q_t& Q, size_type<Q_t> nx)
+    {
+        using idx_t = size_type<Q_t>;
+        using real_t = type_t<Q_t>;
+        using range = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t nn = size(d);
+
+        if (nn <= nx) {
+            laset(GENERAL, zero, one, Q);
+            return steqr(true, d, e, Q);
+        }
+
+        // T = diag(T1, T2) + rho v v^T
+        const idx_t k = nn / 2;
+        const real_t rho = e[k - 1];
+        d[k - 1] -= abs(rho);
+        d[k] -= abs(rho);
+
+        auto Q12 = slice(Q, range{0, k}, range{k, nn});
+        auto Q21 = slice(Q, range{k, nn}, range{0, k});
+        laset(GENERAL, zero, zero, Q12);
+        laset(GENERAL, zero, zero, Q21);
+
+        auto d1 = slice(d, range{0, k});
+        auto e1 = slice(e, range{0, k - 1});
+        auto Q1 = slice(Q, range{0, k}, range{0, k});
+        int info = stedc_rec(d1, e1, Q1, nx);
+        if (info != 0) return info;
+
+        auto d2 = slice(d, range{k, nn});
+        auto e2 = slice(e, range{k, nn - 1});
+        auto Q2 = slice(Q, range{k, nn}, range{k, nn});
+        info = stedc_rec(d2, e2, Q2, nx);
+        if (info != 0) return info;
+
+        return stedc_merge(k, rho, d, Q);
+    }
+
+}  // namespace internal
+
+/**
+ * Computes all eigenvalues and, optionally, eigenvectors of a real symmetric
+ * tridiagonal matrix T using a divide-and-conquer algorithm.
+ *
+ * The eigenvectors of a hermitian matrix can also be found if hetrd() has
+ * been used to reduce this matrix to tridiagonal form, and ungtr() has been
+ * used to form the unitary matrix Q. In that case, Z = Q on entry, and the
+ * eigenvectors of the original matrix are returned in Z.
+ *
+ * T is split in two halves by a rank-one modification. The eigendecompositions
+ * of the halves are computed recursively and merged by solving a secular
+ * equation, after the deflation of negligible components. The eigenvectors of
+ * each merge are applied with gemm(), so that most of the work is done in
+ * level-3 operations. Subproblems of size at most opts.nx are solved by
+ * steqr(). If no eigenvectors are requested, steqr() is used.
+ *
+ * See "A divide-and-conquer algorithm for the symmetric tridiagonal
+ * eigenproblem," by M. Gu and S. Eisenstat, SIAM J. Matrix Anal. Appl.
+ * vol. 16, no. 1, pp. 172-191, 1995.
+ *
+ * @return  0 if success
+ * @return  i > 0 if steqr() failed to converge, or if the secular equation of
+ *          a merge did not converge.
+ *
+ * @param[in] want_z bool
+ *      If true, the eigenvectors are computed.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the diagonal elements of T.
+ *      On exit, the eigenvalues of T in increasing order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, the off-diagonal elements of T.
+ *      On exit, e is destroyed.
+ *
+ * @param[in,out] Z nz-by-n matrix.
+ *      On entry, an nz-by-n unitary matrix.
+ *      On exit, if want_z, Z is overwritten by Z * Q, where T = Q * D * Q^T.
+ *      Not referenced if want_z = false.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nx: size of the subproblems solved by steqr().
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int stedc(bool want_z,
+          d_t& d,
+          e_t& e,
+          matrix_t& Z,
+          const StedcOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using r_matrix_t = real_type<matrix_t>;
+    using real_t = type_t<r_matrix_t>;
+
+    Create<r_matrix_t> new_real_matrix;
+    Create<matrix_t> new_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t nx = max<idx_t>(opts.nx, 1);
+
+    // check arguments
+    tlapack_check((idx_t)size(e) >= n - 1);
+    if (want_z) tlapack_check(ncols(Z) == n);
+
+    // Small problems and problems without eigenvectors
+    if (n <= nx || !want_z) return steqr(want_z, d, e, Z);
+
+    // Eigendecomposition of T
+    arena_vector<real_t> Q_;
+    auto Q = new_real_matrix(Q_, n, n);
+    auto eT = slice(e, range{0, n - 1});
+    int info = internal::stedc_rec(d, eT, Q, nx);
+    if (info != 0) return info;
+
+    // Z = Z Q
+    arena_vector<type_t<matrix_t>> W_;
+    auto W = new_matrix(W_, nrows(Z), n);
+    lacpy(GENERAL, Z, W);
+    gemm(NO_TRANS, NO_TRANS, one, W, Q, zero, Z);
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEDC_HH
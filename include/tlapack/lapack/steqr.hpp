@@ -0,0 +1,286 @@
+/// @file steqr.hpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zsteqr.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_STEQR_HH
+#define TLAPACK_STEQR_HH
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/lartg.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/blas/swap.hpp"
+#include "tlapack/lapack/lapy2.hpp"
+
+namespace tlapack {
+
+/**
+ * Computes all eigenvalues and, optionally, eigenvectors of a real symmetric
+ * tridiagonal matrix T using the implicit QL or QR method.
+ *
+ * The eigenvectors of a hermitian matrix can also be found if hetrd() has
+ * been used to reduce this matrix to tridiagonal form, and ungtr() has been
+ * used to form the unitary matrix Q. In that case, Z = Q on entry, and the
+ * eigenvectors of the original matrix are returned in Z.
+ *
+ * On each unreduced block, the QL method is used if the last diagonal entry
+ * is larger in magnitude than the first one, and the QR method otherwise.
+ * The shifts are Wilkinson shifts.
+ *
+ * @return  0 if success
+ * @return  i, 0 < i <= n-1, if the algorithm failed to find all the
+ *          eigenvalues in a total of 30*n iterations. i off-diagonal elements
+ *          have not converged to zero.
+ *
+ * @param[in] want_z bool
+ *      If true, the eigenvectors are computed.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the diagonal elements of T.
+ *      On exit, the eigenvalues of T in increasing order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, the off-diagonal elements of T.
+ *      On exit, e is destroyed.
+ *
+ * @param[in,out] Z nz-by-n matrix.
+ *      On entry, an nz-by-n unitary matrix.
+ *      On exit, if want_z, Z is overwritten by Z * Q, where T = Q * D * Q^T.
+ *      Not referenced if want_z = false.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_SMATRIX matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int steqr(bool want_z, d_t& d, e_t& e, matrix_t& Z)
+{
+    using idx_t = size_type<matrix_t>;
+    using real_t = type_t<d_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const idx_t n = size(d);
+    const real_t eps = ulp<real_t>();
+    const real_t eps2 = eps * eps;
+    const real_t safmin = safe_min<real_t>();
+    const idx_t nmaxit = 30 * n;
+
+    // check arguments
+    tlapack_check((idx_t)size(e) >= n - 1);
+    if (want_z) tlapack_check(ncols(Z) == n);
+
+    tlapack_trace("steqr", 0,
+                  want_z ? sizeof(type_t<matrix_t>) * double(n) * n : 0.);
+
+    // Quick return
+    if (n <= 1) return 0;
+
+    // Applies the plane rotation (c,s) to the columns j and j+1 of Z from
+    // the right: Z(:,j:j+2) := Z(:,j:j+2) * [c -s; s c]
+    auto rotate = [&](idx_t j, const real_t& c, const real_t& s) {
+        if (want_z) {
+            auto z0 = col(Z, j);
+            auto z1 = col(Z, j + 1);
+            rot(z1, z0, c, -s);
+        }
+    };
+
+    // Eigendecomposition of the 2-by-2 matrix [a b; b c]. On exit, a and c
+    // are the eigenvalues, and the columns j, j+1 of Z are updated
+    auto solve_2x2 = [&](real_t& a, real_t& b, real_t& c, idx_t j) {
+        if (b == zero) return;
+        const real_t tau = (c - a) / (two * b);
+        const real_t t = ((tau >= zero) ? one : -one) /
+                         (abs(tau) + lapy2(one, tau));
+        const real_t cs = one / lapy2(one, t);
+        const real_t sn = t * cs;
+        a -= t * b;
+        c += t * b;
+        b = zero;
+        if (want_z) {
+            auto z0 = col(Z, j);
+            auto z1 = col(Z, j + 1);
+            rot(z0, z1, cs, -sn);
+        }
+    };
+
+    idx_t jtot = 0;
+    idx_t l1 = 0;
+    while (l1 < n) {
+        if (l1 > 0) e[l1 - 1] = zero;
+
+        // Look for a small off-diagonal element to split the matrix
+        idx_t m = l1;
+        for (; m < n - 1; ++m) {
+            const real_t tst = abs(e[m]);
+            if (tst == zero) break;
+            if (tst <= (sqrt(abs(d[m])) * sqrt(abs(d[m + 1]))) * eps) {
+                e[m] = zero;
+                break;
+            }
+        }
+        idx_t l = l1;
+        idx_t lend = m;
+        l1 = m + 1;
+        if (lend == l) continue;
+
+        // Choose between QL and QR iteration
+        if (abs(d[lend]) < abs(d[l])) std::swap(l, lend);
+
+        if (lend > l) {
+            //
+            // QL Iteration
+            //
+            while (l <= lend) {
+                // Look for a small off-diagonal element
+                for (m = l; m < lend; ++m) {
+                    const real_t tst = abs(e[m]) * abs(e[m]);
+                    if (tst <= (eps2 * abs(d[m])) * abs(d[m + 1]) + safmin)
+                        break;
+                }
+                if (m < lend) e[m] = zero;
+
+                // Eigenvalue found
+                if (m == l) {
+                    ++l;
+                    continue;
+                }
+
+                // 2-by-2 block
+                if (m == l + 1) {
+                    solve_2x2(d[l], e[l], d[l + 1], l);
+                    l += 2;
+                    continue;
+                }
+
+                if (jtot == nmaxit) break;
+                ++jtot;
+
+                // Form shift
+                real_t p = d[l];
+                real_t g = (d[l + 1] - p) / (two * e[l]);
+                real_t r = lapy2(g, one);
+                g = d[m] - p + (e[l] / (g + ((g >= zero) ? r : -r)));
+
+                real_t s(1), c(1);
+                p = zero;
+
+                // Inner loop
+                for (idx_t i = m - 1; i != l - 1; --i) {
+                    const real_t f = s * e[i];
+                    const real_t b = c * e[i];
+                    lartg(g, f, c, s, r);
+                    if (i != m - 1) e[i + 1] = r;
+                    g = d[i + 1] - p;
+                    r = (d[i] - g) * s + two * c * b;
+                    p = s * r;
+                    d[i + 1] = g + p;
+                    g = c * r - b;
+                    rotate(i, c, -s);
+                }
+
+                d[l] = d[l] - p;
+                e[l] = g;
+            }
+        }
+        else {
+            //
+            // QR Iteration
+            //
+            while (l >= lend && l != idx_t(-1)) {
+                // Look for a small superdiagonal element
+                for (m = l; m > lend; --m) {
+                    const real_t tst = abs(e[m - 1]) * abs(e[m - 1]);
+                    if (tst <= (eps2 * abs(d[m])) * abs(d[m - 1]) + safmin)
+                        break;
+                }
+                if (m > lend) e[m - 1] = zero;
+
+                // Eigenvalue found
+                if (m == l) {
+                    --l;
+                    continue;
+                }
+
+                // 2-by-2 block
+                if (m + 1 == l) {
+                    solve_2x2(d[l - 1], e[l - 1], d[l], l - 1);
+                    l -= 2;
+                    continue;
+                }
+
+                if (jtot == nmaxit) break;
+                ++jtot;
+
+                // Form shift
+                real_t p = d[l];
+                real_t g = (d[l - 1] - p) / (two * e[l - 1]);
+                real_t r = lapy2(g, one);
+                g = d[m] - p + (e[l - 1] / (g + ((g >= zero) ? r : -r)));
+
+                real_t s(1), c(1);
+                p = zero;
+
+                // Inner loop
+                for (idx_t i = m; i < l; ++i) {
+                    const real_t f = s * e[i];
+                    const real_t b = c * e[i];
+                    lartg(g, f, c, s, r);
+                    if (i != m) e[i - 1] = r;
+                    g = d[i] - p;
+                    r = (d[i + 1] - g) * s + two * c * b;
+                    p = s * r;
+                    d[i] = g + p;
+                    g = c * r - b;
+                    rotate(i, c, s);
+                }
+
+                d[l] = d[l] - p;
+                e[l - 1] = g;
+            }
+        }
+
+        if (jtot == nmaxit) break;
+    }
+
+    // Count the off-diagonal elements that did not converge
+    if (jtot == nmaxit) {
+        int info = 0;
+        for (idx_t i = 0; i < n - 1; ++i)
+            if (e[i] != zero) ++info;
+        if (info > 0) return info;
+    }
+
+    // Sort the eigenvalues in increasing order using selection sort, which
+    // minimizes the number of swaps of columns of Z
+    for (idx_t i = 0; i < n - 1; ++i) {
+        idx_t k = i;
+        for (idx_t j = i + 1; j < n; ++j)
+            if (d[j] < d[k]) k = j;
+        if (k != i) {
+            std::swap(d[i], d[k]);
+            if (want_z) {
+                auto zi = col(Z, i);
+                auto zk = col(Z, k);
+                tlapack::swap(zi, zk);
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_STEQR_HH
@@ -0,0 +1,519 @@
+/// @file svd_dc.hpp Singular value decomposition of a bidiagonal matrix using
+/// a divide-and-conquer algorithm.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @note Adapted from @see
+/// https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dbdsdc.f
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_SVD_DC_HH
+#define TLAPACK_SVD_DC_HH
+
+#include <algorithm>
+
+#include "tlapack/base/utils.hpp"
+#include "tlapack/blas/gemm.hpp"
+#include "tlapack/blas/lartg.hpp"
+#include "tlapack/blas/rot.hpp"
+#include "tlapack/lapack/lacpy.hpp"
+#include "tlapack/lapack/laset.hpp"
+#include "tlapack/lapack/secular_equation.hpp"
+#include "tlapack/lapack/svd_qr.hpp"
+
+namespace tlapack {
+
+/// @brief Options struct for svd_dc()
+struct SvdDcOpts {
+    size_t nx = 25;  ///< Subproblems of size at most nx are solved by svd_qr()
+};
+
+namespace internal {
+
+    /**
+     * Merges the SVDs of two bidiagonal subproblems.
+     *
+     * The nn-by-(nn+sqre) matrix has the form
+     * \[
+     *      B = [ B1          0  ]
+     *          [ alpha e_k^T  beta e_0^T ]
+     *          [ 0           B2 ],
+     * \]
+     * where B1 is k-by-(k+1) and B2 is (nn-k-1)-by-(nn-k-1+sqre). On entry, the
+     * singular values of B1 and B2 are in d(0:k) and d(k+1:nn), and the
+     * diagonal blocks of U and V contain their singular vectors. The last
+     * column of each block of V is a null vector if the block is not square.
+     * On exit, d, U and V contain the SVD of B, and the last column of V is a
+     * null vector if sqre = 1.
+     *
+     * The singular values are the roots of a secular equation. The singular
+     * vectors are computed from them and are multiplied to U and V using
+     * gemm().
+     *
+     * @return 0 if success, 1 if the secular equation did not converge.
+     */
+    template <class d_t, class U_t, class V_t>
+    int svd_dc_merge(size_type<U_t> k,
+                     type_t<d_t> alpha,
+                     type_t<d_t> beta,
+                     size_type<U_t> sqre,
+                     d_t& d,
+                     U_t& U,
+                     V_t& V)
+    {
+        using idx_t = size_type<U_t>;
+        using work_t = matrix_type<U_t, V_t>;
+        using real_t = type_t<work_t>;
+
+        Create<work_t> new_matrix;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t nn = nrows(U);
+        const idx_t mV = nrows(V);
+        const idx_t N = nn;
+
+        // Poles, weights and the corresponding columns of U and V. The first
+        // pole is zero and its left singular vector is e_k
+        arena_vector<real_t> p(N), z(N);
+        arena_vector<real_t> Uc_;
+        auto Uc = new_matrix(Uc_, nn, N);
+        arena_vector<real_t> Vc_;
+        auto Vc = new_matrix(Vc_, mV, N);
+        laset(GENERAL, zero, zero, Uc);
+        for (idx_t i = 0; i < mV; ++i)
+            Vc(i, 0) = V(i, k);
+        Uc(k, 0) = one;
+        p[0] = zero;
+        z[0] = alpha * V(k, k);
+        for (idx_t j = 0; j < k; ++j) {
+            p[j + 1] = d[j];
+            z[j + 1] = alpha * V(k, j);
+        }
+        for (idx_t j = k + 1; j < nn; ++j) {
+            p[j] = d[j];
+            z[j] = beta * V(k + 1, j);
+        }
+        for (idx_t j = 0; j < nn; ++j) {
+            if (j == k) continue;
+            const idx_t jc = (j < k) ? j + 1 : j;
+            for (idx_t i = 0; i < nn; ++i)
+                Uc(i, jc) = U(i, j);
+            for (idx_t i = 0; i < mV; ++i)
+                Vc(i, jc) = V(i, j);
+        }
+
+        // If B is not square, rotate the null vectors of B1 and B2 so that
+        // one of them is a null vector of B
+        arena_vector<real_t> null_;
+        auto null = new_matrix(null_, mV, sqre);
+        if (sqre == 1) {
+            const real_t zx = beta * V(k + 1, nn);
+            const real_t r = sqrt(z[0] * z[0] + zx * zx);
+            const real_t c = (r == zero) ? one : z[0] / r;
+            const real_t s = (r == zero) ? zero : zx / r;
+            for (idx_t i = 0; i < mV; ++i)
+                null(i, 0) = V(i, nn);
+            auto v0 = col(Vc, 0);
+            auto vx = col(null, 0);
+            rot(v0, vx, c, s);
+            z[0] = r;
+        }
+
+        // Scale the problem so that its largest entry is one
+        real_t orgnrm = secular_scale(p, z, false);
+        if (orgnrm == zero) orgnrm = one;
+
+        // Deflation. The first pole stays in place and is never deflated. The
+        // other poles are rotated together with their singular vectors
+        const real_t tol = real_t(32) * ulp<real_t>();
+        if (abs(z[0]) <= tol) z[0] = (z[0] >= zero) ? tol : -tol;
+        arena_vector<bool> deflated;
+        arena_vector<idx_t> active;
+        arena_vector<real_t> pr, zr;
+        secular_deflate(
+            p, z, idx_t(1), tol,
+            [&](idx_t i, idx_t prev, real_t c, real_t s) {
+                if (p[i] - p[prev] > tol) return false;
+                auto ui = col(Uc, i);
+                auto up = col(Uc, prev);
+                rot(ui, up, c, s);
+                auto vi = col(Vc, i);
+                auto vp = col(Vc, prev);
+                rot(vi, vp, c, s);
+                return true;
+            },
+            deflated, active, pr, zr);
+        const idx_t Nr = active.size();
+        if (Nr > 1 && pr[1] < tol) pr[1] = tol;
+
+        // p_i^2 - p_l^2
+        auto delta = [&pr](size_t i, size_t l) {
+            return (pr[i] - pr[l]) * (pr[i] + pr[l]);
+        };
+
+        // Singular values
+        int info = 0;
+        arena_vector<size_t> K(Nr);
+        arena_vector<real_t> mu(Nr), sigma(Nr);
+        for (idx_t r = 0; r < Nr; ++r) {
+            if (!secular_root(zr, delta, r, K[r], mu[r])) info = 1;
+            sigma[r] = sqrt(pr[K[r]] * pr[K[r]] + mu[r]);
+        }
+
+        // p_i^2 - sigma_r^2
+        auto diff = [&](idx_t i, idx_t r) { return delta(i, K[r]) - mu[r]; };
+
+        // Recompute the weights so that the computed singular values are
+        // exact for them (Lowner's formula). This makes the singular vectors
+        // orthogonal
+        for (idx_t i = 0; i < Nr; ++i) {
+            real_t prod = -diff(i, Nr - 1);
+            for (idx_t r = 0; r < i; ++r)
+                prod *= diff(i, r) / delta(i, r);
+            for (idx_t r = i; r + 1 < Nr; ++r)
+                prod *= diff(i, r) / delta(i, r + 1);
+            const real_t zi = sqrt(abs(prod));
+            zr[i] = (zr[i] >= zero) ? zi : -zi;
+        }
+
+        // Singular vectors of the deflated problem
+        arena_vector<real_t> UM_;
+        auto UM = new_matrix(UM_, Nr, Nr);
+        arena_vector<real_t> VM_;
+        auto VM = new_matrix(VM_, Nr, Nr);
+        for (idx_t r = 0; r < Nr; ++r) {
+            real_t unrm(1), vnrm(0);
+            UM(0, r) = -one;
+            for (idx_t i = 0; i < Nr; ++i) {
+                VM(i, r) = zr[i] / diff(i, r);
+                vnrm += VM(i, r) * VM(i, r);
+                if (i > 0) {
+                    UM(i, r) = pr[i] * VM(i, r);
+                    unrm += UM(i, r) * UM(i, r);
+                }
+            }
+            unrm = sqrt(unrm);
+            vnrm = sqrt(vnrm);
+            for (idx_t i = 0; i < Nr; ++i) {
+                UM(i, r) /= unrm;
+                VM(i, r) /= vnrm;
+            }
+        }
+
+        // Multiply the singular vectors to the columns of U and V
+        arena_vector<real_t> Ua_;
+        auto Ua = new_matrix(Ua_, nn, Nr);
+        arena_vector<real_t> Va_;
+        auto Va = new_matrix(Va_, mV, Nr);
+        for (idx_t r = 0; r < Nr; ++r) {
+            for (idx_t i = 0; i < nn; ++i)
+                Ua(i, r) = Uc(i, active[r]);
+            for (idx_t i = 0; i < mV; ++i)
+                Va(i, r) = Vc(i, active[r]);
+        }
+        arena_vector<real_t> Ur_;
+        auto Ur = new_matrix(Ur_, nn, Nr);
+        arena_vector<real_t> Vr_;
+        auto Vr = new_matrix(Vr_, mV, Nr);
+        gemm(NO_TRANS, NO_TRANS, one, Ua, UM, zero, Ur);
+        gemm(NO_TRANS, NO_TRANS, one, Va, VM, zero, Vr);
+
+        // Sort the singular values of B in decreasing order. Entries with
+        // source < Nr are singular values of the deflated problem, the others
+        // are deflated poles
+        arena_vector<std::pair<real_t, idx_t>> values;
+        values.reserve(N);
+        for (idx_t r = 0; r < Nr; ++r)
+            values.emplace_back(sigma[r], r);
+        for (idx_t i = 1; i < N; ++i)
+            if (deflated[i]) values.emplace_back(p[i], Nr + i);
+        std::sort(values.begin(), values.end(),
+                  [](const auto& a, const auto& b) {
+                      return (a.first > b.first) ||
+                             (a.first == b.first && a.second < b.second);
+                  });
+
+        for (idx_t j = 0; j < N; ++j) {
+            const idx_t src = values[j].second;
+            d[j] = values[j].first * orgnrm;
+            if (src < Nr) {
+                for (idx_t i = 0; i < nn; ++i)
+                    U(i, j) = Ur(i, src);
+                for (idx_t i = 0; i < mV; ++i)
+                    V(i, j) = Vr(i, src);
+            }
+            else {
+                for (idx_t i = 0; i < nn; ++i)
+                    U(i, j) = Uc(i, src - Nr);
+                for (idx_t i = 0; i < mV; ++i)
+                    V(i, j) = Vc(i, src - Nr);
+            }
+        }
+        if (sqre == 1) {
+            for (idx_t i = 0; i < mV; ++i)
+                V(i, nn) = null(i, 0);
+        }
+
+        return info;
+    }
+
+    /**
+     * Computes the SVD B = U diag(d) V^T of the nn-by-(nn+sqre) upper
+     * bidiagonal matrix B with diagonal d and off-diagonal e.
+     *
+     * The matrix is split in two halves that are solved recursively, and
+     * their SVDs are merged by svd_dc_merge(). Subproblems of size at most nx
+     * are solved by svd_qr().
+     *
+     * @param[in,out] d Vector of length nn. On exit, the singular values in
+     *      decreasing order.
+     * @param[in,out] e Vector of length nn-1+sqre. Destroyed on exit.
+     * @param[in] sqre 0 if B is square, 1 if B has one more column than rows.
+     * @param[out] U nn-by-nn matrix of left singular vectors. On entry, it
+     *      must be zero.
+     * @param[out] V (nn+sqre)-by-(nn+sqre) matrix of right singular vectors.
+     *      If sqre = 1, the last column is a null vector of B. On entry, it
+     *      must be zero.
+     * @param[in] nx Size of the subproblems solved by svd_qr().
+     */
+    template <class d_t, class e_t, class U_t, class V_t>
+    int svd_dc_rec(d_t& d,
+                   e_t& e,
+                   size_type<U_t> sqre,
+                   U_t& U,
+                   V_t& V,
+                   size_type<U_t> nx)
+    {
+        using idx_t = size_type<U_t>;
+        using work_t = matrix_type<U_t, V_t>;
+        using real_t = type_t<work_t>;
+        using range = pair<idx_t, idx_t>;
+
+        Create<work_t> new_matrix;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t nn = size(d);
+
+        if (nn <= nx) {
+            if (nn == 0) {
+                if (sqre == 1) V(0, 0) = one;
+                return 0;
+            }
+
+            // Annihilate the last column with rotations from the right
+            arena_vector<real_t> G_;
+            auto G = new_matrix(G_, nn + sqre, nn + sqre);
+            laset(GENERAL, zero, one, G);
+            if (sqre == 1) {
+                real_t f = e[nn - 1];
+                for (idx_t i = nn; i-- > 0;) {
+                    real_t c, s, r;
+                    lartg(d[i], f, c, s, r);
+                    d[i] = r;
+                    if (i > 0) {
+                        f = -s * e[i - 1];
+                        e[i - 1] = c * e[i - 1];
+                    }
+                    auto gi = col(G, i);
+                    auto gn = col(G, nn);
+                    rot(gi, gn, c, s);
+                }
+            }
+
+            arena_vector<real_t> Ul_;
+            auto Ul = new_matrix(Ul_, nn, nn);
+            arena_vector<real_t> Vtl_;
+            auto Vtl = new_matrix(Vtl_, nn, nn);
+            laset(GENERAL, zero, one, Ul);
+            laset(GENERAL, zero, one, Vtl);
+            auto el = slice(e, range{0, nn - 1});
+            int info = svd_qr(Uplo::Upper, true, true, d, el, Ul, Vtl);
+            if (info != 0) return info;
+
+            lacpy(GENERAL, Ul, U);
+            auto G0 = cols(G, range{0, nn});
+            auto V0 = cols(V, range{0, nn});
+            gemm(NO_TRANS, TRANSPOSE, one, G0, Vtl, zero, V0);
+            if (sqre == 1) {
+                for (idx_t i = 0; i <= nn; ++i)
+                    V(i, nn) = G(i, nn);
+            }
+            return 0;
+        }
+
+        const idx_t k = nn / 2;
+        const real_t alpha = d[k];
+        const real_t beta = e[k];
+
+        // Left subproblem: k-by-(k+1)
+        auto d1 = slice(d, range{0, k});
+        auto e1 = slice(e, range{0, k});
+        auto U1 = slice(U, range{0, k}, range{0, k});
+        auto V1 = slice(V, range{0, k + 1}, range{0, k + 1});
+        int info = svd_dc_rec(d1, e1, idx_t(1), U1, V1, nx);
+        if (info != 0) return info;
+
+        // Right subproblem: (nn-k-1)-by-(nn-k-1+sqre)
+        auto d2 = slice(d, range{k + 1, nn});
+        auto e2 = slice(e, range{k + 1, nn - 1 + sqre});
+        auto U2 = slice(U, range{k + 1, nn}, range{k + 1, nn});
+        auto V2 = slice(V, range{k + 1, nn + sqre}, range{k + 1, nn + sqre});
+        info = svd_dc_rec(d2, e2, sqre, U2, V2, nx);
+        if (info != 0) return info;
+
+        return svd_dc_merge(k, alpha, beta, sqre, d, U, V);
+    }
+
+}  // namespace internal
+
+/**
+ * Computes the singular values and, optionally, the right and/or
+ * left singular vectors from the singular value decomposition (SVD) of
+ * a real N-by-N (upper or lower) bidiagonal matrix B using a
+ * divide-and-conquer algorithm. The SVD of B has the form
+ *      B = Q * S * P**T
+ * where S is the diagonal matrix of singular values, Q is an orthogonal
+ * matrix of left singular vectors, and P is an orthogonal matrix of
+ * right singular vectors.  If left singular vectors are requested, this
+ * subroutine actually returns U*Q instead of Q, and, if right singular
+ * vectors are requested, this subroutine returns P**T*VT instead of
+ * P**T, for given real input matrices U and VT.
+ *
+ * B is split in two halves by removing one row. The SVDs of the halves are
+ * computed recursively and merged by solving a secular equation, after the
+ * deflation of negligible components. The singular vectors of each merge are
+ * applied with gemm(), so that most of the work is done in level-3 operations.
+ * Subproblems of size at most opts.nx are solved by svd_qr(). If no singular
+ * vectors are requested, svd_qr() is used.
+ *
+ * See "A divide and conquer algorithm for the bidiagonal SVD," by
+ * M. Gu and S. Eisenstat, SIAM J. Matrix Anal. Appl. vol. 16, no. 1,
+ * pp. 79-92, 1995.
+ *
+ * @return  0 if success
+ * @return  1 if the secular equation of a merge did not converge
+ *
+ * @param[in] uplo
+ *      Uplo::Upper, B is upper bidiagonal
+ *      Uplo::Lower, B is lower bidiagonal
+ *
+ * @param[in] want_u bool
+ *
+ * @param[in] want_vt bool
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, diagonal elements of the bidiagonal matrix B.
+ *      On exit, the singular values of B in decreasing order.
+ *
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, off-diagonal elements of the bidiagonal matrix B.
+ *      On exit, e is destroyed.
+ *
+ * @param[in,out] U nu-by-m matrix.
+ *      On entry, an nu-by-n unitary matrix.
+ *      On exit, U is overwritten by U * Q.
+ *
+ * @param[in,out] Vt n-by-nvt matrix.
+ *      On entry, an n-by-nvt unitary matrix.
+ *      On exit, Vt is overwritten by P^H * Vt.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nx: size of the subproblems solved by svd_qr().
+ *
+ * @ingroup computational
+ */
+template <class matrix_t,
+          class d_t,
+          class e_t,
+          enable_if_t<is_same_v<type_t<d_t>, real_type<type_t<d_t>>>, int> = 0,
+          enable_if_t<is_same_v<type_t<e_t>, real_type<type_t<e_t>>>, int> = 0>
+int svd_dc(Uplo uplo,
+           bool want_u,
+           bool want_vt,
+           d_t& d,
+           e_t& e,
+           matrix_t& U,
+           matrix_t& Vt,
+           const SvdDcOpts& opts = {})
+{
+    using idx_t = size_type<matrix_t>;
+    using range = pair<idx_t, idx_t>;
+    using r_matrix_t = real_type<matrix_t>;
+    using real_t = type_t<r_matrix_t>;
+
+    Create<r_matrix_t> new_real_matrix;
+    Create<matrix_t> new_matrix;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const idx_t n = size(d);
+    const idx_t nx = max<idx_t>(opts.nx, 1);
+
+    // check arguments
+    tlapack_check(uplo == Uplo::Lower || uplo == Uplo::Upper);
+
+    // Small problems and problems without singular vectors
+    if (n <= nx || (!want_u && !want_vt))
+        return svd_qr(uplo, want_u, want_vt, d, e, U, Vt);
+
+    // Scale B so that its largest entry is one
+    real_t orgnrm(0);
+    for (idx_t i = 0; i < n; ++i)
+        orgnrm = max(orgnrm, abs(d[i]));
+    for (idx_t i = 0; i + 1 < n; ++i)
+        orgnrm = max(orgnrm, abs(e[i]));
+    if (orgnrm == zero) return 0;
+    for (idx_t i = 0; i < n; ++i)
+        d[i] /= orgnrm;
+    for (idx_t i = 0; i + 1 < n; ++i)
+        e[i] /= orgnrm;
+
+    // SVD of the upper bidiagonal matrix B, or of B^T if B is lower
+    // bidiagonal
+    arena_vector<real_t> UB_;
+    auto UB = new_real_matrix(UB_, n, n);
+    arena_vector<real_t> VB_;
+    auto VB = new_real_matrix(VB_, n, n);
+    laset(GENERAL, zero, zero, UB);
+    laset(GENERAL, zero, zero, VB);
+    auto eB = slice(e, range{0, n - 1});
+    int info = internal::svd_dc_rec(d, eB, idx_t(0), UB, VB, nx);
+
+    for (idx_t i = 0; i < n; ++i)
+        d[i] *= orgnrm;
+    if (info != 0) return info;
+
+    // B = Q S P^T, where Q = UB and P = VB, or the other way round if B is
+    // lower bidiagonal
+    const auto& Q = (uplo == Uplo::Upper) ? UB : VB;
+    const auto& P = (uplo == Uplo::Upper) ? VB : UB;
+
+    if (want_u) {
+        auto U0 = cols(U, range{0, n});
+        arena_vector<type_t<matrix_t>> W_;
+        auto W = new_matrix(W_, nrows(U0), n);
+        lacpy(GENERAL, U0, W);
+        gemm(NO_TRANS, NO_TRANS, one, W, Q, zero, U0);
+    }
+    if (want_vt) {
+        auto Vt0 = rows(Vt, range{0, n});
+        arena_vector<type_t<matrix_t>> W_;
+        auto W = new_matrix(W_, n, ncols(Vt0));
+        lacpy(GENERAL, Vt0, W);
+        gemm(TRANSPOSE, NO_TRANS, one, P, W, zero, Vt0);
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_SVD_DC_HH
@@ -18,11 +18,20 @@
 #include "tlapack/blas/rot.hpp"
 #include "tlapack/blas/swap.hpp"
 #include "tlapack/lapack/gebrd.hpp"
+#include "tlapack/lapack/rot_sequence3.hpp"
 #include "tlapack/lapack/singularvalues22.hpp"
 #include "tlapack/lapack/svd22.hpp"
 
 namespace tlapack {
 
+/**
+ * Options struct for svd_qr()
+ */
+struct SvdQrOpts {
+    size_t nb = 32;  ///< Maximum number of sweeps whose rotations are applied
+                     ///< together to U and Vt
+};
+
 /**
  * Computes the singular values and, optionally, the right and/or
  * left singular vectors from the singular value decomposition (SVD) of
@@ -40,6 +49,10 @@ namespace tlapack {
  *      A = (U*Q) * S * (P**T*VT)
  * is the SVD of A.
  *
+ * The rotations of up to opts.nb consecutive sweeps on the same active block
+ * are stored and applied to U and Vt at once by rot_sequence3(), which
+ * traverses the singular vectors in cache-sized blocks.
+ *
  * See "Computing  Small Singular Values of Bidiagonal Matrices With
  * Guaranteed High Relative Accuracy," by J. Demmel and W. Kahan,
  * LAPACK Working Note #3 (or SIAM J. Sci. Statist. Comput. vol. 11,
@@ -75,6 +88,10 @@ namespace tlapack {
  *      On entry, an n-by-nvt unitary matrix.
  *      On exit, Vt is overwritten by P^H * Vt.
  *
+ * @param[in] opts Options.
+ *      - @c opts.nb: maximum number of sweeps whose rotations are applied
+ *        together to U and Vt.
+ *
  * @ingroup computational
  */
 template <class matrix_t,
@@ -88,12 +105,17 @@ int svd_qr(Uplo uplo,
            d_t& d,
            e_t& e,
            matrix_t& U,
-           matrix_t& Vt)
+           matrix_t& Vt,
+           const SvdQrOpts& opts = {})
 {
     using idx_t = size_type<matrix_t>;
     using range = pair<idx_t, idx_t>;
     using T = type_t<matrix_t>;
     using real_t = real_type<T>;
+    using r_matrix_t = real_type<matrix_t>;
+
+    // Functors
+    Create<r_matrix_t> new_real_matrix;
 
     // constants
     const real_t one(1);
@@ -105,6 +127,10 @@ int svd_qr(Uplo uplo,
         max(real_t(10.0), min(real_t(100.0), pow(eps, real_t(-0.125))));
     const real_t tol = tolmul * eps;
 
+    tlapack_trace("svd_qr", 0,
+                  sizeof(T) * (double(nrows(U)) * ncols(U) +
+                               double(nrows(Vt)) * ncols(Vt)));
+
     // Quick return
     if (n == 0) return 0;
 
@@ -158,12 +184,54 @@ int svd_qr(Uplo uplo,
     // This variable is reevaluated for every new subblock
     bool forwarddirection = true;
 
+    // Rotations of the sweeps that were not yet applied to U and Vt. The
+    // column j holds the rotations of the sweep j on the block bstart:bstop.
+    // The rotation between the rows or columns i and i+1 is stored in the
+    // row i-bstart
+    const idx_t nb = max<idx_t>(1, (idx_t)opts.nb);
+    arena_vector<real_t> Cu_;
+    auto Cu = new_real_matrix(Cu_, want_u ? n - 1 : 0, nb);
+    arena_vector<real_t> Su_;
+    auto Su = new_real_matrix(Su_, want_u ? n - 1 : 0, nb);
+    arena_vector<real_t> Cvt_;
+    auto Cvt = new_real_matrix(Cvt_, want_vt ? n - 1 : 0, nb);
+    arena_vector<real_t> Svt_;
+    auto Svt = new_real_matrix(Svt_, want_vt ? n - 1 : 0, nb);
+    idx_t nsweeps = 0;
+    idx_t bstart = 0;
+    idx_t bstop = 0;
+    bool bforward = true;
+
+    // Applies the stored rotations to U and Vt. Forward sweeps start with the
+    // rotation on the first pair of rows or columns, which rot_sequence3
+    // calls the backward direction
+    auto flush = [&]() {
+        if (nsweeps == 0) return;
+        const idx_t k = bstop - bstart - 1;
+        const Direction direction =
+            bforward ? Direction::Backward : Direction::Forward;
+        if (want_u) {
+            auto C = slice(Cu, range{0, k}, range{0, nsweeps});
+            auto S = slice(Su, range{0, k}, range{0, nsweeps});
+            auto Ub = slice(U, range{0, nrows(U)}, range{bstart, bstop});
+            rot_sequence3(RIGHT_SIDE, direction, C, S, Ub);
+        }
+        if (want_vt) {
+            auto C = slice(Cvt, range{0, k}, range{0, nsweeps});
+            auto S = slice(Svt, range{0, k}, range{0, nsweeps});
+            auto Vtb = slice(Vt, range{bstart, bstop}, range{0, ncols(Vt)});
+            rot_sequence3(LEFT_SIDE, direction, C, S, Vtb);
+        }
+        nsweeps = 0;
+    };
+
     //
     // Main loop
     //
     for (idx_t iter = 0; iter <= itmax; ++iter) {
         if (iter == itmax) {
             // The QR algorithm failed to converge, return with error.
+            flush();
             return istop;
         }
 
@@ -201,6 +269,7 @@ int svd_qr(Uplo uplo,
             e[istart] = zero;
 
             // Update singular vectors if desired
+            flush();
             if (want_u) {
                 auto u1 = col(U, istart);
                 auto u2 = col(U, istart + 1);
@@ -301,6 +370,16 @@ int svd_qr(Uplo uplo,
             if (sstart > zero and square(shift / sstart) < eps) shift = zero;
         }
 
+        // The rotations of this sweep are stored with the ones of the previous
+        // sweeps if they act on the same block in the same direction
+        if (nsweeps == nb ||
+            (nsweeps > 0 && (istart != bstart || istop != bstop ||
+                             forwarddirection != bforward)))
+            flush();
+        bstart = istart;
+        bstop = istop;
+        bforward = forwarddirection;
+
         if (shift == zero) {
             // If shift = 0, do simplified QR iteration, this is better for the
             // relative accuracy of small singular values
@@ -315,16 +394,14 @@ int svd_qr(Uplo uplo,
                     if (i > istart) e[i - 1] = oldsn * r;
                     lartg(oldcs * r, d[i + 1] * sn, oldcs, oldsn, d[i]);
 
-                    // Update singular vectors if desired
+                    // Store the rotations for the singular vectors
                     if (want_u) {
-                        auto u1 = col(U, i);
-                        auto u2 = col(U, i + 1);
-                        rot(u1, u2, oldcs, oldsn);
+                        Cu(i - istart, nsweeps) = oldcs;
+                        Su(i - istart, nsweeps) = oldsn;
                     }
                     if (want_vt) {
-                        auto vt1 = row(Vt, i);
-                        auto vt2 = row(Vt, i + 1);
-                        rot(vt1, vt2, cs, sn);
+                        Cvt(i - istart, nsweeps) = cs;
+                        Svt(i - istart, nsweeps) = sn;
                     }
                 }
                 real_t h = d[istop - 1] * cs;
@@ -342,16 +419,14 @@ int svd_qr(Uplo uplo,
                     if (i < istop - 1) e[i] = oldsn * r;
                     lartg(oldcs * r, d[i - 1] * sn, oldcs, oldsn, d[i]);
 
-                    // Update singular vectors if desired
+                    // Store the rotations for the singular vectors
                     if (want_u) {
-                        auto u1 = col(U, i - 1);
-                        auto u2 = col(U, i);
-                        rot(u1, u2, cs, -sn);
+                        Cu(i - 1 - istart, nsweeps) = cs;
+                        Su(i - 1 - istart, nsweeps) = -sn;
                     }
                     if (want_vt) {
-                        auto vt1 = row(Vt, i - 1);
-                        auto vt2 = row(Vt, i);
-                        rot(vt1, vt2, oldcs, -oldsn);
+                        Cvt(i - 1 - istart, nsweeps) = oldcs;
+                        Svt(i - 1 - istart, nsweeps) = -oldsn;
                     }
                 }
                 real_t h = d[istart] * cs;
@@ -384,16 +459,14 @@ int svd_qr(Uplo uplo,
                         e[i + 1] = csl * e[i + 1];
                     }
 
-                    // Update singular vectors if desired
+                    // Store the rotations for the singular vectors
                     if (want_u) {
-                        auto u1 = col(U, i);
-                        auto u2 = col(U, i + 1);
-                        rot(u1, u2, csl, snl);
+                        Cu(i - istart, nsweeps) = csl;
+                        Su(i - istart, nsweeps) = snl;
                     }
                     if (want_vt) {
-                        auto vt1 = row(Vt, i);
-                        auto vt2 = row(Vt, i + 1);
-                        rot(vt1, vt2, csr, snr);
+                        Cvt(i - istart, nsweeps) = csr;
+                        Svt(i - istart, nsweeps) = snr;
                     }
                 }
                 e[istop - 2] = f;
@@ -420,22 +493,22 @@ int svd_qr(Uplo uplo,
                         e[i - 2] = csl * e[i - 2];
                     }
 
-                    // Update singular vectors if desired
+                    // Store the rotations for the singular vectors
                     if (want_u) {
-                        auto u1 = col(U, i - 1);
-                        auto u2 = col(U, i);
-                        rot(u1, u2, csr, -snr);
+                        Cu(i - 1 - istart, nsweeps) = csr;
+                        Su(i - 1 - istart, nsweeps) = -snr;
                     }
                     if (want_vt) {
-                        auto vt1 = row(Vt, i - 1);
-                        auto vt2 = row(Vt, i);
-                        rot(vt1, vt2, csl, -snl);
+                        Cvt(i - 1 - istart, nsweeps) = csl;
+                        Svt(i - 1 - istart, nsweeps) = -snl;
                     }
                 }
                 e[istart] = f;
             }
         }
+        ++nsweeps;
     }
+    flush();
 
     // All singular values converged, so make them positive
     for (idx_t i = 0; i < n; ++i) {
@@ -0,0 +1,142 @@
+/// @file tbtrs.hpp Solves a triangular system with a band matrix and multiple
+/// right-hand sides.
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TBTRS_HH
+#define TLAPACK_TBTRS_HH
+
+#include "tlapack/LegacyBandedMatrix.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+/** Solves a triangular system of the form
+ * \[
+ *      op(A) X = B,
+ * \]
+ * where A is an n-by-n triangular band matrix with kd subdiagonals, if
+ * uplo = Lower, or kd superdiagonals, if uplo = Upper.
+ *
+ * Each column of X is computed in $O(n \cdot kd)$ operations. The columns of
+ * A are traversed once per column of B, along the storage of the band.
+ *
+ * No test for singularity or near-singularity is included in this
+ * routine. Such tests must be performed before calling this routine.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: A is upper triangular with kd = A.ku superdiagonals;
+ *      - Uplo::Lower: A is lower triangular with kd = A.kl subdiagonals.
+ *      The other triangle of the band is not referenced.
+ *
+ * @param[in] trans
+ *      - Op::NoTrans:   Solve $A X = B$;
+ *      - Op::Trans:     Solve $A^T X = B$;
+ *      - Op::ConjTrans: Solve $A^H X = B$.
+ *
+ * @param[in] diag
+ *      - Diag::Unit:    A is assumed to be unit triangular.
+ *      - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] A n-by-n band matrix.
+ *
+ * @param[in,out] B n-by-nrhs matrix.
+ *      On entry, the matrix B.
+ *      On exit, the solution X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup computational
+ */
+template <TLAPACK_UPLO uplo_t,
+          TLAPACK_OP op_t,
+          TLAPACK_DIAG diag_t,
+          typename T,
+          class idx_t,
+          TLAPACK_MATRIX matrixB_t>
+int tbtrs(uplo_t uplo,
+          op_t trans,
+          diag_t diag,
+          const LegacyBandedMatrix<T, idx_t>& A,
+          matrixB_t& B)
+{
+    using TB = type_t<matrixB_t>;
+
+    // Constants
+    const idx_t n = A.n;
+    const idx_t nrhs = ncols(B);
+    const idx_t kd = (uplo == Uplo::Upper) ? A.ku : A.kl;
+    const bool nounit = (diag == Diag::NonUnit);
+
+    // Check arguments
+    tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper);
+    tlapack_check_false(trans != Op::NoTrans && trans != Op::Trans &&
+                        trans != Op::ConjTrans);
+    tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
+    tlapack_check_false(A.m != A.n);
+    tlapack_check_false((idx_t)nrows(B) != n);
+
+    // Quick return
+    if (n <= 0 || nrhs <= 0) return 0;
+
+    // op(A(i,j))
+    auto opA = [&](idx_t i, idx_t j) -> T {
+        return (trans == Op::ConjTrans) ? conj(A(i, j)) : A(i, j);
+    };
+
+    for (idx_t k = 0; k < nrhs; ++k) {
+        if (trans == Op::NoTrans) {
+            if (uplo == Uplo::Upper) {
+                for (idx_t j = n; j-- > 0;) {
+                    if (nounit) B(j, k) /= A(j, j);
+                    const TB bjk = B(j, k);
+                    const idx_t i0 = (j > kd) ? j - kd : 0;
+                    for (idx_t i = i0; i < j; ++i)
+                        B(i, k) -= A(i, j) * bjk;
+                }
+            }
+            else {
+                for (idx_t j = 0; j < n; ++j) {
+                    if (nounit) B(j, k) /= A(j, j);
+                    const TB bjk = B(j, k);
+                    const idx_t i1 = min(n, j + kd + 1);
+                    for (idx_t i = j + 1; i < i1; ++i)
+                        B(i, k) -= A(i, j) * bjk;
+                }
+            }
+        }
+        else {
+            if (uplo == Uplo::Upper) {
+                for (idx_t j = 0; j < n; ++j) {
+                    TB bjk = B(j, k);
+                    const idx_t i0 = (j > kd) ? j - kd : 0;
+                    for (idx_t i = i0; i < j; ++i)
+                        bjk -= opA(i, j) * B(i, k);
+                    if (nounit) bjk /= opA(j, j);
+                    B(j, k) = bjk;
+                }
+            }
+            else {
+                for (idx_t j = n; j-- > 0;) {
+                    TB bjk = B(j, k);
+                    const idx_t i1 = min(n, j + kd + 1);
+                    for (idx_t i = j + 1; i < i1; ++i)
+                        bjk -= opA(i, j) * B(i, k);
+                    if (nounit) bjk /= opA(j, j);
+                    B(j, k) = bjk;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TBTRS_HH
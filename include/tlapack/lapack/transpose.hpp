@@ -1,4 +1,4 @@
-/// @file transpose.hpp Out of place transpose
+/// @file transpose.hpp Out of place and in place transpose
 /// @author Thijs Steel, KU Leuven, Belgium
 //
 // Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
@@ -10,15 +10,183 @@
 #ifndef TLAPACK_TRANSPOSE_HH
 #define TLAPACK_TRANSPOSE_HH
 
+#include "tlapack/base/arena.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
+#include "tlapack/lapack/transpose_kernels.hpp"
 
 namespace tlapack {
 struct TransposeOpts {
     // Optimization parameter. Matrices smaller than nx will not
     // be transposed using recursion. Must be at least 2.s
-    size_t nx = 16;
+    size_t nx = tuned("transpose.nx", 16);
 };
 
+namespace internal {
+
+    /// Sets B = A^T, or B = A^H if conjugate is true. Matrices with the same
+    /// row- or column-major layout go through the vectorized kernels of
+    /// transpose_tiled()
+    template <bool conjugate, class matrixA_t, class matrixB_t>
+    void transpose_base(matrixA_t& A, matrixB_t& B)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using T = type_t<matrixB_t>;
+        constexpr Layout L = layout<matrixB_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        if constexpr ((L == Layout::ColMajor || L == Layout::RowMajor) &&
+                      layout<matrixA_t> == L &&
+                      is_same_v<std::remove_const_t<type_t<matrixA_t>>, T> &&
+                      transpose_tile_size<T> > 0) {
+            auto A_ = legacy_matrix(A);
+            auto B_ = legacy_matrix(B);
+            // The row-major storage of a matrix is the column-major storage of
+            // its transpose
+            const bool done =
+                (L == Layout::ColMajor)
+                    ? transpose_tiled<conjugate>(m, n, A_.ptr, A_.ldim, B_.ptr,
+                                                 B_.ldim)
+                    : transpose_tiled<conjugate>(n, m, A_.ptr, A_.ldim, B_.ptr,
+                                                 B_.ldim);
+            if (done) return;
+        }
+
+        for (idx_t i = 0; i < m; ++i)
+            for (idx_t j = 0; j < n; ++j) {
+                if constexpr (conjugate)
+                    B(j, i) = conj(A(i, j));
+                else
+                    B(j, i) = A(i, j);
+            }
+    }
+
+    /// Swaps A and B^T, or A and B^H if conjugate is true. Recurses on the
+    /// blocks until they are smaller than opts.nx
+    template <bool conjugate, class matrixA_t, class matrixB_t>
+    void swap_transpose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts)
+    {
+        using idx_t = size_type<matrixA_t>;
+        using T = type_t<matrixA_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+
+        if (min(m, n) <= (idx_t)opts.nx) {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i) {
+                    const T aij = A(i, j);
+                    if constexpr (conjugate) {
+                        A(i, j) = conj(B(j, i));
+                        B(j, i) = conj(aij);
+                    }
+                    else {
+                        A(i, j) = B(j, i);
+                        B(j, i) = aij;
+                    }
+                }
+        }
+        else {
+            const idx_t m1 = m / 2;
+            const idx_t n1 = n / 2;
+
+            auto A00 = slice(A, range(0, m1), range(0, n1));
+            auto A01 = slice(A, range(0, m1), range(n1, n));
+            auto A10 = slice(A, range(m1, m), range(0, n1));
+            auto A11 = slice(A, range(m1, m), range(n1, n));
+
+            auto B00 = slice(B, range(0, n1), range(0, m1));
+            auto B01 = slice(B, range(0, n1), range(m1, m));
+            auto B10 = slice(B, range(n1, n), range(0, m1));
+            auto B11 = slice(B, range(n1, n), range(m1, m));
+
+            swap_transpose<conjugate>(A00, B00, opts);
+            swap_transpose<conjugate>(A01, B10, opts);
+            swap_transpose<conjugate>(A10, B01, opts);
+            swap_transpose<conjugate>(A11, B11, opts);
+        }
+    }
+
+    /// Transposes, or conjugate transposes, the square matrix A in place
+    template <bool conjugate, class matrix_t>
+    void transpose_inplace(matrix_t& A, const TransposeOpts& opts)
+    {
+        using idx_t = size_type<matrix_t>;
+        using T = type_t<matrix_t>;
+        using range = pair<idx_t, idx_t>;
+
+        const idx_t n = nrows(A);
+
+        tlapack_check(n == ncols(A));
+        tlapack_check(opts.nx >= 2);
+
+        if (n <= (idx_t)opts.nx) {
+            for (idx_t j = 0; j < n; ++j) {
+                for (idx_t i = 0; i < j; ++i) {
+                    const T aij = A(i, j);
+                    if constexpr (conjugate) {
+                        A(i, j) = conj(A(j, i));
+                        A(j, i) = conj(aij);
+                    }
+                    else {
+                        A(i, j) = A(j, i);
+                        A(j, i) = aij;
+                    }
+                }
+                if constexpr (conjugate) A(j, j) = conj(A(j, j));
+            }
+        }
+        else {
+            // Transpose the diagonal blocks and swap the off-diagonal ones
+            const idx_t n1 = n / 2;
+
+            auto A00 = slice(A, range(0, n1), range(0, n1));
+            auto A01 = slice(A, range(0, n1), range(n1, n));
+            auto A10 = slice(A, range(n1, n), range(0, n1));
+            auto A11 = slice(A, range(n1, n), range(n1, n));
+
+            transpose_inplace<conjugate>(A00, opts);
+            transpose_inplace<conjugate>(A11, opts);
+            swap_transpose<conjugate>(A01, A10, opts);
+        }
+    }
+
+    /// Transposes, or conjugate transposes, the m-by-n matrix stored column
+    /// by column in v
+    template <bool conjugate, class idx_t, class vector_t>
+    void transpose_inplace(idx_t m, idx_t n, vector_t& v)
+    {
+        const idx_t mn = m * n;
+
+        tlapack_check((idx_t)size(v) >= mn);
+
+        if constexpr (conjugate) {
+            for (idx_t k = 0; k < mn; ++k)
+                v[k] = conj(v[k]);
+        }
+        if (m <= 1 || n <= 1) return;
+
+        // The entry at position k = i + j*m moves to position j + i*n, which
+        // is (k*n) mod (mn-1) for 0 < k < mn-1. Follow each cycle of this
+        // permutation once
+        arena_vector<bool> visited(mn, false);
+        for (idx_t start = 1; start < mn - 1; ++start) {
+            if (visited[start]) continue;
+            auto tmp = v[start];
+            idx_t k = start;
+            do {
+                k = (idx_t)(((size_t)k * (size_t)n) % (size_t)(mn - 1));
+                std::swap(tmp, v[k]);
+                visited[k] = true;
+            } while (k != start);
+        }
+    }
+
+}  // namespace internal
+
 /**
  *
  * @brief conjugate transpose a matrix A into a matrix B.
@@ -48,9 +216,7 @@ void conjtranspose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
 
     if (min(m, n) <= (idx_t)opts.nx) {
         // The matrix is small, use direct method and end recursion
-        for (idx_t i = 0; i < m; ++i)
-            for (idx_t j = 0; j < n; ++j)
-                B(j, i) = conj(A(i, j));
+        internal::transpose_base<true>(A, B);
     }
     else {
         // The matrix is large, split into subblocks and use recursion
@@ -103,9 +269,7 @@ void transpose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
 
     if (min(m, n) <= (idx_t)opts.nx) {
         // The matrix is small, use direct method and end recursion
-        for (idx_t i = 0; i < m; ++i)
-            for (idx_t j = 0; j < n; ++j)
-                B(j, i) = A(i, j);
+        internal::transpose_base<false>(A, B);
     }
     else {
         // The matrix is large, split into subblocks and use recursion
@@ -129,6 +293,90 @@ void transpose(matrixA_t& A, matrixB_t& B, const TransposeOpts& opts = {})
     }
 }
 
+/**
+ *
+ * @brief conjugate transpose a square matrix A in place.
+ *
+ * The diagonal blocks are transposed recursively, and the off-diagonal blocks
+ * are swapped across the diagonal, so that the working set fits in cache at
+ * some level of the recursion.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On exit, A is overwritten by A**H
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+void conjtranspose_inplace(matrix_t& A, const TransposeOpts& opts = {})
+{
+    internal::transpose_inplace<true>(A, opts);
+}
+
+/**
+ *
+ * @brief transpose a square matrix A in place.
+ *
+ * The diagonal blocks are transposed recursively, and the off-diagonal blocks
+ * are swapped across the diagonal, so that the working set fits in cache at
+ * some level of the recursion.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On exit, A is overwritten by A**T
+ *
+ * @param[in] opts Options.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_SMATRIX matrix_t>
+void transpose_inplace(matrix_t& A, const TransposeOpts& opts = {})
+{
+    internal::transpose_inplace<false>(A, opts);
+}
+
+/**
+ *
+ * @brief conjugate transpose in place an m-by-n matrix A stored contiguously.
+ *
+ * On entry, v[i + j*m] = A(i,j). On exit, v[j + i*n] = conj(A(i,j)). This
+ * converts a matrix between column-major and row-major storage without a copy.
+ * The entries are moved by following the cycles of the permutation; the
+ * visited entries are marked in a vector of mn bits.
+ *
+ * @param[in] m Number of rows of A.
+ * @param[in] n Number of columns of A.
+ * @param[in,out] v Vector of size at least m*n.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_INDEX idx_t, TLAPACK_VECTOR vector_t>
+void conjtranspose_inplace(idx_t m, idx_t n, vector_t& v)
+{
+    internal::transpose_inplace<true>(m, n, v);
+}
+
+/**
+ *
+ * @brief transpose in place an m-by-n matrix A stored contiguously.
+ *
+ * On entry, v[i + j*m] = A(i,j). On exit, v[j + i*n] = A(i,j). This converts a
+ * matrix between column-major and row-major storage without a copy. The
+ * entries are moved by following the cycles of the permutation; the visited
+ * entries are marked in a vector of mn bits.
+ *
+ * @param[in] m Number of rows of A.
+ * @param[in] n Number of columns of A.
+ * @param[in,out] v Vector of size at least m*n.
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_INDEX idx_t, TLAPACK_VECTOR vector_t>
+void transpose_inplace(idx_t m, idx_t n, vector_t& v)
+{
+    internal::transpose_inplace<false>(m, n, v);
+}
+
 }  // namespace tlapack
 
 #endif  // TLAPACK_TRANSPOSE_HH
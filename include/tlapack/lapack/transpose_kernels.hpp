@@ -0,0 +1,290 @@
+/// @file transpose_kernels.hpp Vectorized kernels for the base case of
+/// transpose() and conjtranspose().
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef TLAPACK_TRANSPOSE_KERNELS_HH
+#define TLAPACK_TRANSPOSE_KERNELS_HH
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+#include "tlapack/base/simd.hpp"
+#include "tlapack/base/utils.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+    /// Order of the square tiles transposed in registers, or 0 if there is no
+    /// vectorized kernel for T
+    template <class T>
+    constexpr int transpose_tile_size = 0;
+
+#if defined(TLAPACK_SIMD_X86)
+
+    template <>
+    constexpr int transpose_tile_size<float> = 8;
+    template <>
+    constexpr int transpose_tile_size<double> = 4;
+    template <>
+    constexpr int transpose_tile_size<std::complex<float>> = 4;
+    template <>
+    constexpr int transpose_tile_size<std::complex<double>> = 2;
+
+    // -------------------------------------------------------------------------
+    // x86 AVX
+    //
+    // Each kernel reads the columns j = 0, ..., r-1 of an r-by-r tile of A,
+    // with A(i,j) = A[i + j*lda], and writes B(j,i) = A(i,j), with
+    // B(j,i) = B[j + i*ldb]. Complex entries are moved as whole 64-bit or
+    // 128-bit lanes. Conjugation flips the sign bit of the imaginary parts.
+
+    __attribute__((target("avx"))) inline void transpose_tile_avx(
+        const double* A, std::size_t lda, double* B, std::size_t ldb)
+    {
+        const __m256d c0 = _mm256_loadu_pd(A);
+        const __m256d c1 = _mm256_loadu_pd(A + lda);
+        const __m256d c2 = _mm256_loadu_pd(A + 2 * lda);
+        const __m256d c3 = _mm256_loadu_pd(A + 3 * lda);
+
+        const __m256d t0 = _mm256_unpacklo_pd(c0, c1);
+        const __m256d t1 = _mm256_unpackhi_pd(c0, c1);
+        const __m256d t2 = _mm256_unpacklo_pd(c2, c3);
+        const __m256d t3 = _mm256_unpackhi_pd(c2, c3);
+
+        _mm256_storeu_pd(B, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(B + ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(B + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(B + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+
+    __attribute__((target("avx"))) inline void transpose_tile_avx(
+        const float* A, std::size_t lda, float* B, std::size_t ldb)
+    {
+        __m256 c[8], t[8];
+        for (int j = 0; j < 8; ++j)
+            c[j] = _mm256_loadu_ps(A + j * lda);
+
+        for (int j = 0; j < 8; j += 2) {
+            t[j] = _mm256_unpacklo_ps(c[j], c[j + 1]);
+            t[j + 1] = _mm256_unpackhi_ps(c[j], c[j + 1]);
+        }
+        for (int j = 0; j < 8; j += 4) {
+            c[j] = _mm256_shuffle_ps(t[j], t[j + 2], _MM_SHUFFLE(1, 0, 1, 0));
+            c[j + 1] =
+                _mm256_shuffle_ps(t[j], t[j + 2], _MM_SHUFFLE(3, 2, 3, 2));
+            c[j + 2] =
+                _mm256_shuffle_ps(t[j + 1], t[j + 3], _MM_SHUFFLE(1, 0, 1, 0));
+            c[j + 3] =
+                _mm256_shuffle_ps(t[j + 1], t[j + 3], _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        for (int i = 0; i < 4; ++i) {
+            _mm256_storeu_ps(B + i * ldb,
+                             _mm256_permute2f128_ps(c[i], c[i + 4], 0x20));
+            _mm256_storeu_ps(B + (i + 4) * ldb,
+                             _mm256_permute2f128_ps(c[i], c[i + 4], 0x31));
+        }
+    }
+
+    template <bool conjugate>
+    __attribute__((target("avx"))) inline void transpose_tile_avx(
+        const std::complex<float>* A_,
+        std::size_t lda,
+        std::complex<float>* B_,
+        std::size_t ldb)
+    {
+        // Each complex<float> fills one 64-bit lane
+        const double* A = reinterpret_cast<const double*>(A_);
+        double* B = reinterpret_cast<double*>(B_);
+
+        const __m256d c0 = _mm256_loadu_pd(A);
+        const __m256d c1 = _mm256_loadu_pd(A + lda);
+        const __m256d c2 = _mm256_loadu_pd(A + 2 * lda);
+        const __m256d c3 = _mm256_loadu_pd(A + 3 * lda);
+
+        const __m256d t0 = _mm256_unpacklo_pd(c0, c1);
+        const __m256d t1 = _mm256_unpackhi_pd(c0, c1);
+        const __m256d t2 = _mm256_unpacklo_pd(c2, c3);
+        const __m256d t3 = _mm256_unpackhi_pd(c2, c3);
+
+        __m256d r[4] = {_mm256_permute2f128_pd(t0, t2, 0x20),
+                        _mm256_permute2f128_pd(t1, t3, 0x20),
+                        _mm256_permute2f128_pd(t0, t2, 0x31),
+                        _mm256_permute2f128_pd(t1, t3, 0x31)};
+        if constexpr (conjugate) {
+            const __m256d mask =
+                _mm256_castsi256_pd(_mm256_set1_epi64x(INT64_MIN));
+            for (int i = 0; i < 4; ++i)
+                r[i] = _mm256_xor_pd(r[i], mask);
+        }
+        for (int i = 0; i < 4; ++i)
+            _mm256_storeu_pd(B + i * ldb, r[i]);
+    }
+
+    template <bool conjugate>
+    __attribute__((target("avx"))) inline void transpose_tile_avx(
+        const std::complex<double>* A_,
+        std::size_t lda,
+        std::complex<double>* B_,
+        std::size_t ldb)
+    {
+        // Each complex<double> fills one 128-bit lane
+        const double* A = reinterpret_cast<const double*>(A_);
+        double* B = reinterpret_cast<double*>(B_);
+
+        const __m256d c0 = _mm256_loadu_pd(A);
+        const __m256d c1 = _mm256_loadu_pd(A + 2 * lda);
+
+        __m256d r0 = _mm256_permute2f128_pd(c0, c1, 0x20);
+        __m256d r1 = _mm256_permute2f128_pd(c0, c1, 0x31);
+        if constexpr (conjugate) {
+            const __m256d mask = _mm256_set_pd(-0.0, 0.0, -0.0, 0.0);
+            r0 = _mm256_xor_pd(r0, mask);
+            r1 = _mm256_xor_pd(r1, mask);
+        }
+        _mm256_storeu_pd(B, r0);
+        _mm256_storeu_pd(B + 2 * ldb, r1);
+    }
+
+    /// Vectorized transpose of an r-by-r tile, r = transpose_tile_size<T>
+    template <bool conjugate, class T>
+    inline void transpose_tile(const T* A,
+                               std::size_t lda,
+                               T* B,
+                               std::size_t ldb)
+    {
+        if constexpr (is_complex<T>)
+            transpose_tile_avx<conjugate>(A, lda, B, ldb);
+        else
+            transpose_tile_avx(A, lda, B, ldb);
+    }
+
+    /// True if the vectorized kernels can be used on this machine
+    inline bool use_transpose_tiles() noexcept
+    {
+        return simd_isa() == SimdIsa::AVX2 || simd_isa() == SimdIsa::AVX512;
+    }
+
+#elif defined(TLAPACK_SIMD_NEON)
+
+    template <>
+    constexpr int transpose_tile_size<float> = 4;
+    template <>
+    constexpr int transpose_tile_size<double> = 2;
+
+    // -------------------------------------------------------------------------
+    // ARMv8 Advanced SIMD
+
+    inline void transpose_tile_neon(const double* A,
+                                    std::size_t lda,
+                                    double* B,
+                                    std::size_t ldb)
+    {
+        const float64x2_t c0 = vld1q_f64(A);
+        const float64x2_t c1 = vld1q_f64(A + lda);
+        vst1q_f64(B, vzip1q_f64(c0, c1));
+        vst1q_f64(B + ldb, vzip2q_f64(c0, c1));
+    }
+
+    inline void transpose_tile_neon(const float* A,
+                                    std::size_t lda,
+                                    float* B,
+                                    std::size_t ldb)
+    {
+        const float32x4x2_t t01 =
+            vtrnq_f32(vld1q_f32(A), vld1q_f32(A + lda));
+        const float32x4x2_t t23 =
+            vtrnq_f32(vld1q_f32(A + 2 * lda), vld1q_f32(A + 3 * lda));
+        vst1q_f32(B, vcombine_f32(vget_low_f32(t01.val[0]),
+                                  vget_low_f32(t23.val[0])));
+        vst1q_f32(B + ldb, vcombine_f32(vget_low_f32(t01.val[1]),
+                                        vget_low_f32(t23.val[1])));
+        vst1q_f32(B + 2 * ldb, vcombine_f32(vget_high_f32(t01.val[0]),
+                                            vget_high_f32(t23.val[0])));
+        vst1q_f32(B + 3 * ldb, vcombine_f32(vget_high_f32(t01.val[1]),
+                                            vget_high_f32(t23.val[1])));
+    }
+
+    /// Vectorized transpose of an r-by-r tile, r = transpose_tile_size<T>
+    template <bool conjugate, class T>
+    inline void transpose_tile(const T* A,
+                               std::size_t lda,
+                               T* B,
+                               std::size_t ldb)
+    {
+        transpose_tile_neon(A, lda, B, ldb);
+    }
+
+    /// True if the vectorized kernels can be used on this machine
+    inline bool use_transpose_tiles() noexcept { return true; }
+
+#else
+
+    template <bool conjugate, class T>
+    inline void transpose_tile(const T*, std::size_t, T*, std::size_t)
+    {}
+
+    inline bool use_transpose_tiles() noexcept { return false; }
+
+#endif
+
+    /**
+     * @brief Sets B = A^T, or B = A^H if conjugate is true, using the
+     * vectorized tiles.
+     *
+     * A(i,j) = A[i + j*lda] is m-by-n and B(j,i) = B[j + i*ldb] is n-by-m. The
+     * entries that do not fill a tile are moved one by one.
+     *
+     * @return false if there is no vectorized kernel for T on this machine. In
+     * this case, nothing is done.
+     */
+    template <bool conjugate, class T>
+    bool transpose_tiled(std::size_t m,
+                         std::size_t n,
+                         const T* A,
+                         std::size_t lda,
+                         T* B,
+                         std::size_t ldb)
+    {
+        constexpr std::size_t r = transpose_tile_size<T>;
+        if constexpr (r == 0)
+            return false;
+        else {
+            if (!use_transpose_tiles()) return false;
+
+            const std::size_t m0 = m - m % r;
+            const std::size_t n0 = n - n % r;
+            for (std::size_t j = 0; j < n0; j += r)
+                for (std::size_t i = 0; i < m0; i += r)
+                    transpose_tile<conjugate>(A + i + j * lda, lda,
+                                              B + j + i * ldb, ldb);
+
+            auto move = [&](std::size_t i, std::size_t j) {
+                if constexpr (conjugate)
+                    B[j + i * ldb] = conj(A[i + j * lda]);
+                else
+                    B[j + i * ldb] = A[i + j * lda];
+            };
+            for (std::size_t j = 0; j < n0; ++j)
+                for (std::size_t i = m0; i < m; ++i)
+                    move(i, j);
+            for (std::size_t j = n0; j < n; ++j)
+                for (std::size_t i = 0; i < m; ++i)
+                    move(i, j);
+
+            return true;
+        }
+    }
+
+}  // namespace internal
+
+}  // namespace tlapack
+
+#endif  // TLAPACK_TRANSPOSE_KERNELS_HH
@@ -63,6 +63,9 @@ int trtri_recursive(uplo_t uplo,
     tlapack_check_false(diag != Diag::NonUnit && diag != Diag::Unit);
     tlapack_check_false(nrows(C) != ncols(C));
 
+    tlapack_trace("trtri", internal::trace_flops<T>(double(n) * n * n / 3),
+                  sizeof(T) * double(n) * n);
+
     // Quick return
     if (n <= 0) return 0;
 
@@ -117,7 +117,7 @@ int ung2l(matrix_t& A, const vector_t& tau)
 
     // Allocates workspace
     WorkInfo workinfo = ung2l_worksize<T>(A, tau);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ung2l_work(A, tau, work);
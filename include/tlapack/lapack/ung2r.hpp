@@ -109,7 +109,7 @@ int ung2r(matrix_t& A, const vector_t& tau)
 
     // Allocates workspace
     WorkInfo workinfo = ung2r_worksize<T>(A, tau);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ung2r_work(A, tau, work);
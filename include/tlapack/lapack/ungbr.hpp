@@ -12,6 +12,7 @@
 #ifndef TLAPACK_UNGBR_HH
 #define TLAPACK_UNGBR_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/ungq.hpp"
 
@@ -21,7 +22,7 @@ namespace tlapack {
  * Options struct for ungbr
  */
 struct UngbrOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("ungq.nb", 32);  ///< Block size
 };
 
 /** Worspace query of ungbr_q()
@@ -211,7 +212,7 @@ int ungbr_q(const size_type<matrix_t> k,
 
     // Allocates workspace
     WorkInfo workinfo = ungbr_q_worksize<T>(k, A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungbr_q_work(k, A, tau, work, opts);
@@ -321,7 +322,7 @@ int ungbr_p(const size_type<matrix_t> k,
 
     // Allocates workspace
     WorkInfo workinfo = ungbr_p_worksize<T>(k, A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungbr_p_work(k, A, tau, work, opts);
@@ -12,6 +12,7 @@
 #ifndef TLAPACK_UNGLQ_HH
 #define TLAPACK_UNGLQ_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/scal.hpp"
 #include "tlapack/lapack/larf.hpp"
@@ -25,7 +26,7 @@ namespace tlapack {
  * Options struct for unglq
  */
 struct UnglqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("ungq.nb", 32);  ///< Block size
 };
 
 /**
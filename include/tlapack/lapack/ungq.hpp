@@ -13,6 +13,8 @@
 #ifndef TLAPACK_UNGQ_HH
 #define TLAPACK_UNGQ_HH
 
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/larfb.hpp"
 #include "tlapack/lapack/larft.hpp"
@@ -24,9 +26,48 @@ namespace tlapack {
  * Options struct for ungq
  */
 struct UngqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("ungq.nb", 32);  ///< Block size
+    size_t num_threads = 1;      ///< Number of threads used to apply each
+                                 ///< block reflector. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
 };
 
+namespace internal {
+
+    /// Number of parts of the trailing matrix updated concurrently in ungq().
+    /// It is fixed by the largest trailing matrix, so that the workspace fits
+    /// all block reflectors
+    template <class idx_t>
+    idx_t ungq_ntasks(Direction direction,
+                      StoreV storeMode,
+                      idx_t m,
+                      idx_t n,
+                      idx_t k,
+                      idx_t nb,
+                      const UngqOpts& opts)
+    {
+        if (storeMode == StoreV::Columnwise) {
+            if (nb >= n) return 1;
+            const idx_t nC = (direction == Direction::Forward)
+                                 ? n - nb
+                                 : (n - k) + ((k - 1) / nb) * nb;
+            return larfb_parallel_ntasks(Side::Left, m, nC, nb,
+                                         opts.num_threads, opts.pool);
+        }
+        else {
+            if (nb >= m) return 1;
+            const idx_t mC = (direction == Direction::Forward)
+                                 ? m - nb
+                                 : (m - k) + ((k - 1) / nb) * nb;
+            return larfb_parallel_ntasks(Side::Right, mC, n, nb,
+                                         opts.num_threads, opts.pool);
+        }
+    }
+
+}  // namespace internal
+
 /** Worspace query of ungq()
  *
  * @param[in] direction
@@ -71,6 +112,8 @@ constexpr WorkInfo ungq_worksize(direction_t direction,
     const idx_t n = ncols(A);
     const idx_t k = size(tau);
     const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t ntasks = internal::ungq_ntasks(
+        Direction(direction), StoreV(storeMode), m, n, k, nb, opts);
 
     WorkInfo workinfo;
     auto&& V = (storeMode == StoreV::Columnwise)
@@ -88,8 +131,9 @@ constexpr WorkInfo ungq_worksize(direction_t direction,
                                  : range{0, (n - k) + ((k - 1) / nb) * nb});
 
             // Internal workspace queries
-            workinfo = larfb_worksize<T>(LEFT_SIDE, NO_TRANS, direction,
-                                         COLUMNWISE_STORAGE, V, matrixT, C);
+            workinfo = internal::larfb_parallel_worksize<T>(
+                LEFT_SIDE, NO_TRANS, direction, COLUMNWISE_STORAGE, V, matrixT,
+                C, ntasks);
 
             // Local workspace sizes
             if (is_same_v<T, type_t<work_t>>) workinfo += WorkInfo(nb, nb);
@@ -107,8 +151,9 @@ constexpr WorkInfo ungq_worksize(direction_t direction,
                              range{0, n});
 
             // Internal workspace queries
-            workinfo = larfb_worksize<T>(RIGHT_SIDE, CONJ_TRANS, direction,
-                                         ROWWISE_STORAGE, V, matrixT, C);
+            workinfo = internal::larfb_parallel_worksize<T>(
+                RIGHT_SIDE, CONJ_TRANS, direction, ROWWISE_STORAGE, V, matrixT,
+                C, ntasks);
 
             // Local workspace sizes
             if (is_same_v<T, type_t<work_t>>) workinfo += WorkInfo(nb, nb);
@@ -154,6 +199,8 @@ int ungq_work(direction_t direction,
     const idx_t n = ncols(A);
     const idx_t k = size(tau);
     const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t ntasks = internal::ungq_ntasks(
+        Direction(direction), StoreV(storeMode), m, n, k, nb, opts);
 
     // check arguments
     tlapack_check_false(direction != Direction::Backward &&
@@ -161,6 +208,13 @@ int ungq_work(direction_t direction,
     tlapack_check((storeMode == StoreV::Columnwise) ? (m >= n && n >= k)
                                                     : (n >= m && m >= k));
 
+    tlapack_trace("ungq",
+                  internal::trace_flops<T>(
+                      (storeMode == StoreV::Columnwise)
+                          ? internal::flops_ungq(m, n, k)
+                          : internal::flops_ungq(n, m, k)),
+                  2. * sizeof(T) * m * n);
+
     // quick return
     if (m <= 0 || n <= 0) return 0;
 
@@ -188,8 +242,9 @@ int ungq_work(direction_t direction,
                     auto C = slice(A, range{j, m}, range{j + ib, n});
 
                     larft(FORWARD, COLUMNWISE_STORAGE, V, tauj, matrixTj);
-                    larfb_work(LEFT_SIDE, NO_TRANS, FORWARD, COLUMNWISE_STORAGE,
-                               V, matrixTj, C, work1);
+                    internal::larfb_parallel(LEFT_SIDE, NO_TRANS, FORWARD,
+                                             COLUMNWISE_STORAGE, V, matrixTj, C,
+                                             work1, ntasks, opts.pool);
                 }
 
                 // Apply block reflector to A( 0:m, j:j+ib )$ from the left
@@ -223,8 +278,9 @@ int ungq_work(direction_t direction,
                     auto C = slice(A, range{0, sizev}, range{0, jj});
 
                     larft(BACKWARD, COLUMNWISE_STORAGE, V, tauj, matrixTj);
-                    larfb_work(LEFT_SIDE, NO_TRANS, BACKWARD,
-                               COLUMNWISE_STORAGE, V, matrixTj, C, work1);
+                    internal::larfb_parallel(LEFT_SIDE, NO_TRANS, BACKWARD,
+                                             COLUMNWISE_STORAGE, V, matrixTj, C,
+                                             work1, ntasks, opts.pool);
                 }
 
                 // Apply block reflector to A( 0:m, jj:jj+ib )$ from the left
@@ -255,8 +311,9 @@ int ungq_work(direction_t direction,
                     auto C = slice(A, range{i + ib, m}, range{i, n});
 
                     larft(FORWARD, ROWWISE_STORAGE, V, taui, matrixTi);
-                    larfb_work(RIGHT_SIDE, CONJ_TRANS, FORWARD, ROWWISE_STORAGE,
-                               V, matrixTi, C, work1);
+                    internal::larfb_parallel(RIGHT_SIDE, CONJ_TRANS, FORWARD,
+                                             ROWWISE_STORAGE, V, matrixTi, C,
+                                             work1, ntasks, opts.pool);
                 }
 
                 // Apply block reflector to A( i:i+ib, 0:n )$ from the right
@@ -290,8 +347,9 @@ int ungq_work(direction_t direction,
                     auto C = slice(A, range{0, ii}, range{0, sizev});
 
                     larft(BACKWARD, ROWWISE_STORAGE, V, taui, matrixTi);
-                    larfb_work(RIGHT_SIDE, CONJ_TRANS, BACKWARD,
-                               ROWWISE_STORAGE, V, matrixTi, C, work1);
+                    internal::larfb_parallel(RIGHT_SIDE, CONJ_TRANS, BACKWARD,
+                                             ROWWISE_STORAGE, V, matrixTi, C,
+                                             work1, ntasks, opts.pool);
                 }
 
                 // Apply block reflector to A( ii:ii+ib, 0:n )$ from the left
@@ -371,7 +429,7 @@ int ungq(direction_t direction,
 
     // Allocates workspace
     WorkInfo workinfo = ungq_worksize<T>(direction, storeMode, A, tau, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungq_work(direction, storeMode, A, tau, work, opts);
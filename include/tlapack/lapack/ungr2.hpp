@@ -117,7 +117,7 @@ int ungr2(matrix_t& A, const vector_t& tau)
 
     // Allocates workspace
     WorkInfo workinfo = ungr2_worksize<T>(A, tau);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return ungr2_work(A, tau, work);
@@ -12,6 +12,7 @@
 #ifndef TLAPACK_UNGRQ_HH
 #define TLAPACK_UNGRQ_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/blas/scal.hpp"
 #include "tlapack/lapack/larf.hpp"
@@ -25,7 +26,7 @@ namespace tlapack {
  * Options struct for ungrq
  */
 struct UngrqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("ungq.nb", 32);  ///< Block size
 };
 
 /**
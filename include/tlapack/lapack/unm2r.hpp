@@ -145,7 +145,7 @@ int unm2r(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = unm2r_worksize<T>(side, trans, A, tau, C);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_level2_work(side, trans, FORWARD, COLUMNWISE_STORAGE, A, tau, C,
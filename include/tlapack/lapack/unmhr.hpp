@@ -150,7 +150,7 @@ int unmhr(Side side,
 
     // Allocates workspace
     WorkInfo workinfo = unmhr_worksize<T>(side, trans, ilo, ihi, A, tau, C);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmhr_work(side, trans, ilo, ihi, A, tau, C, work);
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_UNMLQ_HH
 #define TLAPACK_UNMLQ_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/unmq.hpp"
 
@@ -20,7 +21,7 @@ namespace tlapack {
  * Options struct for unmlq
  */
 struct UnmlqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("unmq.nb", 32);  ///< Block size
 };
 
 /** Worspace query of unmlq()
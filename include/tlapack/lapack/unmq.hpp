@@ -13,6 +13,8 @@
 #ifndef TLAPACK_UNMQ_HH
 #define TLAPACK_UNMQ_HH
 
+#include "tlapack/base/ThreadPool.hpp"
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/larfb.hpp"
 #include "tlapack/lapack/larft.hpp"
@@ -23,7 +25,17 @@ namespace tlapack {
  * Options struct for unmq
  */
 struct UnmqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("unmq.nb", 32);  ///< Block size
+    /// Number of reflectors applied at a time. If larger than nb, the
+    /// triangular factor of each group of nb2 reflectors is formed from the
+    /// factors of blocks of nb reflectors, see internal::larft_recursive(). If
+    /// 0, use nb
+    size_t nb2 = tuned("unmq.nb2", 0);
+    size_t num_threads = 1;      ///< Number of threads used to apply each
+                                 ///< block reflector. If 0, use all threads
+                                 ///< of the pool
+    ThreadPool* pool = nullptr;  ///< Thread pool. If nullptr, use
+                                 ///< ThreadPool::global()
 };
 
 /** Worspace query of unmq()
@@ -94,7 +106,9 @@ constexpr WorkInfo unmq_worksize(side_t side,
     const idx_t n = ncols(C);
     const idx_t k = size(tau);
     const idx_t nQ = (side == Side::Left) ? m : n;
-    const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t nb = min(max((idx_t)opts.nb, (idx_t)opts.nb2), k);
+    const idx_t ntasks = internal::larfb_parallel_ntasks(
+        Side(side), m, n, nb, opts.num_threads, opts.pool);
 
     // Local workspace sizes
     WorkInfo workinfo =
@@ -106,8 +120,8 @@ constexpr WorkInfo unmq_worksize(side_t side,
     auto&& matrixTi = slice(V, range{0, nb}, range{0, nb});
 
     // larfb:
-    workinfo += larfb_worksize<T>(side, NO_TRANS, direction, storeMode, Vi,
-                                  matrixTi, C);
+    workinfo += internal::larfb_parallel_worksize<T>(
+        side, NO_TRANS, direction, storeMode, Vi, matrixTi, C, ntasks);
 
     return workinfo;
 }
@@ -146,7 +160,9 @@ int unmq_work(side_t side,
     const idx_t n = ncols(C);
     const idx_t k = size(tau);
     const idx_t nQ = (side == Side::Left) ? m : n;
-    const idx_t nb = min((idx_t)opts.nb, k);
+    const idx_t nb = min(max((idx_t)opts.nb, (idx_t)opts.nb2), k);
+    const idx_t ntasks = internal::larfb_parallel_ntasks(
+        Side(side), m, n, nb, opts.num_threads, opts.pool);
 
     // check arguments
     tlapack_check_false(side != Side::Left && side != Side::Right);
@@ -159,6 +175,11 @@ int unmq_work(side_t side,
                       ? ((ncols(V) == k) && (nrows(V) == nQ))
                       : ((nrows(V) == k) && (ncols(V) == nQ)));
 
+    tlapack_trace("unmq",
+                  internal::trace_flops<type_t<matrixC_t>>(
+                      internal::flops_unmq(nQ, (m + n) - nQ, k)),
+                  sizeof(type_t<matrixC_t>) * (2. * m * n + double(nQ) * k));
+
     // quick return
     if (m <= 0 || n <= 0 || k <= 0) return 0;
 
@@ -189,13 +210,15 @@ int unmq_work(side_t side,
             auto matrixTi = slice(matrixT, range{0, ib}, range{0, ib});
 
             // Form the triangular factor of the block reflector
-            larft(direction, COLUMNWISE_STORAGE, Vi, taui, matrixTi);
+            internal::larft_recursive(direction, COLUMNWISE_STORAGE, Vi, taui,
+                                      matrixTi, (idx_t)opts.nb);
 
             // H or H**H is applied to either C[i:m,0:n] or C[0:m,i:n]
             auto Ci = (side == Side::Left) ? slice(C, rangev, range{0, n})
                                            : slice(C, range{0, m}, rangev);
-            larfb_work(side, trans, direction, COLUMNWISE_STORAGE, Vi, matrixTi,
-                       Ci, work1);
+            internal::larfb_parallel(side, trans, direction, COLUMNWISE_STORAGE,
+                                     Vi, matrixTi, Ci, work1, ntasks,
+                                     opts.pool);
         }
     }
     else {
@@ -209,14 +232,16 @@ int unmq_work(side_t side,
             auto matrixTi = slice(matrixT, range{0, ib}, range{0, ib});
 
             // Form the triangular factor of the block reflector
-            larft(direction, ROWWISE_STORAGE, Vi, taui, matrixTi);
+            internal::larft_recursive(direction, ROWWISE_STORAGE, Vi, taui,
+                                      matrixTi, (idx_t)opts.nb);
 
             // H or H**H is applied to either C[i:m,0:n] or C[0:m,i:n]
             auto Ci = (side == Side::Left) ? slice(C, rangev, range{0, n})
                                            : slice(C, range{0, m}, rangev);
-            larfb_work(side,
-                       (trans == Op::NoTrans) ? Op::ConjTrans : Op::NoTrans,
-                       direction, ROWWISE_STORAGE, Vi, matrixTi, Ci, work1);
+            internal::larfb_parallel(
+                side, (trans == Op::NoTrans) ? Op::ConjTrans : Op::NoTrans,
+                direction, ROWWISE_STORAGE, Vi, matrixTi, Ci, work1, ntasks,
+                opts.pool);
         }
     }
 
@@ -306,7 +331,7 @@ int unmq(side_t side,
     // Allocates workspace
     WorkInfo workinfo =
         unmq_worksize<T>(side, trans, direction, storeMode, V, tau, C, opts);
-    std::vector<T> work_;
+    arena_vector<T> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_work(side, trans, direction, storeMode, V, tau, C, work, opts);
@@ -11,6 +11,7 @@
 #ifndef TLAPACK_UNMQL_HH
 #define TLAPACK_UNMQL_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/unmq.hpp"
 
@@ -20,7 +21,7 @@ namespace tlapack {
  * Options struct for unmql
  */
 struct UnmqlOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("unmq.nb", 32);  ///< Block size
 };
 
 /** Applies unitary matrix Q from an QL factorization to a matrix C.
@@ -132,7 +132,7 @@ int unmr2(side_t side,
 
     // Allocates workspace
     WorkInfo workinfo = unmr2_worksize<TA>(side, trans, A, tau, C);
-    std::vector<TA> work_;
+    arena_vector<TA> work_;
     auto work = new_matrix(work_, workinfo.m, workinfo.n);
 
     return unmq_level2_work(side, trans, BACKWARD, ROWWISE_STORAGE, A, tau, C,
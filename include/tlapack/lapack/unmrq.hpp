@@ -11,6 +11,7 @@
 #ifndef TLAPACK_UNMRQ_HH
 #define TLAPACK_UNMRQ_HH
 
+#include "tlapack/base/tuning.hpp"
 #include "tlapack/base/utils.hpp"
 #include "tlapack/lapack/unmq.hpp"
 
@@ -20,7 +21,7 @@ namespace tlapack {
  * Options struct for unmrq
  */
 struct UnmrqOpts {
-    size_t nb = 32;  ///< Block size
+    size_t nb = tuned("unmq.nb", 32);  ///< Block size
 };
 
 /** Worspace query of unmrq()
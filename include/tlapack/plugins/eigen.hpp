@@ -90,6 +90,16 @@ namespace traits {
                                           : Layout::ColMajor);
     };
 
+    /// Sizes known at compile time for Eigen::Dense types. Eigen::Dynamic is
+    /// -1
+    template <class matrix_t>
+    struct static_size_trait<
+        matrix_t,
+        typename std::enable_if<is_eigen_type<matrix_t>, int>::type> {
+        static constexpr int nrows = matrix_t::RowsAtCompileTime;
+        static constexpr int ncols = matrix_t::ColsAtCompileTime;
+    };
+
     template <class matrix_t>
     struct real_type_traits<
         matrix_t,
@@ -127,8 +137,8 @@ namespace traits {
         static constexpr int Options_ =
             (U::IsRowMajor) ? Eigen::RowMajor : Eigen::ColMajor;
 
-        template <typename T>
-        constexpr auto operator()(std::vector<T>& v,
+        template <typename T, class Allocator>
+        constexpr auto operator()(std::vector<T, Allocator>& v,
                                   Eigen::Index m,
                                   Eigen::Index n = 1) const
         {
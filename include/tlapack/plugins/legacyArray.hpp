@@ -81,8 +81,10 @@ namespace traits {
     /// Create LegacyMatrix @see Create
     template <class U, class idx_t, Layout layout>
     struct CreateFunctor<LegacyMatrix<U, idx_t, layout>, int> {
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v, idx_t m, idx_t n) const
+        template <class T, class Allocator>
+        constexpr auto operator()(std::vector<T, Allocator>& v,
+                                  idx_t m,
+                                  idx_t n) const
         {
             assert(m >= 0 && n >= 0);
             v.resize(m * n);  // Allocates space in memory
@@ -105,8 +107,8 @@ namespace traits {
     /// Create LegacyVector @see Create
     template <class U, class idx_t, typename int_t, Direction D>
     struct CreateFunctor<LegacyVector<U, idx_t, int_t, D>, int> {
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v, idx_t n) const
+        template <class T, class Allocator>
+        constexpr auto operator()(std::vector<T, Allocator>& v, idx_t n) const
         {
             assert(n >= 0);
             v.resize(n);  // Allocates space in memory
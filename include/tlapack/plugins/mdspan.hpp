@@ -66,6 +66,20 @@ namespace traits {
         static constexpr Layout value = Layout::Strided;
     };
 
+    /// Static extents of mdspan matrices
+    template <class ET, class Exts, class LP, class AP>
+    struct static_size_trait<std::experimental::mdspan<ET, Exts, LP, AP>,
+                             std::enable_if_t<Exts::rank() == 2, int>> {
+        static constexpr int nrows =
+            (Exts::static_extent(0) == std::experimental::dynamic_extent)
+                ? -1
+                : (int)Exts::static_extent(0);
+        static constexpr int ncols =
+            (Exts::static_extent(1) == std::experimental::dynamic_extent)
+                ? -1
+                : (int)Exts::static_extent(1);
+    };
+
     template <class ET, class Exts, class LP, class AP>
     struct real_type_traits<std::experimental::mdspan<ET, Exts, LP, AP>, int> {
         using type = std::experimental::mdspan<real_type<ET>, Exts, LP, AP>;
@@ -85,8 +99,8 @@ namespace traits {
             typename std::experimental::mdspan<ET, Exts, LP>::size_type;
         using extents_t = std::experimental::dextents<idx_t, 1>;
 
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v, idx_t n) const
+        template <class T, class Allocator>
+        constexpr auto operator()(std::vector<T, Allocator>& v, idx_t n) const
         {
             assert(n >= 0);
             v.resize(n);  // Allocates space in memory
@@ -120,8 +134,10 @@ namespace traits {
             typename std::experimental::mdspan<ET, Exts, LP>::size_type;
         using extents_t = std::experimental::dextents<idx_t, 2>;
 
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v, idx_t m, idx_t n) const
+        template <class T, class Allocator>
+        constexpr auto operator()(std::vector<T, Allocator>& v,
+                                  idx_t m,
+                                  idx_t n) const
         {
             assert(m >= 0 && n >= 0);
             v.resize(m * n);  // Allocates space in memory
@@ -262,8 +262,8 @@ namespace traits {
     /// Create starpu::Matrix<T> @see Create
     template <class U>
     struct CreateFunctor<starpu::Matrix<U>, int> {
-        template <class T>
-        constexpr auto operator()(std::vector<T>& v,
+        template <class T, class Allocator>
+        constexpr auto operator()(std::vector<T, Allocator>& v,
                                   starpu::idx_t m,
                                   starpu::idx_t n = 1) const
         {
@@ -45,6 +45,9 @@ namespace traits {
         template <typename T, typename A>
         struct is_std_vector<std::vector<T, A>> : std::true_type {};
 
+        template <typename T>
+        struct is_std_vector<arena_vector<T>> : std::true_type {};
+
         template <typename T>
         struct is_std_vector<std::span<T>> : std::true_type {};
     }  // namespace internal
@@ -345,6 +345,41 @@ real_type<type_t<matrix_t>> check_generalized_similarity_transform(matrix_t& A,
     return check_similarity_transform(A, Q, Z, B, res, work);
 }
 
+/** Calculates the scaled backward error of the solution X of A X = B
+ *
+ * @return ||B - A*X||_max / (||A||_inf ||X||_max sqrt(n) eps)
+ *
+ * @param[in] A n by n matrix
+ * @param[in] B n by nrhs matrix
+ * @param[in] X n by nrhs matrix
+ *
+ * @ingroup auxiliary
+ */
+template <TLAPACK_MATRIX matrixA_t,
+          TLAPACK_MATRIX matrixB_t,
+          TLAPACK_MATRIX matrixX_t>
+real_type<type_t<matrixA_t>> backward_error(const matrixA_t& A,
+                                            const matrixB_t& B,
+                                            const matrixX_t& X)
+{
+    using T = type_t<matrixA_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrixA_t>;
+
+    // Functor
+    Create<matrixA_t> new_matrix;
+
+    const idx_t n = nrows(A);
+
+    std::vector<T> R_;
+    auto R = new_matrix(R_, n, ncols(B));
+    lacpy(GENERAL, B, R);
+    gemm(NO_TRANS, NO_TRANS, real_t(-1), A, X, real_t(1), R);
+
+    return lange(MAX_NORM, R) / (lange(INF_NORM, A) * lange(MAX_NORM, X) *
+                                 sqrt(real_t(n)) * ulp<real_t>());
+}
+
 //
 // GDB doesn't handle templates well, so we explicitly define some versions of
 // the functions for common template arguments
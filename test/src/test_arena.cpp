@@ -0,0 +1,227 @@
+/// @file test_arena.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the arena allocator and the workspaces created inside an
+/// ArenaScope
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/base/arena.hpp>
+#include <tlapack/blas/axpy.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/gesvd.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/potrf.hpp>
+
+#include <atomic>
+#include <cstdlib>
+
+using namespace tlapack;
+
+// Counts the calls to the global operator new
+static std::atomic<size_t> n_heap_allocations{0};
+
+void* operator new(std::size_t nbytes)
+{
+    ++n_heap_allocations;
+    if (void* p = std::malloc(nbytes ? nbytes : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+TEST_CASE("Arena reuses the memory of released allocations", "[arena]")
+{
+    Arena arena;
+
+    const Arena::Mark m0 = arena.mark();
+    void* p = arena.allocate(100);
+    CHECK((size_t)p % Arena::alignment == 0);
+    CHECK(arena.used() >= 100);
+
+    // The most recent allocation is given back
+    arena.deallocate(p, 100);
+    CHECK(arena.used() == 0);
+    CHECK(arena.allocate(100) == p);
+
+    // Allocations that do not fit in the first chunk go to a new one
+    arena.allocate(Arena::min_chunk_size);
+    CHECK(arena.capacity() > Arena::min_chunk_size);
+
+    // Releasing everything merges the chunks
+    const size_t capacity = arena.capacity();
+    arena.release(m0);
+    CHECK(arena.used() == 0);
+    CHECK(arena.capacity() == capacity);
+    arena.allocate(Arena::min_chunk_size);
+    arena.allocate(100);
+    CHECK(arena.capacity() == capacity);
+}
+
+TEST_CASE("arena_vector uses the arena only inside an ArenaScope", "[arena]")
+{
+    Arena& arena = thread_arena();
+    CHECK(!arena.active());
+
+    arena_vector<double> outside(10);
+    const size_t used = arena.used();
+    {
+        ArenaScope scope;
+        CHECK(arena.active());
+
+        arena_vector<double> v(100);
+        CHECK(arena.used() > used);
+
+        {
+            ArenaScope inner;
+            arena_vector<float> w(50);
+        }
+        CHECK(arena.active());
+
+        // Memory allocated outside the scope can be freed inside it
+        outside = arena_vector<double>();
+    }
+    CHECK(!arena.active());
+    CHECK(arena.used() == used);
+}
+
+TEST_CASE("arena_vector can be sliced like a std::vector", "[arena]")
+{
+    using range = pair<size_t, size_t>;
+
+    arena_vector<double> x(10, 1.0);
+    arena_vector<double> y(10, 2.0);
+    CHECK(size(x) == 10);
+
+    auto xs = slice(x, range{2, 5});
+    auto ys = slice(y, range{2, 5});
+    axpy(2.0, xs, ys);
+    CHECK(size(ys) == 3);
+    CHECK(y[1] == 2.0);
+    CHECK(y[3] == 4.0);
+    CHECK(y[5] == 2.0);
+}
+
+TEST_CASE("AlignedAllocator aligns its allocations", "[arena]")
+{
+    std::vector<double, AlignedAllocator<double>> v(10);
+    CHECK((size_t)v.data() % 64 == 0);
+
+    std::vector<float, AlignedAllocator<float, 256>> w(3);
+    CHECK((size_t)w.data() % 256 == 0);
+}
+
+// Matrix type whose Create functor only accepts std::vector<double>
+struct StdVectorOnly {};
+
+namespace tlapack {
+namespace traits {
+    template <>
+    struct CreateFunctor<StdVectorOnly, int> {
+        auto operator()(std::vector<double>& v, size_t m, size_t n) const
+        {
+            v.resize(m * n);
+            return LegacyMatrix<double>(m, n, v.data(), m);
+        }
+    };
+}  // namespace traits
+}  // namespace tlapack
+
+TEST_CASE("Create keeps the data of arena_vector on the heap if needed",
+          "[arena]")
+{
+    Create<StdVectorOnly> new_matrix;
+
+    arena_vector<double> A_;
+    auto A = new_matrix(A_, 3, 2);
+    CHECK(A_.empty());
+    CHECK(A_.heap.size() == 6);
+    CHECK(A.ptr == A_.heap.data());
+
+    Create<LegacyMatrix<double>> new_legacy;
+
+    arena_vector<double> B_;
+    auto B = new_legacy(B_, 3, 2);
+    CHECK(B_.size() == 6);
+    CHECK(B_.heap.empty());
+    CHECK(B.ptr == B_.data());
+}
+
+TEMPLATE_TEST_CASE("Routines do not allocate inside a warm ArenaScope",
+                   "[arena]",
+                   (LegacyMatrix<float>),
+                   (LegacyMatrix<double>),
+                   (LegacyMatrix<std::complex<double>>))
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t m = GENERATE(20, 80);
+    const idx_t n = 30;
+    const idx_t k = min(m, n);
+
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, m, n);
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> U_;
+    auto U = new_matrix(U_, m, k);
+    std::vector<T> Vt_;
+    auto Vt = new_matrix(Vt_, k, n);
+    std::vector<T> H0_;
+    auto H0 = new_matrix(H0_, n, n);
+    std::vector<T> H_;
+    auto H = new_matrix(H_, n, n);
+    std::vector<real_t> s(k);
+    std::vector<T> tau(k);
+    std::vector<idx_t> piv(k);
+
+    MatrixMarket mm;
+    mm.random(A0);
+    herk(LOWER_TRIANGLE, CONJ_TRANS, real_t(1), A0, real_t(0), H0);
+    for (idx_t j = 0; j < n; ++j)
+        H0(j, j) += real_t(n);
+
+    GesvdOpts svdOpts;
+    svdOpts.variant =
+        GENERATE(GesvdVariant::QRIteration, GesvdVariant::DivideConquer);
+
+    auto run = [&]() {
+        lacpy(GENERAL, A0, A);
+        geqrf(A, tau);
+        lacpy(GENERAL, A0, A);
+        getrf(A, piv);
+        lacpy(GENERAL, A0, A);
+        gesvd(true, true, A, s, U, Vt, svdOpts);
+        lacpy(LOWER_TRIANGLE, H0, H);
+        potrf(LOWER_TRIANGLE, H);
+    };
+
+    // Warm up
+    {
+        ArenaScope scope;
+        run();
+    }
+
+    const size_t before = n_heap_allocations;
+    {
+        ArenaScope scope;
+        run();
+    }
+    const size_t after = n_heap_allocations;
+
+    INFO("m = " << m << " variant = " << (char)svdOpts.variant);
+    CHECK(after == before);
+}
@@ -0,0 +1,453 @@
+/// @file test_batched.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the batched routines against the ones for a single matrix
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/gemm_batched.hpp>
+#include <tlapack/blas/trsm.hpp>
+#include <tlapack/blas/trsm_batched.hpp>
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/geqr2_batched.hpp>
+#include <tlapack/lapack/getrf_batched.hpp>
+#include <tlapack/lapack/gtsv_batched.hpp>
+#include <tlapack/lapack/potrf_batched.hpp>
+#include <tlapack/lapack/potrs_batched.hpp>
+#include <tlapack/lapack/ptsv_batched.hpp>
+
+using namespace tlapack;
+
+/// Storage of a batch of m-by-n matrices in one of the supported layouts:
+/// 'i' (interleaved), 's' (strided) or 'a' (array of matrices)
+template <class T>
+struct TestBatch {
+    char layout;
+    size_t m, n, count;
+    std::vector<T> data;
+    std::vector<LegacyMatrix<T>> array;
+    StridedBatch<T> strided;
+
+    TestBatch(char layout, size_t m, size_t n, size_t count)
+        : layout(layout),
+          m(m),
+          n(n),
+          count(count),
+          data(((m + 1) * n + 1) * count),
+          strided((layout == 'i')
+                      ? interleaved_batch(m, n, count, data.data())
+                      : strided_batch(m, n, count, data.data(), m + 1,
+                                      (m + 1) * n + 1))
+    {
+        for (size_t b = 0; b < count; ++b)
+            array.emplace_back(m, n, &strided(b, 0, 0), m + 1);
+    }
+
+    TestBatch(const TestBatch& X) : TestBatch(X.layout, X.m, X.n, X.count)
+    {
+        data = X.data;
+    }
+
+    T& operator()(size_t b, size_t i, size_t j) { return strided(b, i, j); }
+
+    /// Column-major copy of the b-th matrix
+    std::vector<T> copy(size_t b)
+    {
+        std::vector<T> A(m * n);
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < m; ++i)
+                A[i + j * m] = (*this)(b, i, j);
+        return A;
+    }
+
+    /// Calls f with the batch
+    template <class F>
+    void apply(F&& f)
+    {
+        if (layout == 'a')
+            f(array);
+        else
+            f(strided);
+    }
+};
+
+#define TLAPACK_BATCHED_TYPES_TO_TEST \
+    float, double, std::complex<float>, std::complex<double>
+
+TEMPLATE_TEST_CASE("Batched BLAS match the routines for a single matrix",
+                   "[gemm][trsm][batched]",
+                   TLAPACK_BATCHED_TYPES_TO_TEST)
+{
+    using T = TestType;
+    using real_t = real_type<T>;
+
+    MatrixMarket mm;
+    ThreadPool pool(2);
+    BatchOpts opts;
+    opts.nb = 8;
+    opts.num_threads = 3;
+    opts.pool = &pool;
+
+    const size_t count = 37;
+    const char layout = GENERATE('i', 's', 'a');
+    const size_t m = GENERATE(1, 7);
+    const size_t n = GENERATE(5, 12);
+    const real_t tol = real_t(4 * (m + n)) * ulp<real_t>();
+
+    DYNAMIC_SECTION("layout = " << layout << " m = " << m << " n = " << n)
+    {
+        SECTION("gemm")
+        {
+            const size_t k = 6;
+            const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+            const Op transB = GENERATE(Op::NoTrans, Op::ConjTrans);
+            const T alpha = rand_helper<T>(mm.gen);
+            const T beta = rand_helper<T>(mm.gen);
+
+            TestBatch<T> A(layout, (transA == Op::NoTrans) ? m : k,
+                           (transA == Op::NoTrans) ? k : m, count);
+            TestBatch<T> B(layout, (transB == Op::NoTrans) ? k : n,
+                           (transB == Op::NoTrans) ? n : k, count);
+            TestBatch<T> C(layout, m, n, count);
+            for (auto& x : A.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : B.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : C.data)
+                x = rand_helper<T>(mm.gen);
+
+            // Reference results
+            std::vector<std::vector<T>> ref(count);
+            for (size_t b = 0; b < count; ++b) {
+                auto A_ = A.copy(b);
+                auto B_ = B.copy(b);
+                ref[b] = C.copy(b);
+                LegacyMatrix<T> Ab(A.m, A.n, A_.data(), A.m);
+                LegacyMatrix<T> Bb(B.m, B.n, B_.data(), B.m);
+                LegacyMatrix<T> Cb(m, n, ref[b].data(), m);
+                gemm(transA, transB, alpha, Ab, Bb, beta, Cb);
+            }
+
+            A.apply([&](auto& A_) {
+                B.apply([&](auto& B_) {
+                    C.apply([&](auto& C_) {
+                        gemm_batched(transA, transB, alpha, A_, B_, beta, C_,
+                                     opts);
+                    });
+                });
+            });
+
+            for (size_t b = 0; b < count; ++b)
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < m; ++i) {
+                        const T& r = ref[b][i + j * m];
+                        CHECK(abs1(C(b, i, j) - r) <=
+                              tol * real_t(k) * max(real_t(1), abs1(r)));
+                    }
+        }
+
+        SECTION("trsm")
+        {
+            const Side side = GENERATE(Side::Left, Side::Right);
+            const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+            const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+            const Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+            const T alpha = rand_helper<T>(mm.gen);
+            const size_t k = (side == Side::Left) ? m : n;
+
+            TestBatch<T> A(layout, k, k, count);
+            TestBatch<T> B(layout, m, n, count);
+            for (auto& x : A.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : B.data)
+                x = rand_helper<T>(mm.gen);
+            for (size_t b = 0; b < count; ++b)
+                for (size_t i = 0; i < k; ++i)
+                    A(b, i, i) += real_t(k);
+
+            std::vector<std::vector<T>> ref(count);
+            for (size_t b = 0; b < count; ++b) {
+                auto A_ = A.copy(b);
+                ref[b] = B.copy(b);
+                LegacyMatrix<T> Ab(k, k, A_.data(), k);
+                LegacyMatrix<T> Bb(m, n, ref[b].data(), m);
+                trsm(side, uplo, trans, diag, alpha, Ab, Bb);
+            }
+
+            A.apply([&](auto& A_) {
+                B.apply([&](auto& B_) {
+                    trsm_batched(side, uplo, trans, diag, alpha, A_, B_, opts);
+                });
+            });
+
+            for (size_t b = 0; b < count; ++b)
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < m; ++i) {
+                        const T& r = ref[b][i + j * m];
+                        CHECK(abs1(B(b, i, j) - r) <=
+                              tol * max(real_t(1), abs1(r)));
+                    }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Batched factorizations are accurate",
+                   "[getrf][potrf][potrs][geqr2][ptsv][gtsv][batched]",
+                   TLAPACK_BATCHED_TYPES_TO_TEST)
+{
+    using T = TestType;
+    using real_t = real_type<T>;
+
+    MatrixMarket mm;
+    ThreadPool pool(2);
+    BatchOpts opts;
+    opts.nb = 8;
+    opts.num_threads = 3;
+    opts.pool = &pool;
+
+    const size_t count = 37;
+    const char layout = GENERATE('i', 's', 'a');
+    const size_t n = GENERATE(1, 8, 13);
+    const real_t tol = real_t(8 * n) * ulp<real_t>();
+
+    DYNAMIC_SECTION("layout = " << layout << " n = " << n)
+    {
+        SECTION("getrf")
+        {
+            const size_t m = GENERATE(5, 13);
+            const size_t k = min(m, n);
+            TestBatch<T> A(layout, m, n, count);
+            for (auto& x : A.data)
+                x = rand_helper<T>(mm.gen);
+            TestBatch<T> LU = A;
+
+            // Matrix 3 has a zero column
+            for (size_t i = 0; i < m; ++i)
+                LU(3, i, 0) = T(0);
+
+            std::vector<std::vector<size_t>> piv_(count,
+                                                  std::vector<size_t>(k));
+            std::vector<size_t> pivi_(k * count);
+            auto pivi = interleaved_batch(k, size_t(1), count, pivi_.data());
+            std::vector<int> info(count);
+
+            int nfailed = 0;
+            LU.apply([&](auto& LU_) {
+                if (layout == 'i')
+                    nfailed = getrf_batched(LU_, pivi, info, opts);
+                else
+                    nfailed = getrf_batched(LU_, piv_, info, opts);
+            });
+
+            CHECK(nfailed == 1);
+            for (size_t b = 0; b < count; ++b) {
+                CHECK(info[b] == ((b == 3) ? 1 : 0));
+                if (b == 3) continue;
+
+                // Compute P A - L U
+                for (size_t r = 0; r < k; ++r) {
+                    const size_t p =
+                        (layout == 'i') ? pivi(b, r, 0) : piv_[b][r];
+                    for (size_t j = 0; j < n; ++j)
+                        std::swap(A(b, r, j), A(b, p, j));
+                }
+                real_t err(0), normA(0);
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < m; ++i) {
+                        T lu(0);
+                        for (size_t l = 0; l <= min(i, j) && l < k; ++l)
+                            lu += ((l == i) ? T(1) : LU(b, i, l)) * LU(b, l, j);
+                        err = max(err, abs1(A(b, i, j) - lu));
+                        normA = max(normA, abs1(A(b, i, j)));
+                    }
+                CHECK(err <= tol * normA);
+            }
+        }
+
+        SECTION("potrf and potrs")
+        {
+            const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+            const size_t nrhs = 3;
+            TestBatch<T> A(layout, n, n, count);
+            TestBatch<T> B(layout, n, nrhs, count);
+            for (auto& x : A.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : B.data)
+                x = rand_helper<T>(mm.gen);
+
+            // Hermitian positive definite matrices, except for the matrix 5
+            for (size_t b = 0; b < count; ++b)
+                for (size_t j = 0; j < n; ++j) {
+                    for (size_t i = 0; i < j; ++i)
+                        A(b, j, i) = conj(A(b, i, j));
+                    A(b, j, j) =
+                        (b == 5 && j == n - 1) ? real_t(-1) : real_t(2 * n);
+                }
+
+            TestBatch<T> L = A;
+            TestBatch<T> X = B;
+
+            std::vector<int> info(count);
+            int nfailed = 0;
+            L.apply([&](auto& L_) {
+                nfailed = potrf_batched(uplo, L_, info, opts);
+                X.apply([&](auto& X_) { potrs_batched(uplo, L_, X_, opts); });
+            });
+
+            CHECK(nfailed == 1);
+            for (size_t b = 0; b < count; ++b) {
+                CHECK(info[b] == ((b == 5) ? int(n) : 0));
+                if (b == 5) continue;
+
+                // Compute A X - B
+                real_t err(0), normB(0);
+                for (size_t j = 0; j < nrhs; ++j)
+                    for (size_t i = 0; i < n; ++i) {
+                        T ax(0);
+                        for (size_t l = 0; l < n; ++l)
+                            ax += A(b, i, l) * X(b, l, j);
+                        err = max(err, abs1(ax - B(b, i, j)));
+                        normB = max(normB, abs1(B(b, i, j)));
+                    }
+                CHECK(err <= tol * normB);
+            }
+        }
+
+        SECTION("geqr2")
+        {
+            const size_t m = GENERATE(5, 13);
+            const size_t k = min(m, n);
+            TestBatch<T> A(layout, m, n, count);
+            TestBatch<T> tau(layout, k, 1, count);
+            for (auto& x : A.data)
+                x = rand_helper<T>(mm.gen);
+
+            std::vector<std::vector<T>> ref(count);
+            std::vector<std::vector<T>> reftau(count, std::vector<T>(k));
+            for (size_t b = 0; b < count; ++b) {
+                ref[b] = A.copy(b);
+                LegacyMatrix<T> Ab(m, n, ref[b].data(), m);
+                geqr2(Ab, reftau[b]);
+            }
+
+            if (layout == 'a') {
+                std::vector<std::vector<T>> tau_(count, std::vector<T>(k));
+                geqr2_batched(A.array, tau_, opts);
+                for (size_t b = 0; b < count; ++b)
+                    for (size_t i = 0; i < k; ++i)
+                        tau(b, i, 0) = tau_[b][i];
+            }
+            else
+                geqr2_batched(A.strided, tau.strided, opts);
+
+            for (size_t b = 0; b < count; ++b) {
+                for (size_t i = 0; i < k; ++i)
+                    CHECK(abs1(tau(b, i, 0) - reftau[b][i]) <= tol);
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = 0; i < m; ++i) {
+                        const T& r = ref[b][i + j * m];
+                        CHECK(abs1(A(b, i, j) - r) <=
+                              tol * max(real_t(1), abs1(r)));
+                    }
+            }
+        }
+
+        SECTION("ptsv and gtsv")
+        {
+            const size_t nrhs = 3;
+            TestBatch<T> DL(layout, n, 1, count);
+            TestBatch<T> D(layout, n, 1, count);
+            TestBatch<T> DU(layout, n, 1, count);
+            TestBatch<T> B(layout, n, nrhs, count);
+            for (auto& x : DL.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : D.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : DU.data)
+                x = rand_helper<T>(mm.gen);
+            for (auto& x : B.data)
+                x = rand_helper<T>(mm.gen);
+
+            // Returns max |A_b X_b - B_b| / (max |A_b| max |X_b|), where A_b
+            // has the diagonals (dl, d, du)
+            auto residual = [&](size_t b, TestBatch<T>& dl, TestBatch<T>& d,
+                                TestBatch<T>& du, TestBatch<T>& X) {
+                real_t err(0), normA(0), normX(0);
+                for (size_t j = 0; j < nrhs; ++j)
+                    for (size_t i = 0; i < n; ++i) {
+                        T ax = d(b, i, 0) * X(b, i, j);
+                        if (i > 0) ax += dl(b, i - 1, 0) * X(b, i - 1, j);
+                        if (i + 1 < n) ax += du(b, i, 0) * X(b, i + 1, j);
+                        err = max(err, abs1(ax - B(b, i, j)));
+                        normX = max(normX, abs1(X(b, i, j)));
+                    }
+                for (size_t i = 0; i < n; ++i)
+                    normA = max(normA, max(abs1(d(b, i, 0)),
+                                           max(abs1(dl(b, i, 0)),
+                                               abs1(du(b, i, 0)))));
+                return err / (normA * normX);
+            };
+
+            // Hermitian positive definite matrices, except for the matrix 5
+            TestBatch<T> E = DL;
+            TestBatch<T> Eh = DL;
+            TestBatch<T> Dp = D;
+            for (size_t b = 0; b < count; ++b)
+                for (size_t i = 0; i < n; ++i) {
+                    Dp(b, i, 0) = (b == 5 && i == n - 1)
+                                      ? real_t(-10)
+                                      : real_t(4) + abs1(D(b, i, 0));
+                    Eh(b, i, 0) = conj(E(b, i, 0));
+                }
+            TestBatch<T> Df = Dp;
+            TestBatch<T> Ef = E;
+            TestBatch<T> X = B;
+
+            std::vector<int> info(count);
+            int nfailed = 0;
+            if (layout == 'a')
+                nfailed =
+                    ptsv_batched(Df.array, Ef.array, X.array, info, opts);
+            else
+                nfailed = ptsv_batched(Df.strided, Ef.strided, X.strided,
+                                       info, opts);
+
+            CHECK(nfailed == 1);
+            for (size_t b = 0; b < count; ++b) {
+                CHECK(info[b] == ((b == 5) ? int(n) : 0));
+                if (b != 5) CHECK(residual(b, E, Dp, Eh, X) <= tol);
+            }
+
+            // General matrices, the matrix 3 is singular
+            for (size_t i = 0; i < n; ++i) {
+                D(3, i, 0) = T(0);
+                DL(3, i, 0) = T(0);
+            }
+            TestBatch<T> DLg = DL;
+            TestBatch<T> Dg = D;
+            TestBatch<T> DUg = DU;
+            TestBatch<T> Y = B;
+
+            if (layout == 'a')
+                nfailed = gtsv_batched(DLg.array, Dg.array, DUg.array,
+                                       Y.array, info, opts);
+            else
+                nfailed = gtsv_batched(DLg.strided, Dg.strided, DUg.strided,
+                                       Y.strided, info, opts);
+
+            CHECK(nfailed == 1);
+            for (size_t b = 0; b < count; ++b) {
+                CHECK(info[b] == ((b == 3) ? 1 : 0));
+                if (b != 3) CHECK(residual(b, DL, D, DU, Y) <= tol);
+            }
+        }
+    }
+}
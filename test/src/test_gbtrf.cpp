@@ -0,0 +1,96 @@
+/// @file test_gbtrf.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the band LU factorization and solver
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/gbtrf.hpp>
+#include <tlapack/lapack/gbtrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gbtrf and gbtrs solve band linear systems",
+                   "[gbtrf][gbtrs]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    using test_tuple_t = std::tuple<idx_t, idx_t, idx_t>;
+    const test_tuple_t sizes =
+        GENERATE((test_tuple_t(1, 0, 0)), (test_tuple_t(10, 2, 3)),
+                 (test_tuple_t(50, 0, 4)), (test_tuple_t(50, 3, 0)),
+                 (test_tuple_t(100, 9, 5)), (test_tuple_t(100, 16, 20)));
+    const idx_t n = std::get<0>(sizes);
+    const idx_t kl = std::get<1>(sizes);
+    const idx_t ku = std::get<2>(sizes);
+    const idx_t nb = GENERATE(1, 4, 8);
+    const idx_t nrhs = GENERATE(1, 5);
+    const real_t tol = real_t(10) * real_t(kl + ku + 1);
+
+    DYNAMIC_SECTION("n = " << n << " kl = " << kl << " ku = " << ku
+                           << " nb = " << nb << " nrhs = " << nrhs)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<idx_t> piv(n);
+
+        // Band matrix A with kl subdiagonals and ku superdiagonals
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if (i > j + kl || j > i + ku) A(i, j) = T(0);
+        mm.random(B);
+
+        // Band storage with kl additional superdiagonals for the fill-in.
+        // The fill-in entries need not be set on entry
+        std::vector<T> AB_((2 * kl + ku + 1) * n, T(7));
+        LegacyBandedMatrix<T, idx_t> AB(n, n, kl, kl + ku, AB_.data());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = (j > ku) ? j - ku : 0; i < min(n, j + kl + 1); ++i)
+                AB(i, j) = A(i, j);
+
+        GbtrfOpts opts;
+        opts.nb = nb;
+        REQUIRE(gbtrf(AB, piv, opts) == 0);
+
+        for (const Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans}) {
+            std::vector<T> opA_;
+            auto opA = new_matrix(opA_, n, n);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    opA(i, j) = (trans == Op::NoTrans) ? A(i, j)
+                                : (trans == Op::Trans) ? A(j, i)
+                                                       : conj(A(j, i));
+
+            lacpy(GENERAL, B, X);
+            REQUIRE(gbtrs(trans, AB, piv, X) == 0);
+            CHECK(backward_error(opA, B, X) <= tol);
+        }
+    }
+}
@@ -0,0 +1,390 @@
+/// @file test_gemm.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the packed and cache-blocked gemm and the routines based on it
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/hemm.hpp>
+#include <tlapack/blas/herk.hpp>
+#include <tlapack/blas/symm.hpp>
+#include <tlapack/blas/syrk.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Blocked gemm gives the same result as the reference loops",
+                   "[gemm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 7, 19);
+    const idx_t n = GENERATE(1, 6, 21);
+    const idx_t k = GENERATE(1, 5, 17);
+    const Op transA = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Op transB = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " k = " << k
+                           << " transA = " << transA << " transB = " << transB)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(4 * k) * eps;
+
+        const T alpha = T(real_t(1.5));
+        const T beta = T(real_t(-0.5));
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = (transA == Op::NoTrans) ? new_matrix(A_, m, k)
+                                         : new_matrix(A_, k, m);
+        std::vector<T> B_;
+        auto B = (transB == Op::NoTrans) ? new_matrix(B_, k, n)
+                                         : new_matrix(B_, n, k);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, n);
+
+        mm.random(A);
+        mm.random(B);
+        mm.random(C);
+        lacpy(GENERAL, C, R);
+
+        // Reference result
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                T sum(0);
+                for (idx_t l = 0; l < k; ++l) {
+                    const T a = (transA == Op::NoTrans) ? A(i, l)
+                                : (transA == Op::Trans) ? A(l, i)
+                                                        : conj(A(l, i));
+                    const T b = (transB == Op::NoTrans) ? B(l, j)
+                                : (transB == Op::Trans) ? B(j, l)
+                                                        : conj(B(j, l));
+                    sum += a * b;
+                }
+                R(i, j) = alpha * sum + beta * R(i, j);
+            }
+
+        // Use small block sizes so that all edge cases are exercised
+        GemmBlockedOpts opts;
+        opts.mc = 6;
+        opts.kc = 4;
+        opts.nc = 9;
+        gemm_blocked(transA, transB, alpha, A, B, beta, C, opts);
+
+        // Check the result
+        const real_t normR = lange(MAX_NORM, R);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                R(i, j) -= C(i, j);
+        CHECK(lange(MAX_NORM, R) <= tol * max(normR, real_t(1)));
+    }
+}
+
+TEMPLATE_TEST_CASE("Rank-k updates restricted to a triangle",
+                   "[gemm][herk][syrk]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(16, 37);
+    const idx_t k = GENERATE(16, 23);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::ConjTrans);
+    const bool hermitian = GENERATE(true, false);
+
+    DYNAMIC_SECTION("n = " << n << " k = " << k << " uplo = " << uplo
+                           << " trans = " << trans
+                           << " hermitian = " << hermitian)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(4 * k) * eps;
+
+        const real_t alpha(1.5);
+        const real_t beta(-0.5);
+
+        // Use Op::Trans in the symmetric case
+        const Op transS = (trans == Op::NoTrans) ? Op::NoTrans : Op::Trans;
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = (trans == Op::NoTrans) ? new_matrix(A_, n, k)
+                                        : new_matrix(A_, k, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, n, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+        std::vector<T> C0_;
+        auto C0 = new_matrix(C0_, n, n);
+
+        mm.random(A);
+        mm.random(C);
+        for (idx_t j = 0; j < n; ++j)
+            C(j, j) = real(C(j, j));
+        lacpy(GENERAL, C, R);
+        lacpy(GENERAL, C, C0);
+
+        // Reference result
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i) {
+                T sum(0);
+                for (idx_t l = 0; l < k; ++l) {
+                    if (hermitian)
+                        sum += (trans == Op::NoTrans)
+                                   ? A(i, l) * conj(A(j, l))
+                                   : conj(A(l, i)) * A(l, j);
+                    else
+                        sum += (trans == Op::NoTrans) ? A(i, l) * A(j, l)
+                                                      : A(l, i) * A(l, j);
+                }
+                R(i, j) = alpha * sum + beta * R(i, j);
+            }
+
+        if (hermitian)
+            herk(uplo, trans, alpha, A, beta, C);
+        else
+            syrk(uplo, transS, alpha, A, beta, C);
+
+        // Check the referenced triangle, and that the other one is untouched
+        real_t err(0), normR(1);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i) {
+                if ((uplo == Uplo::Upper) ? (i <= j) : (i >= j)) {
+                    err = max(err, abs1(R(i, j) - C(i, j)));
+                    normR = max(normR, abs1(R(i, j)));
+                }
+                else
+                    CHECK(C(i, j) == C0(i, j));
+            }
+        CHECK(err <= tol * normR);
+    }
+}
+
+TEMPLATE_TEST_CASE("Vectorized gemm micro-kernels agree with the portable one",
+                   "[gemm]",
+                   float,
+                   double,
+                   std::complex<float>,
+                   std::complex<double>)
+{
+    using T = TestType;
+    using real_t = real_type<T>;
+    using kernel = internal::gemm_kernel_traits<T, T>;
+
+    constexpr int mr = kernel::mr;
+    constexpr int nr = kernel::nr;
+    const std::size_t kb = GENERATE(1, 3, 64);
+
+    // Random panels
+    MatrixMarket mm;
+    std::vector<T> Ap(mr * kb), Bp(nr * kb);
+    for (auto& a : Ap)
+        a = rand_helper<T>(mm.gen);
+    for (auto& b : Bp)
+        b = rand_helper<T>(mm.gen);
+
+    // Portable micro-kernel
+    T ref[mr * nr], acc[mr * nr];
+    internal::gemm_microkernel<mr, nr>(kb, Ap.data(), Bp.data(), ref);
+
+    // Micro-kernel selected for this machine
+    internal::gemm_microkernel_selector<T, T, T, mr, nr>::select()(
+        kb, Ap.data(), Bp.data(), acc);
+
+    const real_t tol = real_t(4 * kb) * ulp<real_t>();
+    for (int ij = 0; ij < mr * nr; ++ij)
+        CHECK(abs1(acc[ij] - ref[ij]) <= tol * max(real_t(1), abs1(ref[ij])));
+
+#if defined(TLAPACK_SIMD_X86)
+    // AVX2 micro-kernel, when available
+    if (simd_isa() == SimdIsa::AVX512) {
+        internal::gemm_microkernel_avx2(kb, Ap.data(), Bp.data(), acc);
+        for (int ij = 0; ij < mr * nr; ++ij)
+            CHECK(abs1(acc[ij] - ref[ij]) <=
+                  tol * max(real_t(1), abs1(ref[ij])));
+    }
+#endif
+}
+
+TEMPLATE_TEST_CASE("Blocked symm and hemm give the correct result",
+                   "[gemm][symm][hemm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 17);
+    const idx_t n = GENERATE(1, 18);
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const bool hermitian = GENERATE(true, false);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " side = " << side
+                           << " uplo = " << uplo
+                           << " hermitian = " << hermitian)
+    {
+        const idx_t k = (side == Side::Left) ? m : n;
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(4 * k) * eps;
+
+        const T alpha = T(real_t(1.5));
+        const T beta = T(real_t(-0.5));
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, k, k);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, n);
+
+        mm.random(A);
+        mm.random(B);
+        mm.random(C);
+        lacpy(GENERAL, C, R);
+
+        // Full matrix A, built from the referenced triangle
+        auto fullA = [&](idx_t i, idx_t j) -> T {
+            if (i == j) return hermitian ? T(real(A(i, i))) : A(i, i);
+            if ((uplo == Uplo::Lower) == (i > j)) return A(i, j);
+            return hermitian ? conj(A(j, i)) : A(j, i);
+        };
+
+        // Reference result
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                T sum(0);
+                for (idx_t l = 0; l < k; ++l)
+                    sum += (side == Side::Left) ? fullA(i, l) * B(l, j)
+                                                : B(i, l) * fullA(l, j);
+                R(i, j) = alpha * sum + beta * R(i, j);
+            }
+
+        // Use small block sizes so that all edge cases are exercised
+        GemmBlockedOpts opts;
+        opts.mc = 6;
+        opts.kc = 4;
+        opts.nc = 9;
+        if (hermitian)
+            hemm_blocked(side, uplo, alpha, A, B, beta, C, opts);
+        else
+            symm_blocked(side, uplo, alpha, A, B, beta, C, opts);
+
+        // Check the result
+        const real_t normR = lange(MAX_NORM, R);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                R(i, j) -= C(i, j);
+        CHECK(lange(MAX_NORM, R) <= tol * max(normR, real_t(1)));
+    }
+}
+
+TEMPLATE_TEST_CASE("Multithreaded level 3 BLAS match the sequential ones",
+                   "[gemm][herk][syrk][symm][hemm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Large enough to be split in tiles
+    const idx_t n = 75;
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const std::string routine = GENERATE("gemm", "herk", "syrk", "symm", "hemm");
+
+    DYNAMIC_SECTION("routine = " << routine << " uplo = " << uplo)
+    {
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(4 * n) * eps;
+
+        const real_t alpha(1.5);
+        const real_t beta(-0.5);
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, n);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, n, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+
+        mm.random(A);
+        mm.random(B);
+        mm.random(C);
+        lacpy(GENERAL, C, R);
+
+        // Pool with fewer workers than requested threads
+        ThreadPool pool(2);
+        GemmBlockedOpts seqOpts, parOpts;
+        parOpts.num_threads = 4;
+        parOpts.pool = &pool;
+
+        auto run = [&](auto& C, const GemmBlockedOpts& opts) {
+            if (routine == "gemm")
+                gemm(Op::NoTrans, Op::ConjTrans, alpha, A, B, beta, C, opts);
+            else if (routine == "herk")
+                herk(uplo, Op::NoTrans, alpha, A, beta, C, opts);
+            else if (routine == "syrk")
+                syrk(uplo, Op::Trans, alpha, A, beta, C, opts);
+            else if (routine == "symm")
+                symm(Side::Left, uplo, alpha, A, B, beta, C, opts);
+            else
+                hemm(Side::Right, uplo, alpha, A, B, beta, C, opts);
+        };
+        run(R, seqOpts);
+        run(C, parOpts);
+
+        // Check the result
+        const real_t normR = lange(MAX_NORM, R);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                R(i, j) -= C(i, j);
+        CHECK(lange(MAX_NORM, R) <= tol * max(normR, real_t(1)));
+    }
+}
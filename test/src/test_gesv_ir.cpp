@@ -0,0 +1,271 @@
+/// @file test_gesv_ir.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the linear system solvers gesv, posv and their mixed-precision
+/// versions with iterative refinement.
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/gesv.hpp>
+#include <tlapack/lapack/gesv_ir.hpp>
+#include <tlapack/lapack/getrs.hpp>
+#include <tlapack/lapack/posv.hpp>
+#include <tlapack/lapack/posv_ir.hpp>
+
+#ifdef TLAPACK_TEST_EIGEN
+    #include <tlapack/plugins/eigen_half.hpp>
+#endif
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gesv and posv solve linear systems",
+                   "[gesv][posv]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 10, 60);
+    const idx_t nrhs = GENERATE(1, 7);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const real_t tol = real_t(10);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs
+                           << " uplo = " << (char)uplo)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> F_;
+        auto F = new_matrix(F_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<idx_t> piv(n);
+
+        mm.random(B);
+
+        // General matrix
+        mm.random(A);
+        lacpy(GENERAL, A, F);
+        lacpy(GENERAL, B, X);
+        REQUIRE(gesv(F, piv, X) == 0);
+        CHECK(backward_error(A, B, X) <= tol);
+
+        // op(A) X = B with the factors of A
+        for (const Op trans : {Op::Trans, Op::ConjTrans}) {
+            std::vector<T> At_;
+            auto At = new_matrix(At_, n, n);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    At(i, j) = (trans == Op::Trans) ? A(j, i) : conj(A(j, i));
+
+            lacpy(GENERAL, B, X);
+            getrs(trans, F, piv, X);
+            CHECK(backward_error(At, B, X) <= tol);
+        }
+
+        // Hermitian positive definite matrix
+        mm.random(uplo, A);
+        for (idx_t i = 0; i < n; ++i)
+            A(i, i) = real(A(i, i)) + real_t(n);
+        lacpy(uplo, A, F);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if (uplo == Uplo::Upper ? i > j : i < j)
+                    A(i, j) = conj(A(j, i));
+        lacpy(GENERAL, B, X);
+        REQUIRE(posv(uplo, F, X) == 0);
+        CHECK(backward_error(A, B, X) <= tol);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "gesv_ir and posv_ir solve linear systems with a float factorization",
+    "[gesv_ir][posv_ir]",
+    (LegacyMatrix<double, std::size_t, Layout::ColMajor>),
+    (LegacyMatrix<double, std::size_t, Layout::RowMajor>),
+    (LegacyMatrix<std::complex<double>, std::size_t, Layout::ColMajor>))
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 10, 100);
+    const idx_t nrhs = GENERATE(1, 4);
+    const std::string residual = GENERATE("working", "extended");
+    const real_t tol = real_t(10);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs
+                           << " residual = " << residual)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> A0_;
+        auto A0 = new_matrix(A0_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<idx_t> piv(n);
+        int iter = -1;
+
+        mm.random(B);
+
+        // General matrix. A is unchanged if the refinement converges
+        mm.random(A);
+        lacpy(GENERAL, A, A0);
+        if (residual == "working")
+            REQUIRE(gesv_ir<float>(A, piv, B, X, iter) == 0);
+        else
+            REQUIRE(gesv_ir<float, long double>(A, piv, B, X, iter) == 0);
+        CHECK(iter >= 0);
+        CHECK(iter <= 10);
+        CHECK(lange(MAX_NORM, A) == lange(MAX_NORM, A0));
+        CHECK(backward_error(A, B, X) <= tol);
+
+        // Hermitian positive definite matrix
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < j; ++i)
+                A(j, i) = conj(A(i, j));
+            A(j, j) = real(A(j, j)) + real_t(n);
+        }
+        if (residual == "working")
+            REQUIRE(posv_ir<float>(UPPER_TRIANGLE, A, B, X, iter) == 0);
+        else
+            REQUIRE(posv_ir<float, long double>(UPPER_TRIANGLE, A, B, X,
+                                                iter) == 0);
+        CHECK(iter >= 0);
+        CHECK(iter <= 10);
+        CHECK(backward_error(A, B, X) <= tol);
+    }
+}
+
+TEMPLATE_TEST_CASE("gesv_ir switches to GMRES-IR on ill-conditioned matrices",
+                   "[gesv_ir]",
+                   TLAPACK_LEGACY_REAL_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Only double precision has room for a factorization in lower precision
+    if (!is_same_v<real_t, double>) SKIP_TEST;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = 50;
+    const idx_t nrhs = 2;
+    const real_t log10_cond = GENERATE(4, 8, 10);
+    const real_t tol = real_t(10);
+
+    DYNAMIC_SECTION("log10(cond) = " << log10_cond)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+        std::vector<idx_t> piv(n);
+        int iter = -1;
+
+        std::vector<T> F_;
+        auto F = new_matrix(F_, n, n);
+
+        mm.random_cond(A, log10_cond);
+        mm.random(B);
+
+        // Classical refinement only. A is overwritten by its factors if the
+        // refinement does not converge
+        IrOpts opts;
+        opts.gmres = false;
+        lacpy(GENERAL, A, F);
+        REQUIRE(gesv_ir<float>(F, piv, B, X, iter, opts) == 0);
+        CHECK(backward_error(A, B, X) <= tol);
+        if (log10_cond >= 10) CHECK(iter < 0);
+
+        // With GMRES-IR, the refinement converges even if cond(A) is larger
+        // than the inverse of the precision of the factorization
+        opts.gmres = true;
+        REQUIRE(gesv_ir<float>(A, piv, B, X, iter, opts) == 0);
+        CHECK(iter >= 0);
+        CHECK(backward_error(A, B, X) <= tol);
+    }
+}
+
+#ifdef TLAPACK_TEST_EIGEN
+TEST_CASE("gesv_ir and posv_ir with a half precision factorization",
+          "[gesv_ir][posv_ir]")
+{
+    using matrix_t = LegacyMatrix<float>;
+    using T = float;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = 40;
+    const idx_t nrhs = 3;
+    const float tol = 10;
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, nrhs);
+    std::vector<T> X_;
+    auto X = new_matrix(X_, n, nrhs);
+    std::vector<idx_t> piv(n);
+    int iter = -1;
+
+    mm.random(A);
+    mm.random(B);
+    REQUIRE(gesv_ir<Eigen::half, double>(A, piv, B, X, iter) == 0);
+    CHECK(iter >= 0);
+    CHECK(backward_error(A, B, X) <= tol);
+
+    for (idx_t j = 0; j < n; ++j) {
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = A(j, i);
+        A(j, j) += float(n);
+    }
+    REQUIRE(posv_ir<Eigen::half, double>(LOWER_TRIANGLE, A, B, X, iter) == 0);
+    CHECK(iter >= 0);
+    CHECK(backward_error(A, B, X) <= tol);
+}
+#endif
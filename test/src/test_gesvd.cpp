@@ -45,6 +45,8 @@ TEMPLATE_TEST_CASE("svd with small unitary matrix is backward stable",
     idx_t k = min(m, n);
 
     const int seed = GENERATE(2, 3, 4, 5, 6, 7, 8, 9, 10);
+    const GesvdVariant variant =
+        GENERATE(GesvdVariant::QRIteration, GesvdVariant::DivideConquer);
     rand_generator gen;
     gen.seed(seed);
 
@@ -72,9 +74,13 @@ TEMPLATE_TEST_CASE("svd with small unitary matrix is backward stable",
     lacpy(Uplo::General, A, A_copy);
     real_t normA = lange(Norm::Max, A);
 
-    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed)
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed
+                           << " variant = " << (char)variant)
     {
-        int err = gesvd(true, true, A, s, U, Vt);
+        GesvdOpts opts;
+        opts.variant = variant;
+        opts.nx = 2;
+        int err = gesvd(true, true, A, s, U, Vt, opts);
         CHECK(err == 0);
 
         // Check that singular values are positive and sorted in decreasing
@@ -140,6 +146,8 @@ TEMPLATE_TEST_CASE("svd with full unitary matrix is backward stable",
     idx_t k = min(m, n);
 
     const int seed = GENERATE(2, 3, 4, 5, 6, 7, 8, 9, 10);
+    const GesvdVariant variant =
+        GENERATE(GesvdVariant::QRIteration, GesvdVariant::DivideConquer);
     rand_generator gen;
     gen.seed(seed);
 
@@ -167,9 +175,13 @@ TEMPLATE_TEST_CASE("svd with full unitary matrix is backward stable",
     lacpy(Uplo::General, A, A_copy);
     real_t normA = lange(Norm::Max, A);
 
-    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed)
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " seed = " << seed
+                           << " variant = " << (char)variant)
     {
-        int err = gesvd(true, true, A, s, U, Vt);
+        GesvdOpts opts;
+        opts.variant = variant;
+        opts.nx = 2;
+        int err = gesvd(true, true, A, s, U, Vt, opts);
         REQUIRE(err == 0);
 
         // Check that singular values are positive and sorted in decreasing
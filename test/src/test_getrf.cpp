@@ -46,7 +46,8 @@ TEMPLATE_TEST_CASE("LU factorization of a general m-by-n matrix",
     const std::string matrix_type = GENERATE("Random", "Near overflow");
 
     GetrfVariant variant =
-        GENERATE(GetrfVariant::Level0, GetrfVariant::Recursive);
+        GENERATE(GetrfVariant::Level0, GetrfVariant::Recursive,
+                 GetrfVariant::Blocked);
 
     DYNAMIC_SECTION("m = " << m << " n = " << n 
                     << " variant = " << (char)variant 
@@ -83,7 +84,11 @@ TEMPLATE_TEST_CASE("LU factorization of a general m-by-n matrix",
         // Initialize piv vector to all zeros
         std::vector<idx_t> piv(k, idx_t(0));
         // Run getrf and both A and piv will be update
-        getrf(A, piv, GetrfOpts{variant});
+        ThreadPool pool(2);
+        GetrfOpts opts(variant);
+        opts.nb = 7;
+        opts.pool = &pool;
+        getrf(A, piv, opts);
 
         // A contains L and U now, then form A <--- LU
         if (m > n) {
@@ -0,0 +1,89 @@
+/// @file test_gttrf.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the tridiagonal LU factorization and solver
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/gttrf.hpp>
+#include <tlapack/lapack/gttrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("gttrf and gttrs solve tridiagonal linear systems",
+                   "[gttrf][gttrs]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 2, 3, 10, 50);
+    const idx_t nrhs = GENERATE(1, 7, 20);
+    const idx_t nb = GENERATE(1, 4);
+    const real_t tol = real_t(10);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " nb = " << nb)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+
+        // Tridiagonal matrix A
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if (i > j + 1 || j > i + 1) A(i, j) = T(0);
+        mm.random(B);
+
+        std::vector<T> DL(n - 1), D(n), DU(n - 1), DU2(max<idx_t>(n, 2) - 2);
+        std::vector<idx_t> piv(n);
+        for (idx_t i = 0; i < n; ++i) {
+            D[i] = A(i, i);
+            if (i + 1 < n) {
+                DL[i] = A(i + 1, i);
+                DU[i] = A(i, i + 1);
+            }
+        }
+
+        REQUIRE(gttrf(DL, D, DU, DU2, piv) == 0);
+
+        GttrsOpts opts;
+        opts.nb = nb;
+        for (const Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans}) {
+            std::vector<T> opA_;
+            auto opA = new_matrix(opA_, n, n);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    opA(i, j) = (trans == Op::NoTrans) ? A(i, j)
+                                : (trans == Op::Trans) ? A(j, i)
+                                                       : conj(A(j, i));
+
+            lacpy(GENERAL, B, X);
+            REQUIRE(gttrs(trans, DL, D, DU, DU2, piv, X, opts) == 0);
+            CHECK(backward_error(opA, B, X) <= tol);
+        }
+    }
+}
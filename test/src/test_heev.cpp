@@ -0,0 +1,111 @@
+/// @file test_heev.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test HEEV
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/heev.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Eigendecomposition of a hermitian matrix is backward stable",
+                   "[heev]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // Generators
+    const idx_t n = GENERATE(1, 2, 6, 13, 29);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const HeevVariant variant =
+        GENERATE(HeevVariant::QRIteration, HeevVariant::DivideConquer);
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo
+                           << " variant = " << (char)variant)
+    {
+        // Constants
+        const real_t one(1);
+        const real_t eps = ulp<real_t>();
+        real_t tol = real_t(20 * n) * eps;
+        // Use a slightly larger tolerance for half precision
+        if (eps > real_t(1.0e-6)) tol = tol * real_t(5.);
+
+        // Matrices and vectors
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> Z_;
+        auto Z = new_matrix(Z_, n, n);
+        std::vector<real_t> w(n);
+
+        // Generate a random hermitian matrix
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < j; ++i) {
+                A(i, j) = rand_helper<T>();
+                A(j, i) = conj(A(i, j));
+            }
+            A(j, j) = real(rand_helper<T>());
+        }
+        const real_t normA = lange(Norm::Fro, A);
+        std::vector<T> A0_;
+        auto A0 = new_matrix(A0_, n, n);
+        lacpy(GENERAL, A, A0);
+
+        // Compute the eigenvalues and eigenvectors
+        HeevOpts opts;
+        opts.variant = variant;
+        opts.nb = 3;
+        opts.nx = 2;
+        lacpy(uplo, A, Z);
+        int info = heev(true, uplo, Z, w, opts);
+        REQUIRE(info == 0);
+
+        // Check that the eigenvalues are sorted in increasing order
+        for (idx_t i = 0; i + 1 < n; ++i)
+            CHECK(w[i] <= w[i + 1]);
+
+        // Check that Z is orthogonal
+        auto orth_Z = check_orthogonality(Z);
+        CHECK(orth_Z <= tol);
+
+        // Check that A - Z diag(w) Z^H is close to zero
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                R(i, j) = Z(i, j) * w[j];
+        gemm(NO_TRANS, CONJ_TRANS, one, R, Z, -one, A);
+        CHECK(lange(Norm::Fro, A) / normA <= tol);
+
+        // Check that the eigenvalues computed without eigenvectors match
+        std::vector<real_t> w2(n);
+        lacpy(uplo, A0, Z);
+        info = heev(false, uplo, Z, w2, opts);
+        REQUIRE(info == 0);
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(w[i] - w2[i]) <= tol * normA);
+    }
+}
@@ -23,12 +23,13 @@
 // Other routines
 #include <tlapack/blas/gemm.hpp>
 #include <tlapack/lapack/hetd2.hpp>
+#include <tlapack/lapack/hetrd.hpp>
 #include <tlapack/lapack/ungtr.hpp>
 
 using namespace tlapack;
 
 TEMPLATE_TEST_CASE("Tridiagnolization of a symmetric matrix works",
-                   "[hetd2]",
+                   "[hetd2][hetrd]",
                    TLAPACK_TYPES_TO_TEST)
 {
     srand(1);
@@ -44,8 +45,9 @@ TEMPLATE_TEST_CASE("Tridiagnolization of a symmetric matrix works",
     // Generators
     idx_t n = GENERATE(1, 2, 6, 13, 29);
     const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const size_t nb = GENERATE(0, 3, 5);
 
-    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo)
+    DYNAMIC_SECTION("n = " << n << " uplo = " << uplo << " nb = " << nb)
     {
         // Constants
         const real_t zero(0);
@@ -71,7 +73,13 @@ TEMPLATE_TEST_CASE("Tridiagnolization of a symmetric matrix works",
 
         // Copy A to Q and run the algorithm in Q
         lacpy(uplo, A, Q);
-        hetd2(uplo, Q, tau);
+        if (nb == 0)
+            hetd2(uplo, Q, tau);
+        else {
+            HetrdOpts opts;
+            opts.nb = nb;
+            hetrd(uplo, Q, tau, opts);
+        }
 
         // Store D and test that the diagonal of Q is real
         bool main_diag_is_real = true;
@@ -48,7 +48,8 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
                  (variant_t(HouseholderQRVariant::Blocked, 2)),
                  (variant_t(HouseholderQRVariant::Blocked, 4)),
                  (variant_t(HouseholderQRVariant::Blocked, 5)),
-                 (variant_t(HouseholderQRVariant::Level2, 1)));
+                 (variant_t(HouseholderQRVariant::Level2, 1)),
+                 (variant_t(HouseholderQRVariant::TSQR, 2)));
     const idx_t m = GENERATE(5, 10, 20, 30);
     const idx_t n = GENERATE(5, 10, 20, 30);
     const idx_t nv = GENERATE(5, 10, 20, 30);  // number of Householder vectors
@@ -104,9 +105,12 @@ TEMPLATE_TEST_CASE("QR, RQ, QL, LQ factorization of a general m-by-n matrix",
             auto Q = new_matrix(Q_, m, nv);
 
             // QR decomposition
+            ThreadPool pool(2);
             HouseholderQROpts qrOpts;
             qrOpts.variant = variant_qr;
             qrOpts.nb = nb;
+            qrOpts.tsqr_mb = 1;
+            qrOpts.pool = &pool;
             householder_qr(A, tau, qrOpts);
 
             // Copy A to Q and R
@@ -0,0 +1,93 @@
+/// @file test_pbtrf.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the band Cholesky factorization and solver
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/pbtrf.hpp>
+#include <tlapack/lapack/pbtrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("pbtrf and pbtrs solve Hermitian positive definite band "
+                   "linear systems",
+                   "[pbtrf][pbtrs]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 10, 100);
+    const idx_t kd = GENERATE(0, 3, 12);
+    const idx_t nb = GENERATE(1, 4);
+    const idx_t nrhs = GENERATE(1, 5);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const real_t tol = real_t(10) * real_t(kd + 1);
+
+    if (kd >= n) SKIP_TEST;
+
+    DYNAMIC_SECTION("n = " << n << " kd = " << kd << " nb = " << nb
+                           << " nrhs = " << nrhs << " uplo = " << (char)uplo)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+
+        // Hermitian positive definite band matrix A with bandwidth kd
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < j; ++i)
+                A(i, j) = (j > i + kd) ? T(0) : conj(A(j, i));
+            for (idx_t i = j + 1; i < n; ++i)
+                if (i > j + kd) A(i, j) = T(0);
+            A(j, j) = real(A(j, j)) + real_t(3 * kd + 2);
+        }
+        mm.random(B);
+
+        // Band storage of the triangle uplo
+        std::vector<T> AB_((kd + 1) * n);
+        LegacyBandedMatrix<T, idx_t> AB(n, n, (uplo == Uplo::Lower) ? kd : 0,
+                                        (uplo == Uplo::Upper) ? kd : 0,
+                                        AB_.data());
+        for (idx_t j = 0; j < n; ++j) {
+            if (uplo == Uplo::Upper)
+                for (idx_t i = (j > kd) ? j - kd : 0; i <= j; ++i)
+                    AB(i, j) = A(i, j);
+            else
+                for (idx_t i = j; i < min(n, j + kd + 1); ++i)
+                    AB(i, j) = A(i, j);
+        }
+
+        PbtrfOpts opts;
+        opts.nb = nb;
+        REQUIRE(pbtrf(uplo, AB, opts) == 0);
+
+        lacpy(GENERAL, B, X);
+        REQUIRE(pbtrs(uplo, AB, X) == 0);
+        CHECK(backward_error(A, B, X) <= tol);
+    }
+}
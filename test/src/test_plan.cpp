@@ -0,0 +1,256 @@
+/// @file test_plan.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test workspace plans
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/lapack/plan.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Plans give the same results as the allocating routines",
+                   "[plan]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using range = pair<idx_t, idx_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t m = GENERATE(10, 23);
+    const idx_t n = GENERATE(7, 23);
+    const idx_t k = min(m, n);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, m, n);
+    std::vector<T> tauA(k);
+    std::vector<T> tauB(k);
+
+    MatrixMarket mm;
+
+    // Entrywise comparison of A and B
+    auto sameAB = [&]() {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                if (A(i, j) != B(i, j)) return false;
+        return true;
+    };
+
+    INFO("m = " << m << " n = " << n);
+
+    SECTION("geqrf")
+    {
+        auto qr = plan(routines::geqrf, A, tauA);
+        for (int i = 0; i < 3; ++i) {
+            mm.random(A);
+            lacpy(GENERAL, A, B);
+            qr(A, tauA);
+            geqrf(B, tauB);
+            CHECK(sameAB());
+            CHECK(tauA == tauB);
+        }
+    }
+
+    SECTION("gelqf")
+    {
+        auto lq = plan(routines::gelqf, A, tauA);
+        for (int i = 0; i < 3; ++i) {
+            mm.random(A);
+            lacpy(GENERAL, A, B);
+            lq(A, tauA);
+            gelqf(B, tauB);
+            CHECK(sameAB());
+            CHECK(tauA == tauB);
+        }
+    }
+
+    SECTION("ungq and unmq")
+    {
+        mm.random(A);
+        geqrf(A, tauA);
+        auto V = slice(A, range{0, m}, range{0, k});
+        std::vector<T> Q_;
+        auto Q = new_matrix(Q_, m, k);
+        std::vector<T> C_;
+        auto C = new_matrix(C_, m, n);
+        std::vector<T> D_;
+        auto D = new_matrix(D_, m, n);
+        auto gen = plan(routines::ungq, FORWARD, COLUMNWISE_STORAGE, Q, tauA);
+        auto mul = plan(routines::unmq, LEFT_SIDE, CONJ_TRANS, FORWARD,
+                        COLUMNWISE_STORAGE, V, tauA, C);
+        for (int i = 0; i < 3; ++i) {
+            lacpy(GENERAL, V, Q);
+            gen(FORWARD, COLUMNWISE_STORAGE, Q, tauA);
+            auto Bk = slice(B, range{0, m}, range{0, k});
+            lacpy(GENERAL, V, Bk);
+            ungq(FORWARD, COLUMNWISE_STORAGE, Bk, tauA);
+            for (idx_t j = 0; j < k; ++j)
+                for (idx_t l = 0; l < m; ++l)
+                    CHECK(Q(l, j) == Bk(l, j));
+
+            mm.random(C);
+            lacpy(GENERAL, C, D);
+            mul(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE, V, tauA,
+                C);
+            unmq(LEFT_SIDE, CONJ_TRANS, FORWARD, COLUMNWISE_STORAGE, V, tauA,
+                 D);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t l = 0; l < m; ++l)
+                    CHECK(C(l, j) == D(l, j));
+        }
+    }
+
+    SECTION("getrf")
+    {
+        std::vector<idx_t> pivA(k), pivB(k);
+        auto lu = plan(routines::getrf, A, pivA);
+        for (int i = 0; i < 3; ++i) {
+            mm.random(A);
+            lacpy(GENERAL, A, B);
+            lu(A, pivA);
+            getrf(B, pivB);
+            CHECK(sameAB());
+            CHECK(pivA == pivB);
+        }
+    }
+
+    if (m == n) {
+        SECTION("gesv and potrf")
+        {
+            std::vector<idx_t> pivA(n), pivB(n);
+            std::vector<T> X_;
+            auto X = new_matrix(X_, n, 2);
+            std::vector<T> Y_;
+            auto Y = new_matrix(Y_, n, 2);
+            auto solve = plan(routines::gesv, A, pivA, X);
+            auto chol = plan(routines::potrf, LOWER_TRIANGLE, A);
+            for (int i = 0; i < 3; ++i) {
+                mm.random(A);
+                mm.random(X);
+                lacpy(GENERAL, A, B);
+                lacpy(GENERAL, X, Y);
+                solve(A, pivA, X);
+                gesv(B, pivB, Y);
+                CHECK(sameAB());
+                CHECK(pivA == pivB);
+
+                mm.random(B);
+                herk(LOWER_TRIANGLE, CONJ_TRANS, real_t(1), B, real_t(0), A);
+                for (idx_t j = 0; j < n; ++j)
+                    A(j, j) += real_t(n);
+                lacpy(GENERAL, A, B);
+                chol(LOWER_TRIANGLE, A);
+                potrf(LOWER_TRIANGLE, B);
+                CHECK(sameAB());
+            }
+        }
+
+        SECTION("multishift_qr")
+        {
+            using complex_t = complex_type<real_t>;
+            std::vector<complex_t> wA(n), wB(n);
+            std::vector<T> Z_;
+            auto Z = new_matrix(Z_, n, n);
+            FrancisOpts opts;
+            opts.nmin = 15;
+            auto schur = plan(routines::multishift_qr, true, false, idx_t(0),
+                              n, A, wA, Z, opts);
+            for (int i = 0; i < 3; ++i) {
+                mm.random(Uplo::Upper, A);
+                for (idx_t j = 0; j + 1 < n; ++j)
+                    A(j + 1, j) = real_t(1);
+                lacpy(GENERAL, A, B);
+                schur(true, false, idx_t(0), n, A, wA, Z, opts);
+                multishift_qr(true, false, idx_t(0), n, B, wB, Z, opts);
+                CHECK(sameAB());
+                CHECK(wA == wB);
+            }
+        }
+
+        SECTION("gehrd and unghr")
+        {
+            const idx_t ilo = 0, ihi = n;
+            auto hess = plan(routines::gehrd, ilo, ihi, A, tauA);
+            auto q = plan(routines::unghr, ilo, ihi, A, tauA);
+            for (int i = 0; i < 3; ++i) {
+                mm.random(A);
+                lacpy(GENERAL, A, B);
+                hess(ilo, ihi, A, tauA);
+                gehrd(ilo, ihi, B, tauB);
+                CHECK(sameAB());
+                CHECK(tauA == tauB);
+                q(ilo, ihi, A, tauA);
+                unghr(ilo, ihi, B, tauB);
+                CHECK(sameAB());
+            }
+        }
+
+        SECTION("hetrd")
+        {
+            std::vector<T> tau(n - 1);
+            auto trd = plan(routines::hetrd, LOWER_TRIANGLE, A, tau);
+            for (int i = 0; i < 3; ++i) {
+                mm.random(A);
+                lacpy(GENERAL, A, B);
+                trd(LOWER_TRIANGLE, A, tau);
+                hetrd(LOWER_TRIANGLE, B, tauB);
+                CHECK(sameAB());
+                for (idx_t j = 0; j < n - 1; ++j)
+                    CHECK(tau[j] == tauB[j]);
+            }
+        }
+    }
+
+    SECTION("gesvd")
+    {
+        std::vector<real_t> sA(k), sB(k);
+        std::vector<T> U_;
+        auto U = new_matrix(U_, 0, 0);
+        std::vector<T> Vt_;
+        auto Vt = new_matrix(Vt_, 0, 0);
+        auto svd = plan(routines::gesvd, false, false, A, sA, U, Vt);
+        for (int i = 0; i < 3; ++i) {
+            mm.random(A);
+            lacpy(GENERAL, A, B);
+            svd(false, false, A, sA, U, Vt);
+            gesvd(false, false, B, sB, U, Vt);
+            CHECK(sA == sB);
+        }
+    }
+}
+
+#if defined(TLAPACK_CHECK_INPUT) && !defined(TLAPACK_NDEBUG)
+TEST_CASE("Plans reject arguments that need a larger workspace", "[plan]")
+{
+    using matrix_t = LegacyMatrix<double>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    std::vector<double> A_;
+    auto A = new_matrix(A_, 10, 10);
+    std::vector<double> B_;
+    auto B = new_matrix(B_, 40, 40);
+    std::vector<double> tau(40);
+
+    auto qr = plan(routines::geqrf, A, tau);
+    CHECK(qr.size() > 0);
+    CHECK(qr.fits(geqrf_worksize<double>(A, tau)));
+    CHECK(!qr.fits(geqrf_worksize<double>(B, tau)));
+    CHECK_THROWS(qr(B, tau));
+}
+#endif
@@ -56,6 +56,8 @@ TEMPLATE_TEST_CASE(
                  (variant_t(PotrfVariant::RightLooking, 2)),
                  (variant_t(PotrfVariant::RightLooking, 7)),
                  (variant_t(PotrfVariant::RightLooking, 10)),
+                 (variant_t(PotrfVariant::TiledParallel, 3)),
+                 (variant_t(PotrfVariant::TiledParallel, 7)),
                  (variant_t(PotrfVariant::Recursive, 0)),
                  (variant_t(PotrfVariant::Level2, 0)));
     const idx_t n = GENERATE(10, 19, 30);
@@ -86,9 +88,11 @@ TEMPLATE_TEST_CASE(
         real_t normA = tlapack::lanhe(tlapack::MAX_NORM, uplo, A);
 
         // Run the Cholesky factorization
+        ThreadPool pool(3);
         PotrfOpts opts;
         opts.variant = variant.first;
         opts.nb = variant.second;
+        opts.pool = &pool;
         int info = potrf(uplo, L, opts);
 
         // Check that the factorization was successful
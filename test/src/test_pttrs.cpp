@@ -0,0 +1,80 @@
+/// @file test_pttrs.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the solver for Hermitian positive definite tridiagonal systems
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/pttrf.hpp>
+#include <tlapack/lapack/pttrs.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE(
+    "pttrs solves Hermitian positive definite tridiagonal linear systems",
+    "[pttrf][pttrs]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t n = GENERATE(1, 2, 10, 50);
+    const idx_t nrhs = GENERATE(1, 7, 20);
+    const idx_t nb = GENERATE(1, 4);
+    const real_t tol = real_t(10);
+
+    DYNAMIC_SECTION("n = " << n << " nrhs = " << nrhs << " nb = " << nb)
+    {
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, n, nrhs);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, n, nrhs);
+
+        // Hermitian positive definite tridiagonal matrix A
+        mm.random(A);
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < n; ++i)
+                if (i > j + 1 || j > i + 1) A(i, j) = T(0);
+            A(j, j) = abs(A(j, j)) + real_t(4);
+            if (j > 0) A(j - 1, j) = conj(A(j, j - 1));
+        }
+        mm.random(B);
+
+        std::vector<real_t> D(n);
+        std::vector<T> E(n - 1);
+        for (idx_t i = 0; i < n; ++i) {
+            D[i] = real(A(i, i));
+            if (i + 1 < n) E[i] = A(i + 1, i);
+        }
+
+        REQUIRE(pttrf(D, E) == 0);
+
+        PttrsOpts opts;
+        opts.nb = nb;
+        lacpy(GENERAL, B, X);
+        REQUIRE(pttrs(D, E, X, opts) == 0);
+        CHECK(backward_error(A, B, X) <= tol);
+    }
+}
@@ -145,6 +145,11 @@ TEMPLATE_TEST_CASE("QR algorithm",
         };
         opts.nmin = 15;
 
+        // Update the parts away from the diagonal with several threads
+        static ThreadPool pool(3);
+        opts.pool = &pool;
+        opts.num_threads = 4;
+
         int ierr = qr_iteration(true, true, ilo, ihi, H, s, Q, opts);
         CHECK(ierr == 0);
 
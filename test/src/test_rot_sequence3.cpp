@@ -45,7 +45,7 @@ TEMPLATE_TEST_CASE("Application of rotation sequence is accurate",
     const Side side = GENERATE(Side::Left, Side::Right);
     const Direction direction =
         GENERATE(Direction::Forward, Direction::Backward);
-    const idx_t n = GENERATE(1, 2, 3, 4, 5, 10, 13);
+    const idx_t n = GENERATE(1, 2, 3, 4, 5, 10, 13, 300);
     const idx_t m = GENERATE(1, 2, 3, 4, 5, 10, 13);
     const idx_t l = GENERATE(1, 2, 3, 4);
 
@@ -0,0 +1,291 @@
+/// @file test_static_kernels.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the kernels for matrices of sizes known at compile time
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/trsm.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+#include <tlapack/lapack/potrf.hpp>
+
+using namespace tlapack;
+
+// Max norm of A - B relative to the max norm of B
+template <class matrix_t>
+real_type<type_t<matrix_t>> rel_diff(const matrix_t& A, const matrix_t& B)
+{
+    using real_t = real_type<type_t<matrix_t>>;
+    using idx_t = size_type<matrix_t>;
+
+    real_t diff(0);
+    for (idx_t j = 0; j < ncols(A); ++j)
+        for (idx_t i = 0; i < nrows(A); ++i)
+            diff = max(diff, abs(A(i, j) - B(i, j)));
+    return diff / max(lange(MAX_NORM, B), real_t(1));
+}
+
+template <int m, int n, int k, class matrix_t>
+void check_gemm_static()
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+
+    Create<matrix_t> new_matrix;
+    MatrixMarket mm;
+
+    const real_t tol = real_t(4 * (k + 1)) * ulp<real_t>();
+    const T alpha = T(real_t(1.5));
+    const T beta = T(real_t(-0.5));
+
+    for (Op transA : {Op::NoTrans, Op::Trans, Op::ConjTrans}) {
+        for (Op transB : {Op::NoTrans, Op::Trans, Op::ConjTrans}) {
+            std::vector<T> A_;
+            auto A = (transA == Op::NoTrans) ? new_matrix(A_, m, k)
+                                             : new_matrix(A_, k, m);
+            std::vector<T> B_;
+            auto B = (transB == Op::NoTrans) ? new_matrix(B_, k, n)
+                                             : new_matrix(B_, n, k);
+            std::vector<T> C_;
+            auto C = new_matrix(C_, m, n);
+            std::vector<T> R_;
+            auto R = new_matrix(R_, m, n);
+
+            mm.random(A);
+            mm.random(B);
+            mm.random(C);
+            lacpy(GENERAL, C, R);
+
+            gemm(transA, transB, alpha, A, B, beta, R);
+            gemm_static<m, n, k>(transA, transB, alpha, A, B, beta, C);
+
+            INFO("transA = " << transA << " transB = " << transB);
+            CHECK(rel_diff(C, R) <= tol);
+        }
+    }
+}
+
+template <int m, int n, class matrix_t>
+void check_trsm_static()
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+
+    Create<matrix_t> new_matrix;
+    MatrixMarket mm;
+
+    const real_t tol = real_t(10 * (m + n)) * ulp<real_t>();
+    const T alpha = T(real_t(1.5));
+
+    for (Side side : {Side::Left, Side::Right}) {
+        for (Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+            for (Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans}) {
+                for (Diag diag : {Diag::NonUnit, Diag::Unit}) {
+                    const idx_t k = (side == Side::Left) ? m : n;
+
+                    // Well-conditioned triangular matrix
+                    std::vector<T> A_;
+                    auto A = new_matrix(A_, k, k);
+                    mm.random(A);
+                    for (idx_t i = 0; i < k; ++i)
+                        A(i, i) += real_t(k);
+
+                    std::vector<T> B_;
+                    auto B = new_matrix(B_, m, n);
+                    std::vector<T> R_;
+                    auto R = new_matrix(R_, m, n);
+                    mm.random(B);
+                    lacpy(GENERAL, B, R);
+
+                    trsm(side, uplo, trans, diag, alpha, A, R);
+                    trsm_static<m, n>(side, uplo, trans, diag, alpha, A, B);
+
+                    INFO("side = " << side << " uplo = " << uplo
+                                   << " trans = " << trans
+                                   << " diag = " << diag);
+                    CHECK(rel_diff(B, R) <= tol);
+                }
+            }
+        }
+    }
+}
+
+template <int m, int n, class matrix_t>
+void check_getrf_static()
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+
+    Create<matrix_t> new_matrix;
+    MatrixMarket mm;
+
+    const real_t tol = real_t(10 * (m + n)) * ulp<real_t>();
+    constexpr idx_t k = min(m, n);
+
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> R_;
+    auto R = new_matrix(R_, m, n);
+    mm.random(A);
+    lacpy(GENERAL, A, R);
+
+    std::vector<idx_t> piv(k), pivR(k);
+    const int info = getrf_static<m, n>(A, piv);
+    const int infoR = getrf(R, pivR, GetrfOpts(GetrfVariant::Level0));
+
+    CHECK(info == infoR);
+    CHECK(piv == pivR);
+    CHECK(rel_diff(A, R) <= tol);
+
+    // Zero column
+    if constexpr (n > 1) {
+        mm.random(A);
+        for (idx_t i = 0; i < (idx_t)m; ++i)
+            A(i, 1) = T(0);
+        if (m > 1) CHECK(getrf_static<m, n>(A, piv) == 2);
+    }
+}
+
+template <int n, class matrix_t>
+void check_potrf_static()
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    using idx_t = size_type<matrix_t>;
+
+    Create<matrix_t> new_matrix;
+    MatrixMarket mm;
+
+    const real_t tol = real_t(10 * n) * ulp<real_t>();
+
+    for (Uplo uplo : {Uplo::Lower, Uplo::Upper}) {
+        // Hermitian, diagonally dominant matrix
+        std::vector<T> A_;
+        auto A = new_matrix(A_, n, n);
+        mm.random(A);
+        for (idx_t j = 0; j < (idx_t)n; ++j) {
+            for (idx_t i = 0; i < j; ++i)
+                A(i, j) = conj(A(j, i));
+            A(j, j) = T(real(A(j, j)) + real_t(n));
+        }
+
+        std::vector<T> R_;
+        auto R = new_matrix(R_, n, n);
+        lacpy(GENERAL, A, R);
+
+        const int info = potrf_static<n>(uplo, A);
+        const int infoR = potrf(uplo, R, PotrfOpts{});
+
+        INFO("uplo = " << uplo);
+        CHECK(info == 0);
+        CHECK(infoR == 0);
+        CHECK(rel_diff(A, R) <= tol);
+
+        // Not positive definite
+        mm.random(A);
+        A(n - 1, n - 1) = T(-real_t(n) * real_t(n));
+        for (idx_t j = 0; j + 1 < (idx_t)n; ++j)
+            A(j, j) = T(real_t(n) * real_t(n));
+#ifdef TLAPACK_NDEBUG
+        CHECK(potrf_static<n>(uplo, A) == n);
+#else
+        CHECK_THROWS(potrf_static<n>(uplo, A));
+#endif
+    }
+}
+
+TEMPLATE_TEST_CASE("Fixed-size kernels match the general routines",
+                   "[gemm][trsm][getrf][potrf][static]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+
+    SECTION("gemm_static")
+    {
+        check_gemm_static<1, 1, 1, matrix_t>();
+        check_gemm_static<3, 3, 3, matrix_t>();
+        check_gemm_static<2, 5, 4, matrix_t>();
+        check_gemm_static<6, 6, 6, matrix_t>();
+        check_gemm_static<8, 7, 0, matrix_t>();
+    }
+    SECTION("trsm_static")
+    {
+        check_trsm_static<3, 3, matrix_t>();
+        check_trsm_static<2, 5, matrix_t>();
+        check_trsm_static<6, 1, matrix_t>();
+    }
+    SECTION("getrf_static")
+    {
+        check_getrf_static<3, 3, matrix_t>();
+        check_getrf_static<6, 6, matrix_t>();
+        check_getrf_static<4, 7, matrix_t>();
+        check_getrf_static<8, 5, matrix_t>();
+    }
+    SECTION("potrf_static")
+    {
+        check_potrf_static<1, matrix_t>();
+        check_potrf_static<3, matrix_t>();
+        check_potrf_static<6, matrix_t>();
+        check_potrf_static<8, matrix_t>();
+    }
+}
+
+#ifdef TLAPACK_TEST_EIGEN
+TEMPLATE_TEST_CASE("Fixed-size Eigen matrices use the fixed-size kernels",
+                   "[gemm][getrf][potrf][static]",
+                   float,
+                   double,
+                   std::complex<double>)
+{
+    using T = TestType;
+    using real_t = real_type<T>;
+    using matrix_t = Eigen::Matrix<T, 3, 3>;
+
+    STATIC_REQUIRE(static_nrows<matrix_t> == 3);
+    STATIC_REQUIRE(static_ncols<matrix_t> == 3);
+    STATIC_REQUIRE(static_nrows<Eigen::Matrix<T, Eigen::Dynamic, 3>> == -1);
+    STATIC_REQUIRE(internal::use_static_kernels<matrix_t>);
+
+    const real_t tol = real_t(30) * ulp<real_t>();
+
+    matrix_t A = matrix_t::Random();
+    matrix_t H = A.adjoint() * A + real_t(3) * matrix_t::Identity();
+
+    // getrf
+    matrix_t LU = A;
+    std::vector<Eigen::Index> piv(3);
+    REQUIRE(getrf(LU, piv) == 0);
+    matrix_t L = matrix_t::Identity();
+    matrix_t U = matrix_t::Zero();
+    for (int j = 0; j < 3; ++j)
+        for (int i = 0; i < 3; ++i)
+            (i > j ? L(i, j) : U(i, j)) = LU(i, j);
+    matrix_t PA = A;
+    for (int i = 0; i < 3; ++i)
+        PA.row(i).swap(PA.row(piv[i]));
+    CHECK((PA - L * U).norm() <= tol * A.norm());
+
+    // potrf
+    matrix_t C = H;
+    REQUIRE(potrf(LOWER_TRIANGLE, C) == 0);
+    matrix_t Lc = C.template triangularView<Eigen::Lower>();
+    CHECK((H - Lc * Lc.adjoint()).norm() <= tol * H.norm());
+
+    // gemm
+    matrix_t R = A;
+    gemm(NO_TRANS, CONJ_TRANS, real_t(1), A, H, real_t(2), R);
+    CHECK((R - (A * H.adjoint() + real_t(2) * A)).norm() <= tol * R.norm());
+}
+#endif
@@ -41,6 +41,7 @@ TEMPLATE_TEST_CASE("svd is backward stable",
     idx_t n;
 
     n = GENERATE(1, 2, 4, 5, 10, 12, 20);
+    const idx_t nb = GENERATE(1, 3);
 
     const real_t eps = ulp<real_t>();
     real_t tol = real_t(20. * n) * eps;
@@ -69,9 +70,11 @@ TEMPLATE_TEST_CASE("svd is backward stable",
     laset(Uplo::General, zero, one, Q);
     laset(Uplo::General, zero, one, Pt);
 
-    DYNAMIC_SECTION(" n = " << n)
+    DYNAMIC_SECTION(" n = " << n << " nb = " << nb)
     {
-        int err = svd_qr(Uplo::Upper, true, true, d, e, Q, Pt);
+        SvdQrOpts opts;
+        opts.nb = nb;
+        int err = svd_qr(Uplo::Upper, true, true, d, e, Q, Pt, opts);
         REQUIRE(err == 0);
 
         // Check that singular values are positive and sorted in decreasing
@@ -0,0 +1,156 @@
+/// @file test_trace.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the tracing of the calls to <T>LAPACK routines
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// The target test_trace defines TLAPACK_TRACE regardless of the option
+// TLAPACK_TRACE, so that all routines in this test record their calls
+#ifndef TLAPACK_TRACE
+    #error "test_trace.cpp must be compiled with TLAPACK_TRACE defined"
+#endif
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/base/trace.hpp>
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/lapack/gesvd.hpp>
+#include <tlapack/lapack/getrf.hpp>
+
+#include <sstream>
+
+using namespace tlapack;
+
+TEST_CASE("Trace records the call tree of the routines", "[trace]")
+{
+    using matrix_t = LegacyMatrix<double>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t n = 100;
+
+    std::vector<double> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<double> B_;
+    auto B = new_matrix(B_, n, n);
+    std::vector<double> C_;
+    auto C = new_matrix(C_, n, n);
+    std::vector<idx_t> piv(n);
+
+    MatrixMarket mm;
+    mm.random(A);
+    mm.random(B);
+
+    Trace& trace = Trace::global();
+    trace.clear();
+
+    // Nothing is recorded before start()
+    gemm(NO_TRANS, NO_TRANS, 1.0, A, B, 0.0, C);
+    CHECK(trace.events().empty());
+
+    size_t n_enter = 0, n_exit = 0;
+    trace.set_callbacks([&](const TraceEvent&) { ++n_enter; },
+                        [&](const TraceEvent& e) {
+                            ++n_exit;
+                            CHECK(e.duration >= 0);
+                        });
+
+    trace.start();
+    gemm(NO_TRANS, NO_TRANS, 1.0, A, B, 0.0, C);
+    GetrfOpts opts;
+    opts.variant = GetrfVariant::Recursive;
+    getrf(A, piv, opts);
+    trace.stop();
+    trace.set_callbacks(nullptr, nullptr);
+
+    const std::vector<TraceEvent> events = trace.events();
+    REQUIRE(events.size() > 2);
+    CHECK(n_enter == events.size());
+    CHECK(n_exit == events.size());
+
+    // The first events are the two calls at the top level
+    CHECK(std::string(events[0].name) == "gemm");
+    CHECK(events[0].parent == -1);
+    CHECK(events[0].flops == 2. * n * n * n);
+
+    size_t i_getrf = 1;
+    while (std::string(events[i_getrf].name) != "getrf")
+        ++i_getrf;
+    CHECK(events[i_getrf].parent == -1);
+    CHECK(events[i_getrf].depth == 0);
+
+    // The calls inside getrf are nested in it
+    bool nested = false;
+    for (size_t i = i_getrf + 1; i < events.size(); ++i) {
+        CHECK(events[i].parent >= (long)i_getrf);
+        CHECK(events[i].depth >= 1);
+        CHECK(events[i].start >= events[events[i].parent].start);
+        CHECK(events[i].start + events[i].duration <=
+              events[events[i].parent].start +
+                  events[events[i].parent].duration);
+        nested = true;
+    }
+    CHECK(nested);
+
+    // Summary
+    const auto summary = trace.summary();
+    REQUIRE(summary.count("getrf") == 1);
+    CHECK(summary.at("getrf").calls == 1);
+    CHECK(summary.at("getrf").self_time <= summary.at("getrf").time);
+    CHECK(summary.at("getrf").flops == internal::flops_getrf(n, n));
+    REQUIRE(summary.count("gemm") == 1);
+    CHECK(summary.at("gemm").calls >= 2);
+
+    // Chrome trace
+    std::stringstream ss;
+    trace.write_chrome_trace(ss);
+    const std::string json = ss.str();
+    CHECK(json.find("\"traceEvents\"") != std::string::npos);
+    CHECK(json.find("\"name\": \"getrf\"") != std::string::npos);
+
+    trace.clear();
+    CHECK(trace.events().empty());
+    CHECK(trace.summary().empty());
+}
+
+TEST_CASE("Trace shows the phases of gesvd", "[trace]")
+{
+    using matrix_t = LegacyMatrix<float>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    const idx_t m = 60, n = 40;
+
+    std::vector<float> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<float> U_;
+    auto U = new_matrix(U_, m, n);
+    std::vector<float> Vt_;
+    auto Vt = new_matrix(Vt_, n, n);
+    std::vector<float> s(n);
+
+    MatrixMarket mm;
+    mm.random(A);
+
+    Trace& trace = Trace::global();
+    trace.clear();
+    trace.start();
+    gesvd(true, true, A, s, U, Vt);
+    trace.stop();
+
+    const auto summary = trace.summary();
+    for (const char* name : {"gesvd", "gebrd", "ungq", "svd_qr"})
+        CHECK(summary.count(name) == 1);
+
+    trace.clear();
+}
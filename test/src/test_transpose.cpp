@@ -12,6 +12,7 @@
 #include "testutils.hpp"
 
 // <T>LAPACK
+#include <tlapack/lapack/lacpy.hpp>
 #include <tlapack/lapack/transpose.hpp>
 
 using namespace tlapack;
@@ -99,3 +100,124 @@ TEMPLATE_TEST_CASE("Transpose gives correct result",
                 CHECK(B(j, i) == A(i, j));
     }
 }
+
+TEMPLATE_TEST_CASE("Transpose with the default options gives correct result",
+                   "[util]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Sizes that fill the vectorized tiles and leave remainders
+    idx_t n = GENERATE(8, 17, 40);
+    idx_t m = GENERATE(8, 19, 64);
+
+    // Define the matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, m, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, m);
+    std::vector<T> C_;
+    auto C = new_matrix(C_, n, m);
+
+    // Generate a random matrix in A
+    mm.random(A);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        transpose(A, B);
+        conjtranspose(A, C);
+
+        for (idx_t i = 0; i < m; ++i)
+            for (idx_t j = 0; j < n; ++j) {
+                CHECK(B(j, i) == A(i, j));
+                CHECK(C(j, i) == conj(A(i, j)));
+            }
+    }
+}
+
+TEMPLATE_TEST_CASE("In-place transpose of a square matrix gives correct result",
+                   "[util]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Generate n
+    idx_t n = GENERATE(1, 2, 5, 10, 33);
+
+    // Define the matrices
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, n);
+
+    // Generate a random matrix in A
+    mm.random(A);
+    lacpy(GENERAL, A, B);
+
+    DYNAMIC_SECTION("n = " << n)
+    {
+        TransposeOpts opts;
+        // Set nx to a small value so that the recursion gets tested even for
+        // small n
+        opts.nx = 3;
+
+        transpose_inplace(B, opts);
+        for (idx_t i = 0; i < n; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(B(j, i) == A(i, j));
+
+        conjtranspose_inplace(B, opts);
+        for (idx_t i = 0; i < n; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(B(i, j) == conj(A(i, j)));
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "In-place transpose of contiguous storage gives correct result",
+    "[util]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    // Generate n
+    idx_t n = GENERATE(1, 2, 3, 7, 12);
+    // Generate m
+    idx_t m = GENERATE(1, 2, 5, 12);
+
+    rand_generator gen;
+    std::vector<T> v(m * n);
+    for (idx_t k = 0; k < m * n; ++k)
+        v[k] = rand_helper<T>(gen);
+    auto w = v;
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n)
+    {
+        transpose_inplace(m, n, v);
+        for (idx_t i = 0; i < m; ++i)
+            for (idx_t j = 0; j < n; ++j)
+                CHECK(v[j + i * n] == w[i + j * m]);
+
+        conjtranspose_inplace(n, m, v);
+        for (idx_t k = 0; k < m * n; ++k)
+            CHECK(v[k] == conj(w[k]));
+    }
+}
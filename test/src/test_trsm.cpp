@@ -0,0 +1,194 @@
+/// @file test_trsm.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test the blocked triangular solve and triangular product
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// <T>LAPACK
+#include <tlapack/blas/trmm.hpp>
+#include <tlapack/blas/trsm.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE("Blocked trsm and trmm give the correct result",
+                   "[trsm][trmm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = GENERATE(1, 12);
+    const idx_t n = GENERATE(1, 13);
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " side = " << side
+                           << " uplo = " << uplo << " trans = " << trans
+                           << " diag = " << diag)
+    {
+        const idx_t k = (side == Side::Left) ? m : n;
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * k) * eps;
+        const T alpha = T(real_t(1.5));
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, k, k);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, m, n);
+        std::vector<T> R_;
+        auto R = new_matrix(R_, m, n);
+
+        // Well conditioned triangular matrix
+        mm.random(A);
+        for (idx_t j = 0; j < k; ++j)
+            A(j, j) += real_t(k);
+        mm.random(B);
+
+        // Full op(A), with zeros in the opposite triangle
+        auto opA = [&](idx_t i, idx_t j) -> T {
+            const idx_t r = (trans == Op::NoTrans) ? i : j;
+            const idx_t c = (trans == Op::NoTrans) ? j : i;
+            if ((uplo == Uplo::Upper) ? (r > c) : (r < c)) return T(0);
+            if (r == c && diag == Diag::Unit) return T(1);
+            return (trans == Op::ConjTrans) ? conj(A(r, c)) : A(r, c);
+        };
+
+        // R = op(A) X or X op(A)
+        auto multiply = [&](const auto& X, auto& R) {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i) {
+                    T sum(0);
+                    if (side == Side::Left)
+                        for (idx_t l = 0; l < m; ++l)
+                            sum += opA(i, l) * X(l, j);
+                    else
+                        for (idx_t l = 0; l < n; ++l)
+                            sum += X(i, l) * opA(l, j);
+                    R(i, j) = sum;
+                }
+        };
+
+        // Use a small block size so that the blocked algorithm is exercised
+        GemmBlockedOpts opts;
+        opts.nb = 5;
+        opts.mc = 6;
+        opts.kc = 4;
+        opts.nc = 7;
+
+        // Solve and check that op(A) X = alpha B
+        lacpy(GENERAL, B, X);
+        trsm_blocked(side, uplo, trans, diag, alpha, A, X, opts);
+        multiply(X, R);
+        real_t err(0), normB(1);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                err = max(err, abs1(R(i, j) - alpha * B(i, j)));
+                normB = max(normB, abs1(alpha * B(i, j)));
+            }
+        CHECK(err <= tol * normB);
+
+        // Multiply and check that X = alpha op(A) B
+        lacpy(GENERAL, B, X);
+        trmm_blocked(side, uplo, trans, diag, alpha, A, X, opts);
+        multiply(B, R);
+        err = real_t(0);
+        real_t normR(1);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i) {
+                err = max(err, abs1(alpha * R(i, j) - X(i, j)));
+                normR = max(normR, abs1(alpha * R(i, j)));
+            }
+        CHECK(err <= tol * normR);
+    }
+}
+
+TEMPLATE_TEST_CASE("Multithreaded trsm and trmm match the sequential ones",
+                   "[trsm][trmm]",
+                   TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    // Large enough to be split in tiles
+    const idx_t m = 70;
+    const idx_t n = 81;
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::ConjTrans);
+
+    DYNAMIC_SECTION("side = " << side << " uplo = " << uplo
+                              << " trans = " << trans)
+    {
+        const idx_t k = (side == Side::Left) ? m : n;
+        const real_t eps = ulp<real_t>();
+        const real_t tol = real_t(10 * k) * eps;
+        const T alpha = T(real_t(1.5));
+
+        // Create matrices
+        std::vector<T> A_;
+        auto A = new_matrix(A_, k, k);
+        std::vector<T> B_;
+        auto B = new_matrix(B_, m, n);
+        std::vector<T> X_;
+        auto X = new_matrix(X_, m, n);
+
+        // Well conditioned triangular matrix
+        mm.random(A);
+        for (idx_t j = 0; j < k; ++j)
+            A(j, j) += real_t(k);
+        mm.random(B);
+
+        ThreadPool pool(3);
+        GemmBlockedOpts opts;
+        opts.num_threads = 0;
+        opts.pool = &pool;
+
+        for (int solve = 0; solve < 2; ++solve) {
+            lacpy(GENERAL, B, X);
+            if (solve) {
+                trsm(side, uplo, trans, Diag::NonUnit, alpha, A, B,
+                     GemmBlockedOpts{});
+                trsm(side, uplo, trans, Diag::NonUnit, alpha, A, X, opts);
+            }
+            else {
+                trmm(side, uplo, trans, Diag::NonUnit, alpha, A, B,
+                     GemmBlockedOpts{});
+                trmm(side, uplo, trans, Diag::NonUnit, alpha, A, X, opts);
+            }
+
+            const real_t normB = lange(MAX_NORM, B);
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    X(i, j) -= B(i, j);
+            CHECK(lange(MAX_NORM, X) <= tol * max(normB, real_t(1)));
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/// @file test_unmq.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Test unmq and ungq with parallel block reflectors
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Test utilities and definitions (must come before <T>LAPACK headers)
+#include "testutils.hpp"
+
+// Auxiliary routines
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/lange.hpp>
+
+// Other routines
+#include <tlapack/lapack/gelq2.hpp>
+#include <tlapack/lapack/geql2.hpp>
+#include <tlapack/lapack/geqr2.hpp>
+#include <tlapack/lapack/gerq2.hpp>
+#include <tlapack/lapack/ungq.hpp>
+#include <tlapack/lapack/unmq.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_TEST_CASE(
+    "unmq and ungq with parallel block reflectors and two-level T factors",
+    "[unmq][ungq]",
+    TLAPACK_TYPES_TO_TEST)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    // MatrixMarket reader
+    MatrixMarket mm;
+
+    const idx_t m = 100;
+    const idx_t k = 48;
+    const idx_t nc = 130;
+
+    const Direction direction =
+        GENERATE(Direction::Forward, Direction::Backward);
+    const StoreV storeMode = GENERATE(StoreV::Columnwise, StoreV::Rowwise);
+    const bool columnwise = (storeMode == StoreV::Columnwise);
+
+    const real_t eps = ulp<real_t>();
+    const real_t tol = real_t(100.0 * m) * eps;
+
+    // Reflectors from a QR, QL, LQ or RQ factorization
+    std::vector<T> V_;
+    auto V = columnwise ? new_matrix(V_, m, k) : new_matrix(V_, k, m);
+    std::vector<T> tau(k);
+    mm.random(V);
+    if (columnwise) {
+        if (direction == Direction::Forward)
+            geqr2(V, tau);
+        else
+            geql2(V, tau);
+    }
+    else {
+        if (direction == Direction::Forward)
+            gelq2(V, tau);
+        else
+            gerq2(V, tau);
+    }
+
+    ThreadPool pool(3);
+
+    UnmqOpts serialOpts;
+    serialOpts.nb = 8;
+    UnmqOpts parallelOpts;
+    parallelOpts.nb = 8;
+    parallelOpts.nb2 = 24;
+    parallelOpts.num_threads = 0;
+    parallelOpts.pool = &pool;
+
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Op trans = GENERATE(Op::NoTrans, Op::ConjTrans);
+
+    DYNAMIC_SECTION("unmq with direction = "
+                    << direction << " storeMode = " << storeMode
+                    << " side = " << side << " trans = " << trans)
+    {
+        const idx_t mc = (side == Side::Left) ? m : nc;
+        const idx_t ncc = (side == Side::Left) ? nc : m;
+
+        std::vector<T> C_;
+        auto C = new_matrix(C_, mc, ncc);
+        std::vector<T> C0_;
+        auto C0 = new_matrix(C0_, mc, ncc);
+        mm.random(C0);
+        lacpy(GENERAL, C0, C);
+
+        unmq(side, trans, direction, storeMode, V, tau, C0, serialOpts);
+        unmq(side, trans, direction, storeMode, V, tau, C, parallelOpts);
+
+        const real_t cnorm = lange(MAX_NORM, C0);
+        for (idx_t j = 0; j < ncc; ++j)
+            for (idx_t i = 0; i < mc; ++i)
+                C(i, j) -= C0(i, j);
+        CHECK(lange(MAX_NORM, C) <= tol * cnorm);
+    }
+
+    DYNAMIC_SECTION("ungq with direction = " << direction
+                                             << " storeMode = " << storeMode)
+    {
+        std::vector<T> Q_;
+        auto Q = columnwise ? new_matrix(Q_, m, k) : new_matrix(Q_, k, m);
+        std::vector<T> Q0_;
+        auto Q0 = columnwise ? new_matrix(Q0_, m, k) : new_matrix(Q0_, k, m);
+        lacpy(GENERAL, V, Q0);
+        lacpy(GENERAL, V, Q);
+
+        UngqOpts ungqOpts;
+        ungqOpts.nb = 8;
+        ungq(direction, storeMode, Q0, tau, ungqOpts);
+        ungqOpts.num_threads = 0;
+        ungqOpts.pool = &pool;
+        ungq(direction, storeMode, Q, tau, ungqOpts);
+
+        for (idx_t j = 0; j < ncols(Q); ++j)
+            for (idx_t i = 0; i < nrows(Q); ++i)
+                Q(i, j) -= Q0(i, j);
+        CHECK(lange(MAX_NORM, Q) <= tol);
+    }
+}
@@ -11,6 +11,13 @@
 // Test utilities and definitions (must come before <T>LAPACK headers)
 #include "testutils.hpp"
 
+// Other routines
+#include <tlapack/base/TaskGraph.hpp>
+#include <tlapack/base/tuning.hpp>
+#include <tlapack/lapack/FrancisOpts.hpp>
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/unmq.hpp>
+
 using namespace tlapack;
 
 TEST_CASE("Random generator is consistent if seed is fixed", "[utils]")
@@ -51,3 +58,68 @@ TEST_CASE("is_matrix and is_vector work", "[utils]")
     CHECK(!is_vector<float>);
     CHECK(!is_vector<std::complex<double> >);
 }
+
+TEST_CASE("Tuning profiles set the defaults of the options", "[utils]")
+{
+    std::istringstream is(
+        "# Comment\n"
+        "gehrd.nb 48  # Block size of gehrd\n"
+        "\n"
+        "multishift_qr.nshifts@1000 80\n"
+        "multishift_qr.nshifts@3000 96\n");
+
+    TuningProfile profile;
+    REQUIRE(profile.read(is));
+    CHECK(profile.get("gehrd.nb", 32) == 48);
+    CHECK(profile.get("unmq.nb", 32) == 32);
+    CHECK(profile.get("multishift_qr.nshifts", 500, 10) == 10);
+    CHECK(profile.get("multishift_qr.nshifts", 1000, 10) == 80);
+    CHECK(profile.get("multishift_qr.nshifts", 2999, 10) == 80);
+    CHECK(profile.get("multishift_qr.nshifts", 5000, 10) == 96);
+
+    // Write and read back
+    std::ostringstream os;
+    profile.write(os);
+    std::istringstream is2(os.str());
+    TuningProfile profile2;
+    REQUIRE(profile2.read(is2));
+    CHECK(profile2.get("multishift_qr.nshifts", 5000, 10) == 96);
+
+    // Invalid lines
+    std::istringstream bad("gehrd.nb\n");
+    CHECK(!TuningProfile().read(bad));
+    std::istringstream bad2("gehrd.nb@x 4\n");
+    CHECK(!TuningProfile().read(bad2));
+
+    // The options structs use the global profile
+    TuningProfile& global = TuningProfile::global();
+    const TuningProfile saved = global;
+    global = profile;
+    CHECK(GehrdOpts{}.nb == 48);
+    CHECK(UnmqOpts{}.nb == 32);
+    CHECK(FrancisOpts{}.nshift_recommender(4000, 4000) == 96);
+    CHECK(FrancisOpts{}.nshift_recommender(100, 100) == 10);
+    global = saved;
+}
+
+TEST_CASE("TaskGraph runs tasks that access a handle more than once",
+          "[utils]")
+{
+    ThreadPool pool(2);
+    TaskGraph graph;
+    std::vector<int> order;
+
+    graph.insert_task([&]() { order.push_back(0); }, 1,
+                      {TaskGraph::write(0)});
+    graph.insert_task([&]() { order.push_back(1); }, 1,
+                      {TaskGraph::read(0), TaskGraph::write(0)});
+    graph.insert_task([&]() { order.push_back(2); }, 1,
+                      {TaskGraph::write(0), TaskGraph::write(0)});
+    graph.insert_task([&]() { order.push_back(3); }, 1,
+                      {TaskGraph::read(0), TaskGraph::read(0)});
+    graph.run(pool, 3);
+
+    REQUIRE(order.size() == 4);
+    for (int i = 0; i < 4; ++i)
+        CHECK(order[i] == i);
+}
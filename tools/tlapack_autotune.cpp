@@ -0,0 +1,376 @@
+/// @file tlapack_autotune.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Measures the tuning parameters of <T>LAPACK on this machine
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <tlapack/plugins/legacyArray.hpp>
+
+// <T>LAPACK
+#include <tlapack/base/tuning.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/multishift_qr.hpp>
+#include <tlapack/lapack/potrf_blocked.hpp>
+#include <tlapack/lapack/transpose.hpp>
+#include <tlapack/lapack/ungqr.hpp>
+#include <tlapack/lapack/unmqr.hpp>
+
+// C++ headers
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace tlapack;
+
+using idx_t = size_t;
+template <class T>
+using matrix_t = LegacyMatrix<T, idx_t>;
+
+//------------------------------------------------------------------------------
+// Parameters and candidate values
+
+/// A tuning parameter
+struct Parameter {
+    std::string name;  ///< Name in the tuning profile
+    bool per_size;     ///< If true, the parameter is tuned for each size
+};
+
+const std::vector<Parameter> parameters = {
+    {"unmq.nb", false},   {"ungq.nb", false},
+    {"gehrd.nb", false},  {"potrf.nb", false},
+    {"transpose.nx", false}, {"multishift_qr.nshifts", true},
+    {"multishift_qr.nw", true}};
+
+/// Default value of the parameter name for problems of size n
+size_t default_value(const std::string& name, size_t n)
+{
+    if (name == "transpose.nx") return 16;
+    if (name == "multishift_qr.nshifts")
+        return FrancisOpts{}.nshift_recommender(n, n);
+    if (name == "multishift_qr.nw")
+        return FrancisOpts{}.deflation_window_recommender(n, n);
+    return 32;
+}
+
+/// Values of the parameter name tried for problems of size n
+std::vector<size_t> candidates(const std::string& name, size_t n)
+{
+    if (name == "transpose.nx") return {8, 16, 32, 64, 128};
+    if (name == "multishift_qr.nshifts" || name == "multishift_qr.nw") {
+        // Multiples of the default value. The number of shifts is even
+        const size_t d = default_value(name, n);
+        std::vector<size_t> v;
+        for (size_t c : {d / 2, (3 * d) / 4, d, (3 * d) / 2, 2 * d}) {
+            c = std::max<size_t>(c - c % 2, 2);
+            if (c <= n / 2 && std::find(v.begin(), v.end(), c) == v.end())
+                v.push_back(c);
+        }
+        return v;
+    }
+    return {16, 24, 32, 48, 64, 96, 128};
+}
+
+//------------------------------------------------------------------------------
+// Timings
+
+template <class T>
+void random_matrix(matrix_t<T>& A)
+{
+    for (idx_t j = 0; j < ncols(A); ++j)
+        for (idx_t i = 0; i < nrows(A); ++i) {
+            if constexpr (is_complex<T>)
+                A(i, j) = T(rand() / double(RAND_MAX),
+                            rand() / double(RAND_MAX));
+            else
+                A(i, j) = T(rand() / double(RAND_MAX));
+        }
+}
+
+/// Minimum time, in seconds, of reps calls to run after calls to setup
+template <class Setup, class Run>
+double min_time(int reps, Setup&& setup, Run&& run)
+{
+    double tmin = std::numeric_limits<double>::infinity();
+    for (int r = 0; r < reps; ++r) {
+        setup();
+        const auto t0 = std::chrono::steady_clock::now();
+        run();
+        const auto t1 = std::chrono::steady_clock::now();
+        tmin = std::min(tmin, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return tmin;
+}
+
+/// Time of the routine tuned by the parameter name, on a problem of size n,
+/// with the parameter set to value
+template <class T>
+double measure(const std::string& name, size_t n, size_t value, int reps)
+{
+    using real_t = real_type<T>;
+    std::vector<T> A_(n * n), B_(n * n), C_(n * n);
+    matrix_t<T> A(n, n, A_.data(), n);
+    matrix_t<T> B(n, n, B_.data(), n);
+    matrix_t<T> C(n, n, C_.data(), n);
+    std::vector<T> tau(n);
+
+    random_matrix(A);
+
+    if (name == "unmq.nb" || name == "ungq.nb") {
+        geqrf(A, tau);
+        if (name == "unmq.nb") {
+            UnmqrOpts opts;
+            opts.nb = value;
+            return min_time(
+                reps, [&]() { random_matrix(C); },
+                [&]() { unmqr(LEFT_SIDE, CONJ_TRANS, A, tau, C, opts); });
+        }
+        else {
+            UngqrOpts opts;
+            opts.nb = value;
+            return min_time(
+                reps, [&]() { lacpy(GENERAL, A, B); },
+                [&]() { ungqr(B, tau, opts); });
+        }
+    }
+    else if (name == "gehrd.nb") {
+        GehrdOpts opts;
+        opts.nb = value;
+        return min_time(
+            reps, [&]() { lacpy(GENERAL, A, B); },
+            [&]() { gehrd(0, n, B, tau, opts); });
+    }
+    else if (name == "potrf.nb") {
+        // Hermitian positive definite matrix
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < j; ++i)
+                A(j, i) = conj(A(i, j));
+            A(j, j) = T(real_t(n));
+        }
+        BlockedCholeskyOpts opts;
+        opts.nb = value;
+        return min_time(
+            reps, [&]() { lacpy(GENERAL, A, B); },
+            [&]() { potrf_blocked(LOWER_TRIANGLE, B, opts); });
+    }
+    else if (name == "transpose.nx") {
+        TransposeOpts opts;
+        opts.nx = value;
+        return min_time(
+            reps, []() {}, [&]() { transpose(A, B, opts); });
+    }
+    else {
+        // Hessenberg matrix
+        gehrd(0, n, A, tau);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                A(i, j) = T(0);
+
+        std::vector<complex_type<real_t>> w(n);
+        FrancisOpts opts;
+        const FrancisOpts defaults;
+        if (name == "multishift_qr.nshifts")
+            opts.nshift_recommender = [&](size_t m, size_t mh) {
+                return (m == n) ? value : defaults.nshift_recommender(m, mh);
+            };
+        else
+            opts.deflation_window_recommender = [&](size_t m, size_t mh) {
+                return (m == n) ? value
+                                : defaults.deflation_window_recommender(m, mh);
+            };
+        return min_time(
+            reps,
+            [&]() {
+                lacpy(GENERAL, A, B);
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < n; ++i)
+                        C(i, j) = (i == j) ? T(1) : T(0);
+            },
+            [&]() { multishift_qr(true, true, 0, n, B, w, C, opts); });
+    }
+}
+
+double measure(char type,
+               const std::string& name,
+               size_t n,
+               size_t value,
+               int reps)
+{
+    switch (type) {
+        case 's':
+            return measure<float>(name, n, value, reps);
+        case 'd':
+            return measure<double>(name, n, value, reps);
+        case 'c':
+            return measure<std::complex<float>>(name, n, value, reps);
+        default:
+            return measure<std::complex<double>>(name, n, value, reps);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Command line
+
+std::vector<std::string> split(const std::string& s)
+{
+    std::vector<std::string> v;
+    size_t i = 0;
+    while (i <= s.size()) {
+        const size_t j = std::min(s.find(',', i), s.size());
+        if (j > i) v.push_back(s.substr(i, j - i));
+        i = j + 1;
+    }
+    return v;
+}
+
+void usage(const char* prog)
+{
+    std::cout
+        << "Usage: " << prog << " [options]\n"
+        << "Measures the tuning parameters of <T>LAPACK on this machine and\n"
+        << "writes a tuning profile. Use the profile by setting the\n"
+        << "environment variable TLAPACK_TUNING_PROFILE to its path.\n\n"
+        << "Options:\n"
+        << "  -o FILE   Output profile (default: tlapack_tuning.txt)\n"
+        << "  -n LIST   Comma-separated problem sizes (default: "
+           "256,512,1024)\n"
+        << "  -t LIST   Comma-separated types among s,d,c,z (default: d)\n"
+        << "  -p LIST   Comma-separated parameters (default: all)\n"
+        << "  -r N      Repetitions of each measure (default: 3)\n"
+        << "  -h        Show this message\n\n"
+        << "Parameters:\n";
+    for (const auto& p : parameters)
+        std::cout << "  " << p.name << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    std::string output = "tlapack_tuning.txt";
+    std::vector<size_t> sizes = {256, 512, 1024};
+    std::string types = "d";
+    std::vector<Parameter> params = parameters;
+    int reps = 3;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-h") {
+            usage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const std::string val = argv[++i];
+        if (arg == "-o")
+            output = val;
+        else if (arg == "-n") {
+            sizes.clear();
+            for (const auto& s : split(val))
+                sizes.push_back(std::stoul(s));
+        }
+        else if (arg == "-t") {
+            types.clear();
+            for (const auto& s : split(val)) {
+                if (s.size() != 1 || std::string("sdcz").find(s) == s.npos) {
+                    usage(argv[0]);
+                    return 1;
+                }
+                types += s;
+            }
+        }
+        else if (arg == "-p") {
+            params.clear();
+            for (const auto& s : split(val)) {
+                auto it = std::find_if(
+                    parameters.begin(), parameters.end(),
+                    [&](const Parameter& p) { return p.name == s; });
+                if (it == parameters.end()) {
+                    usage(argv[0]);
+                    return 1;
+                }
+                params.push_back(*it);
+            }
+        }
+        else if (arg == "-r")
+            reps = std::max(1, std::atoi(val.c_str()));
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    std::sort(sizes.begin(), sizes.end());
+    if (sizes.empty() || sizes[0] < 16) {
+        std::cerr << "Sizes must be at least 16\n";
+        return 1;
+    }
+
+    // Measure with the default values of <T>LAPACK
+    TuningProfile::global().clear();
+
+    TuningProfile profile;
+    for (const auto& p : params) {
+        // Groups of sizes tuned together
+        std::vector<std::vector<size_t>> groups;
+        if (p.per_size)
+            for (size_t n : sizes)
+                groups.push_back({n});
+        else
+            groups.push_back(sizes);
+
+        for (const auto& group : groups) {
+            // Relative time of each value, summed over sizes and types
+            const std::vector<size_t> values = candidates(p.name, group[0]);
+            std::vector<double> score(values.size(), 0.0);
+
+            for (size_t n : group) {
+                for (char type : types) {
+                    std::vector<double> t(values.size());
+                    for (size_t k = 0; k < values.size(); ++k) {
+                        t[k] = measure(type, p.name, n, values[k], reps);
+                        std::printf("%-22s %c n = %5zu value = %4zu: %10.4g s\n",
+                                    p.name.c_str(), type, n, values[k], t[k]);
+                        std::fflush(stdout);
+                    }
+                    const double tbest = *std::min_element(t.begin(), t.end());
+                    for (size_t k = 0; k < values.size(); ++k)
+                        score[k] += t[k] / tbest;
+                }
+            }
+
+            const size_t best =
+                std::min_element(score.begin(), score.end()) - score.begin();
+            const size_t n = p.per_size ? group[0] : 0;
+            profile.set(p.name, values[best], n);
+            std::printf("%-22s best value = %zu (default %zu)\n\n",
+                        p.name.c_str(), values[best],
+                        default_value(p.name, group[0]));
+        }
+    }
+
+    std::ofstream f(output);
+    f << "# <T>LAPACK tuning profile written by tlapack_autotune\n"
+      << "# Types: " << types << "\n# Sizes:";
+    for (size_t n : sizes)
+        f << " " << n;
+    f << "\n";
+    profile.write(f);
+    if (!f) {
+        std::cerr << "Could not write " << output << "\n";
+        return 1;
+    }
+    std::cout << "Tuning profile written to " << output << "\n";
+
+    return 0;
+}
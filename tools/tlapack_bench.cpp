@@ -0,0 +1,461 @@
+/// @file tlapack_bench.cpp
+/// @author Weslley S Pereira, University of Colorado Denver, USA
+/// @brief Benchmarks the BLAS-3 kernels and the LAPACK drivers of <T>LAPACK
+//
+// Copyright (c) 2021-2023, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <tlapack/plugins/legacyArray.hpp>
+#include <tlapack/plugins/stdvector.hpp>
+
+#ifdef TLAPACK_BENCH_EIGEN
+    #include <tlapack/plugins/eigen.hpp>
+#endif
+#ifdef TLAPACK_BENCH_MDSPAN
+    #include <tlapack/plugins/mdspan.hpp>
+#endif
+#ifdef TLAPACK_BENCH_MPFR
+    #include <tlapack/plugins/mpreal.hpp>
+#endif
+#ifdef TLAPACK_BENCH_QUAD
+    #include <tlapack/plugins/gnuquad.hpp>
+#endif
+
+// <T>LAPACK
+#include <tlapack/blas/gemm.hpp>
+#include <tlapack/blas/trsm.hpp>
+#include <tlapack/lapack/gehrd.hpp>
+#include <tlapack/lapack/geqrf.hpp>
+#include <tlapack/lapack/gesvd.hpp>
+#include <tlapack/lapack/getrf.hpp>
+#include <tlapack/lapack/lacpy.hpp>
+#include <tlapack/lapack/laset.hpp>
+#include <tlapack/lapack/multishift_qr.hpp>
+#include <tlapack/lapack/potrf.hpp>
+
+// C++ headers
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace tlapack;
+
+using idx_t = size_t;
+
+//------------------------------------------------------------------------------
+// Routines, types and backends
+
+const std::vector<std::string> routines = {
+    "gemm",  "trsm",  "getrf",         "potrf",
+    "geqrf", "gehrd", "multishift_qr", "gesvd"};
+
+/// Number of floating-point operations of routine on real n-by-n matrices.
+///
+/// The counts of gemm, trsm and the factorizations are the ones of LAPACK
+/// Working Note 41. multishift_qr and gesvd have no exact count. For them, the
+/// nominal counts of Golub and Van Loan are used: 20 n^3 for the Schur
+/// form and the Schur vectors of a Hessenberg matrix, and 8/3 n^3 for the
+/// singular values of a general matrix. Complex routines count 4 times as
+/// many operations.
+double flops(const std::string& routine, double n, bool complex)
+{
+    double f;
+    if (routine == "gemm")
+        f = 2 * n * n * n;
+    else if (routine == "trsm")
+        f = n * n * n;
+    else if (routine == "getrf")
+        f = 2. / 3. * n * n * n;
+    else if (routine == "potrf")
+        f = 1. / 3. * n * n * n;
+    else if (routine == "geqrf")
+        f = 4. / 3. * n * n * n;
+    else if (routine == "gehrd")
+        f = 10. / 3. * n * n * n;
+    else if (routine == "multishift_qr")
+        f = 20 * n * n * n;
+    else
+        f = 8. / 3. * n * n * n;
+    return complex ? 4 * f : f;
+}
+
+/// Types in the order of the command line, and their names in the report
+const std::string type_letters = "sdczmq";
+const char* type_name(char type)
+{
+    switch (type) {
+        case 's':
+            return "float";
+        case 'd':
+            return "double";
+        case 'c':
+            return "complex<float>";
+        case 'z':
+            return "complex<double>";
+        case 'm':
+            return "mpreal";
+        default:
+            return "float128";
+    }
+}
+
+const std::vector<std::string> backends = {"legacy", "eigen", "mdspan"};
+
+/// Matrix type of each backend
+template <class T>
+using legacy_t = LegacyMatrix<T, idx_t>;
+#ifdef TLAPACK_BENCH_EIGEN
+template <class T>
+using eigen_t = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+#endif
+#ifdef TLAPACK_BENCH_MDSPAN
+template <class T>
+using mdspan_t = std::experimental::mdspan<
+    T,
+    std::experimental::dextents<idx_t, 2>,
+    std::experimental::layout_left>;
+#endif
+
+//------------------------------------------------------------------------------
+// Timings
+
+template <class matrix_t>
+void random_matrix(matrix_t& A)
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+    for (idx_t j = 0; j < ncols(A); ++j)
+        for (idx_t i = 0; i < nrows(A); ++i) {
+            if constexpr (is_complex<T>)
+                A(i, j) = T(real_t(rand() / double(RAND_MAX)),
+                            real_t(rand() / double(RAND_MAX)));
+            else
+                A(i, j) = T(rand() / double(RAND_MAX));
+        }
+}
+
+/// Minimum time, in seconds, of reps calls to run after calls to setup
+template <class Setup, class Run>
+double min_time(int reps, Setup&& setup, Run&& run)
+{
+    double tmin = std::numeric_limits<double>::infinity();
+    for (int r = 0; r < reps; ++r) {
+        setup();
+        const auto t0 = std::chrono::steady_clock::now();
+        run();
+        const auto t1 = std::chrono::steady_clock::now();
+        tmin = std::min(tmin, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return tmin;
+}
+
+/// Time of routine on n-by-n matrices of type matrix_t
+template <class matrix_t>
+double measure(const std::string& routine, idx_t n, int reps)
+{
+    using T = type_t<matrix_t>;
+    using real_t = real_type<T>;
+
+    // Functor
+    Create<matrix_t> new_matrix;
+
+    std::vector<T> A0_;
+    auto A0 = new_matrix(A0_, n, n);
+    std::vector<T> A_;
+    auto A = new_matrix(A_, n, n);
+    std::vector<T> B_;
+    auto B = new_matrix(B_, n, n);
+    std::vector<T> C_;
+    auto C = new_matrix(C_, n, n);
+    std::vector<T> tau(n);
+
+    random_matrix(A0);
+    auto reset = [&]() { lacpy(GENERAL, A0, A); };
+
+    if (routine == "gemm") {
+        random_matrix(B);
+        return min_time(
+            reps, []() {},
+            [&]() { gemm(NO_TRANS, NO_TRANS, T(1), A0, B, T(0), C); });
+    }
+    else if (routine == "trsm") {
+        // Well-conditioned lower triangular matrix
+        for (idx_t j = 0; j < n; ++j)
+            A0(j, j) = T(real_t(n));
+        random_matrix(C);
+        return min_time(
+            reps, [&]() { lacpy(GENERAL, C, B); },
+            [&]() {
+                trsm(LEFT_SIDE, LOWER_TRIANGLE, NO_TRANS, NON_UNIT_DIAG, T(1),
+                     A0, B);
+            });
+    }
+    else if (routine == "getrf") {
+        std::vector<idx_t> piv(n);
+        return min_time(reps, reset, [&]() { getrf(A, piv); });
+    }
+    else if (routine == "potrf") {
+        // Hermitian positive definite matrix
+        for (idx_t j = 0; j < n; ++j) {
+            for (idx_t i = 0; i < j; ++i)
+                A0(j, i) = conj(A0(i, j));
+            A0(j, j) = T(real_t(n));
+        }
+        return min_time(reps, reset, [&]() { potrf(LOWER_TRIANGLE, A); });
+    }
+    else if (routine == "geqrf") {
+        return min_time(reps, reset, [&]() { geqrf(A, tau); });
+    }
+    else if (routine == "gehrd") {
+        return min_time(reps, reset, [&]() { gehrd(0, n, A, tau); });
+    }
+    else if (routine == "multishift_qr") {
+        // Hessenberg matrix
+        gehrd(0, n, A0, tau);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                A0(i, j) = T(0);
+
+        std::vector<complex_type<real_t>> w(n);
+        FrancisOpts opts;
+        return min_time(
+            reps,
+            [&]() {
+                reset();
+                laset(GENERAL, T(0), T(1), C);
+            },
+            [&]() { multishift_qr(true, true, 0, n, A, w, C, opts); });
+    }
+    else {
+        std::vector<real_t> s(n);
+        std::vector<T> U_;
+        auto U = new_matrix(U_, 0, 0);
+        std::vector<T> Vt_;
+        auto Vt = new_matrix(Vt_, 0, 0);
+        return min_time(reps, reset,
+                        [&]() { gesvd(false, false, A, s, U, Vt); });
+    }
+}
+
+/// Time of routine on n-by-n matrices of the given type and backend, or a
+/// negative number if the combination is not available in this build
+template <class T>
+double measure(const std::string& backend,
+               const std::string& routine,
+               idx_t n,
+               int reps)
+{
+    if (backend == "legacy") return measure<legacy_t<T>>(routine, n, reps);
+    if constexpr (is_same_v<real_type<T>, float> ||
+                  is_same_v<real_type<T>, double>) {
+#ifdef TLAPACK_BENCH_EIGEN
+        if (backend == "eigen") return measure<eigen_t<T>>(routine, n, reps);
+#endif
+#ifdef TLAPACK_BENCH_MDSPAN
+        if (backend == "mdspan") return measure<mdspan_t<T>>(routine, n, reps);
+#endif
+    }
+    return -1;
+}
+
+double measure(char type,
+               const std::string& backend,
+               const std::string& routine,
+               idx_t n,
+               int reps)
+{
+    switch (type) {
+        case 's':
+            return measure<float>(backend, routine, n, reps);
+        case 'd':
+            return measure<double>(backend, routine, n, reps);
+        case 'c':
+            return measure<std::complex<float>>(backend, routine, n, reps);
+        case 'z':
+            return measure<std::complex<double>>(backend, routine, n, reps);
+#ifdef TLAPACK_BENCH_MPFR
+        case 'm':
+            return measure<mpfr::mpreal>(backend, routine, n, reps);
+#endif
+#ifdef TLAPACK_BENCH_QUAD
+        case 'q':
+            return measure<__float128>(backend, routine, n, reps);
+#endif
+        default:
+            return -1;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Command line
+
+std::vector<std::string> split(const std::string& s)
+{
+    std::vector<std::string> v;
+    size_t i = 0;
+    while (i <= s.size()) {
+        const size_t j = std::min(s.find(',', i), s.size());
+        if (j > i) v.push_back(s.substr(i, j - i));
+        i = j + 1;
+    }
+    return v;
+}
+
+/// Reads the comma-separated list val into v. Returns false if an element is
+/// not in allowed
+bool read_list(const std::string& val,
+               const std::vector<std::string>& allowed,
+               std::vector<std::string>& v)
+{
+    v.clear();
+    for (const auto& s : split(val)) {
+        if (std::find(allowed.begin(), allowed.end(), s) == allowed.end())
+            return false;
+        v.push_back(s);
+    }
+    return !v.empty();
+}
+
+void usage(const char* prog)
+{
+    std::cout
+        << "Usage: " << prog << " [options]\n"
+        << "Times the BLAS-3 kernels and the LAPACK drivers of <T>LAPACK on\n"
+        << "n-by-n matrices and reports the rates in GFLOP/s.\n\n"
+        << "Options:\n"
+        << "  -n LIST   Comma-separated problem sizes (default: "
+           "128,256,512)\n"
+        << "  -t LIST   Comma-separated types among s,d,c,z,m,q (default: "
+           "s,d,c,z)\n"
+        << "            m is mpfr::mpreal and q is __float128\n"
+        << "  -b LIST   Comma-separated backends among legacy,eigen,mdspan\n"
+        << "            (default: legacy)\n"
+        << "  -p LIST   Comma-separated routines (default: all)\n"
+        << "  -r N      Repetitions of each measure (default: 3)\n"
+        << "  -o FILE   Also write the results to FILE in JSON format\n"
+        << "  -h        Show this message\n\n"
+        << "Routines:\n";
+    for (const auto& r : routines)
+        std::cout << "  " << r << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    std::string output;
+    std::vector<size_t> sizes = {128, 256, 512};
+    std::string types = "sdcz";
+    std::vector<std::string> bench_backends = {"legacy"};
+    std::vector<std::string> bench_routines = routines;
+    int reps = 3;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-h") {
+            usage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const std::string val = argv[++i];
+        bool ok = true;
+        if (arg == "-o")
+            output = val;
+        else if (arg == "-n") {
+            sizes.clear();
+            for (const auto& s : split(val))
+                sizes.push_back(std::stoul(s));
+            ok = !sizes.empty();
+        }
+        else if (arg == "-t") {
+            types.clear();
+            for (const auto& s : split(val)) {
+                if (s.size() != 1 || type_letters.find(s) == s.npos) ok = false;
+                types += s;
+            }
+        }
+        else if (arg == "-b")
+            ok = read_list(val, backends, bench_backends);
+        else if (arg == "-p")
+            ok = read_list(val, routines, bench_routines);
+        else if (arg == "-r")
+            reps = std::max(1, std::atoi(val.c_str()));
+        else
+            ok = false;
+
+        if (!ok) {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    struct Result {
+        std::string routine;
+        char type;
+        std::string backend;
+        size_t n;
+        double time;
+        double gflops;
+    };
+    std::vector<Result> results;
+    std::set<std::string> skipped;
+
+    std::printf("%-14s %-16s %-7s %6s %12s %10s\n", "routine", "type",
+                "backend", "n", "time (s)", "GFLOP/s");
+    for (const auto& routine : bench_routines)
+        for (char type : types)
+            for (const auto& backend : bench_backends)
+                for (size_t n : sizes) {
+                    const double t = measure(type, backend, routine, n, reps);
+                    if (t < 0) {
+                        if (skipped.insert(type + backend).second)
+                            std::fprintf(stderr,
+                                         "Skipping %s with %s: not available "
+                                         "in this build\n",
+                                         type_name(type), backend.c_str());
+                        break;
+                    }
+                    const double gflops =
+                        flops(routine, double(n),
+                              type == 'c' || type == 'z') /
+                        t * 1e-9;
+                    std::printf("%-14s %-16s %-7s %6zu %12.4e %10.3f\n",
+                                routine.c_str(), type_name(type),
+                                backend.c_str(), n, t, gflops);
+                    std::fflush(stdout);
+                    results.push_back({routine, type, backend, n, t, gflops});
+                }
+
+    if (!output.empty()) {
+        std::ofstream f(output);
+        f << "{\n  \"reps\": " << reps << ",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            f << (i ? ",\n" : "\n") << "    {\"routine\": \"" << r.routine
+              << "\", \"type\": \"" << type_name(r.type)
+              << "\", \"backend\": \"" << r.backend << "\", \"n\": " << r.n
+              << ", \"time\": " << r.time << ", \"gflops\": " << r.gflops
+              << "}";
+        }
+        f << "\n  ]\n}\n";
+        if (!f) {
+            std::cerr << "Could not write " << output << "\n";
+            return 1;
+        }
+        std::cout << "Results written to " << output << "\n";
+    }
+
+    return 0;
+}